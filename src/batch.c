@@ -0,0 +1,387 @@
+/*
+ * SPDX-FileCopyrightText: 2025 David Jolly <jolly.a.david@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "batch.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <threads.h>
+#include <time.h>
+#include <unistd.h>
+
+typedef struct {
+    uint32_t frame;
+    uint8_t state;
+} cgbl_batch_input_t;
+
+typedef struct {
+    const char *path;
+    const char *input;
+    uint32_t frames;
+    struct {
+        cgbl_error_e status;
+        char error[256];
+        uint64_t cycles;
+        uint64_t hash;
+        double time;
+        uint32_t length;
+        uint8_t *serial;
+    } result;
+} cgbl_batch_job_t;
+
+typedef struct {
+    mtx_t lock;
+    thrd_t thread;
+    uint32_t head;
+    uint32_t tail;
+    uint32_t *job;
+} cgbl_batch_queue_t;
+
+static struct {
+    char *manifest;
+    uint32_t count;
+    uint32_t workers;
+    cgbl_batch_job_t *job;
+    cgbl_batch_queue_t *queue;
+    const cgbl_option_t *option;
+} batch = {};
+
+static uint64_t cgbl_batch_hash(const uint8_t *const data, uint32_t length) {
+    uint64_t result = 0xCBF29CE484222325;
+    for (uint32_t index = 0; index < length; ++index) {
+        result = (result ^ data[index]) * 0x100000001B3;
+    }
+    return result;
+}
+
+static cgbl_error_e cgbl_batch_input_load(const char *const path, cgbl_batch_input_t **const input, uint32_t *const count) {
+    uint8_t *buffer = NULL;
+    uint32_t length = 0;
+    cgbl_error_e result = CGBL_SUCCESS;
+    *count = 0;
+    if (path && ((result = cgbl_file_read(path, &buffer, &length)) == CGBL_SUCCESS)) {
+        if ((result = cgbl_buffer_allocate((uint8_t **)input, ((length / 4) + 1) * sizeof(**input))) == CGBL_SUCCESS) {
+            for (uint32_t offset = 0; offset < length;) {
+                char line[64] = {};
+                unsigned frame = 0, state = 0;
+                uint32_t index = 0;
+                while ((offset < length) && (buffer[offset] != '\n')) {
+                    if (index < (sizeof(line) - 1)) {
+                        line[index++] = buffer[offset];
+                    }
+                    ++offset;
+                }
+                ++offset;
+                if (sscanf(line, "%u %x", &frame, &state) == 2) {
+                    (*input)[*count].frame = frame;
+                    (*input)[(*count)++].state = state;
+                } else if (strspn(line, " \t\r") != strlen(line)) {
+                    result = CGBL_ERROR("Malformed input: \'%s\'", path);
+                    break;
+                }
+            }
+        }
+        cgbl_buffer_free(buffer);
+    }
+    return result;
+}
+
+static void cgbl_batch_run(cgbl_context_t *const context, cgbl_batch_job_t *const job) {
+    uint32_t count = 0;
+    cgbl_batch_input_t *input = NULL;
+    struct timespec begin = {}, end = {};
+    clock_gettime(CLOCK_MONOTONIC, &begin);
+    if (((job->result.status = cgbl_load_rom(context, job->path)) == CGBL_SUCCESS) &&
+        ((job->result.status = cgbl_batch_input_load(job->input, &input, &count)) == CGBL_SUCCESS)) {
+        bool buttons[CGBL_BUTTON_MAX] = {};
+        for (uint32_t frame = 0, index = 0; frame < job->frames; ++frame) {
+            for (; (index < count) && (input[index].frame <= frame); ++index) {
+                for (cgbl_button_e button = 0; button < CGBL_BUTTON_MAX; ++button) {
+                    buttons[button] = input[index].state & (1 << button);
+                }
+                cgbl_set_buttons(context, &buttons);
+            }
+            if ((job->result.status = cgbl_run_frames(context, 1)) != CGBL_SUCCESS) {
+                break;
+            }
+        }
+    }
+    if (job->result.status == CGBL_SUCCESS) {
+        const uint8_t *serial = cgbl_get_serial(context, &job->result.length);
+        job->result.cycles = cgbl_get_cycles(context);
+        job->result.hash = cgbl_batch_hash((const uint8_t *)cgbl_get_framebuffer(context), sizeof(*cgbl_get_framebuffer(context)));
+        if (job->result.length && (cgbl_buffer_allocate(&job->result.serial, job->result.length) == CGBL_SUCCESS)) {
+            memcpy(job->result.serial, serial, job->result.length);
+        } else {
+            job->result.length = 0;
+        }
+    } else {
+        snprintf(job->result.error, sizeof(job->result.error), "%s", cgbl_error());
+    }
+    if (input) {
+        cgbl_buffer_free((uint8_t *)input);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    job->result.time = (end.tv_sec - begin.tv_sec) + ((end.tv_nsec - begin.tv_nsec) / 1000000000.0);
+}
+
+static bool cgbl_batch_pop(uint32_t worker, uint32_t *const job) {
+    bool result = false;
+    cgbl_batch_queue_t *queue = &batch.queue[worker];
+    mtx_lock(&queue->lock);
+    if ((result = (queue->head < queue->tail))) {
+        *job = queue->job[--queue->tail];
+    }
+    mtx_unlock(&queue->lock);
+    return result;
+}
+
+static bool cgbl_batch_steal(uint32_t worker, uint32_t *const job) {
+    bool result = false;
+    for (uint32_t offset = 1; !result && (offset < batch.workers); ++offset) {
+        cgbl_batch_queue_t *queue = &batch.queue[(worker + offset) % batch.workers];
+        mtx_lock(&queue->lock);
+        if ((result = (queue->head < queue->tail))) {
+            *job = queue->job[queue->head++];
+        }
+        mtx_unlock(&queue->lock);
+    }
+    return result;
+}
+
+static int cgbl_batch_worker(void *argument) {
+    uint32_t job = 0, worker = (uintptr_t)argument;
+    cgbl_context_t *context = NULL;
+    if (cgbl_create(&context) == CGBL_SUCCESS) {
+        cgbl_set_option(context, batch.option);
+        while (cgbl_batch_pop(worker, &job) || cgbl_batch_steal(worker, &job)) {
+            cgbl_batch_run(context, &batch.job[job]);
+        }
+        cgbl_destroy(context);
+    }
+    return 0;
+}
+
+static char *cgbl_batch_token(char **const line) {
+    char *result = *line + strspn(*line, " \t\r");
+    size_t length = 0;
+    if (*result == '\"') {
+        length = strcspn(++result, "\"");
+        if (!result[length]) {
+            return NULL;
+        }
+        result[length++] = '\0';
+        if (result[length] && !strchr(" \t\r", result[length])) {
+            return NULL;
+        }
+        *line = result + length;
+        return result;
+    }
+    length = strcspn(result, " \t\r");
+    if (*(*line = result + length)) {
+        *(*line)++ = '\0';
+    }
+    return length ? result : NULL;
+}
+
+static cgbl_error_e cgbl_batch_manifest_load(const char *const path) {
+    uint8_t *buffer = NULL;
+    uint32_t length = 0, line = 0;
+    cgbl_error_e result = CGBL_SUCCESS;
+    if ((result = cgbl_file_read(path, &buffer, &length)) != CGBL_SUCCESS) {
+        return result;
+    }
+    if ((result = cgbl_buffer_allocate((uint8_t **)&batch.manifest, length + 1)) == CGBL_SUCCESS) {
+        memcpy(batch.manifest, buffer, length);
+    }
+    cgbl_buffer_free(buffer);
+    if ((result != CGBL_SUCCESS) ||
+        ((result = cgbl_buffer_allocate((uint8_t **)&batch.job, ((length / 2) + 1) * sizeof(*batch.job))) != CGBL_SUCCESS)) {
+        return result;
+    }
+    for (char *entry = batch.manifest, *next = NULL; entry; entry = next) {
+        char *frames = NULL, *remaining = NULL;
+        cgbl_batch_job_t *job = &batch.job[batch.count];
+        if ((next = strchr(entry, '\n'))) {
+            *next++ = '\0';
+        }
+        ++line;
+        entry += strspn(entry, " \t\r");
+        if (!*entry || (*entry == '#')) {
+            continue;
+        }
+        if (!(job->path = cgbl_batch_token(&entry)) || !(frames = cgbl_batch_token(&entry)) ||
+            !(job->frames = strtoul(frames, &remaining, 10)) || *remaining ||
+            (!(job->input = cgbl_batch_token(&entry)) && entry[strspn(entry, " \t\r")])) {
+            return CGBL_ERROR("Malformed manifest: \'%s\' (line %u)", path, line);
+        }
+        job->result.status = CGBL_FAILURE;
+        snprintf(job->result.error, sizeof(job->result.error), "Job not run");
+        ++batch.count;
+    }
+    if (!batch.count) {
+        return CGBL_ERROR("Empty manifest: \'%s\'", path);
+    }
+    return CGBL_SUCCESS;
+}
+
+static void cgbl_batch_manifest_unload(void) {
+    if (batch.job) {
+        for (uint32_t index = 0; index < batch.count; ++index) {
+            if (batch.job[index].result.serial) {
+                cgbl_buffer_free(batch.job[index].result.serial);
+            }
+        }
+        cgbl_buffer_free((uint8_t *)batch.job);
+    }
+    if (batch.manifest) {
+        cgbl_buffer_free((uint8_t *)batch.manifest);
+    }
+}
+
+static uint8_t cgbl_batch_print_length(const uint8_t *const data, uint32_t length) {
+    uint8_t result = (data[0] >= 0xF0) ? 4 : (data[0] >= 0xE0) ? 3 : 2;
+    uint32_t code = data[0] & (0x7F >> result);
+    if ((data[0] < 0xC2) || (data[0] > 0xF4) || (result > length)) {
+        return 0;
+    }
+    for (uint8_t index = 1; index < result; ++index) {
+        if ((data[index] & 0xC0) != 0x80) {
+            return 0;
+        }
+        code = (code << 6) | (data[index] & 0x3F);
+    }
+    if ((code < ((result == 4) ? 0x10000 : 0x800) && (result > 2)) || ((code >= 0xD800) && (code <= 0xDFFF)) || (code > 0x10FFFF)) {
+        return 0;
+    }
+    return result;
+}
+
+static void cgbl_batch_print_string(const char *const name, const uint8_t *const data, uint32_t length) {
+    uint8_t count = 0;
+    fprintf(stdout, ",\"%s\":\"", name);
+    for (uint32_t index = 0; index < length; ++index) {
+        switch (data[index]) {
+        case '\"':
+        case '\\':
+            fprintf(stdout, "\\%c", data[index]);
+            break;
+        case '\n':
+            fprintf(stdout, "\\n");
+            break;
+        case 0x00 ... 0x09:
+        case 0x0B ... 0x1F:
+        case 0x7F:
+            fprintf(stdout, "\\u%04x", data[index]);
+            break;
+        case 0x80 ... 0xFF:
+            if ((count = cgbl_batch_print_length(&data[index], length - index))) {
+                fwrite(&data[index], 1, count, stdout);
+                index += count - 1;
+            } else {
+                fprintf(stdout, "\\u%04x", data[index]);
+            }
+            break;
+        default:
+            fputc(data[index], stdout);
+            break;
+        }
+    }
+    fputc('\"', stdout);
+}
+
+static uint32_t cgbl_batch_print(void) {
+    uint32_t result = 0;
+    for (uint32_t index = 0; index < batch.count; ++index) {
+        const cgbl_batch_job_t *job = &batch.job[index];
+        fprintf(stdout, "{\"index\":%u", index);
+        cgbl_batch_print_string("path", (const uint8_t *)job->path, strlen(job->path));
+        if (job->result.status == CGBL_SUCCESS) {
+            fprintf(stdout, ",\"status\":\"success\",\"frames\":%u,\"hash\":\"%016llx\",\"cycles\":%llu,\"time\":%.6f", job->frames,
+                    (unsigned long long)job->result.hash, (unsigned long long)job->result.cycles, job->result.time);
+            cgbl_batch_print_string("serial", job->result.serial, job->result.length);
+        } else {
+            fprintf(stdout, ",\"status\":\"failure\",\"time\":%.6f", job->result.time);
+            cgbl_batch_print_string("error", (const uint8_t *)job->result.error, strlen(job->result.error));
+            ++result;
+        }
+        fprintf(stdout, "}\n");
+    }
+    return result;
+}
+
+static cgbl_error_e cgbl_batch_queue_create(void) {
+    cgbl_error_e result = CGBL_SUCCESS;
+    long processors = sysconf(_SC_NPROCESSORS_ONLN);
+    batch.workers = ((processors > 0) && ((uint32_t)processors < batch.count)) ? processors : batch.count;
+    if ((result = cgbl_buffer_allocate((uint8_t **)&batch.queue, batch.workers * sizeof(*batch.queue))) != CGBL_SUCCESS) {
+        return result;
+    }
+    for (uint32_t worker = 0; worker < batch.workers; ++worker) {
+        cgbl_batch_queue_t *queue = &batch.queue[worker];
+        if ((result = cgbl_buffer_allocate((uint8_t **)&queue->job, ((batch.count / batch.workers) + 1) * sizeof(*queue->job))) !=
+            CGBL_SUCCESS) {
+            return result;
+        }
+        if (mtx_init(&queue->lock, mtx_plain) != thrd_success) {
+            return CGBL_ERROR("Failed to create lock: %u", worker);
+        }
+    }
+    for (uint32_t job = 0; job < batch.count; ++job) {
+        cgbl_batch_queue_t *queue = &batch.queue[job % batch.workers];
+        queue->job[queue->tail++] = job;
+    }
+    return CGBL_SUCCESS;
+}
+
+static void cgbl_batch_queue_destroy(void) {
+    if (batch.queue) {
+        for (uint32_t worker = 0; worker < batch.workers; ++worker) {
+            if (batch.queue[worker].job) {
+                mtx_destroy(&batch.queue[worker].lock);
+                cgbl_buffer_free((uint8_t *)batch.queue[worker].job);
+            }
+        }
+        cgbl_buffer_free((uint8_t *)batch.queue);
+    }
+}
+
+static cgbl_error_e cgbl_batch_queue_run(void) {
+    uint32_t count = 0;
+    cgbl_error_e result = CGBL_SUCCESS;
+    for (; count < batch.workers; ++count) {
+        if (thrd_create(&batch.queue[count].thread, cgbl_batch_worker, (void *)(uintptr_t)count) != thrd_success) {
+            result = CGBL_ERROR("Failed to create thread: %u", count);
+            break;
+        }
+    }
+    if (!count) {
+        return result;
+    }
+    for (uint32_t worker = 0; worker < count; ++worker) {
+        thrd_join(batch.queue[worker].thread, NULL);
+    }
+    if ((count = cgbl_batch_print())) {
+        result = CGBL_ERROR("Batch failed: %u of %u jobs", count, batch.count);
+    }
+    return result;
+}
+
+cgbl_error_e cgbl_batch_entry(const char *const path, const cgbl_option_t *const option) {
+    cgbl_error_e result = CGBL_SUCCESS;
+    memset(&batch, 0, sizeof(batch));
+    batch.option = option;
+    if (!path) {
+        return CGBL_ERROR("Missing batch manifest");
+    }
+    if (((result = cgbl_batch_manifest_load(path)) == CGBL_SUCCESS) && ((result = cgbl_batch_queue_create()) == CGBL_SUCCESS)) {
+        result = cgbl_batch_queue_run();
+    }
+    cgbl_batch_queue_destroy();
+    cgbl_batch_manifest_unload();
+    return result;
+}
@@ -0,0 +1,13 @@
+/*
+ * SPDX-FileCopyrightText: 2025 David Jolly <jolly.a.david@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef CGBL_BATCH_H_
+#define CGBL_BATCH_H_
+
+#include "common.h"
+
+cgbl_error_e cgbl_batch_entry(const char *const path, const cgbl_option_t *const option);
+
+#endif /* CGBL_BATCH_H_ */
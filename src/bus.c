@@ -6,6 +6,7 @@
 #include "audio.h"
 #include "bootloader.h"
 #include "cartridge.h"
+#include "context.h"
 #include "infrared.h"
 #include "input.h"
 #include "processor.h"
@@ -14,315 +15,464 @@
 #include "video.h"
 #include <string.h>
 
-static struct {
-    union {
-        uint8_t raw;
-        struct {
-            uint8_t : 2;
-            uint8_t dmg : 1;
-        };
-    } mode;
-    union {
-        uint8_t raw;
-        struct {
-            uint8_t dmg : 1;
-        };
-    } priority;
-    union {
-        uint8_t raw;
-        struct {
-            uint8_t armed : 1;
-            uint8_t : 6;
-            uint8_t doubled : 1;
-        };
-    } speed;
-} bus = {};
+static void cgbl_bus_sync_all(cgbl_context_t *const context) {
+    for (cgbl_event_e event = 0; event < CGBL_EVENT_PROCESSOR; ++event) {
+        cgbl_bus_sync(context, event);
+    }
+}
+
+static uint8_t cgbl_bus_io_read(cgbl_context_t *const context, uint16_t address) {
+    uint8_t result = 0xFF;
+    if (cgbl_bus_mode(context) == CGBL_MODE_CGB) {
+        switch (address) {
+        case CGBL_BUS_MODE:
+            result = context->bus.mode.raw;
+            break;
+        case CGBL_BUS_PRIORITY:
+            result = context->bus.priority.raw;
+            break;
+        case CGBL_BUS_SPEED:
+            result = context->bus.speed.raw;
+            break;
+        default:
+            break;
+        }
+    }
+    return result;
+}
+
+static void cgbl_bus_io_write(cgbl_context_t *const context, uint16_t address, uint8_t data) {
+    if (cgbl_bus_mode(context) == CGBL_MODE_CGB) {
+        switch (address) {
+        case CGBL_BUS_MODE:
+            if (cgbl_bootloader_enabled(context)) {
+                cgbl_bus_sync_all(context);
+                context->bus.mode.dmg = (data & 4) >> 2;
+                cgbl_memory_map(context);
+                cgbl_video_map(context);
+                cgbl_bus_sync_all(context);
+            }
+            break;
+        case CGBL_BUS_PRIORITY:
+            context->bus.priority.dmg = data & 1;
+            break;
+        case CGBL_BUS_SPEED:
+            context->bus.speed.armed = data & 1;
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+static const struct {
+    uint8_t (*read)(cgbl_context_t *const context, uint16_t address);
+    void (*write)(cgbl_context_t *const context, uint16_t address, uint8_t data);
+    cgbl_event_e event;
+    uint8_t mask;
+} IO[CGBL_BUS_IO_WIDTH] = {
+    [CGBL_AUDIO_CHANNEL_1_ENVELOPE - CGBL_BUS_IO_BEGIN] = { cgbl_audio_read, cgbl_audio_write, CGBL_EVENT_AUDIO, 0x00 },
+    [CGBL_AUDIO_CHANNEL_1_FREQUENCY_HIGH - CGBL_BUS_IO_BEGIN] = { cgbl_audio_read, cgbl_audio_write, CGBL_EVENT_AUDIO, 0x00 },
+    [CGBL_AUDIO_CHANNEL_1_FREQUENCY_LOW - CGBL_BUS_IO_BEGIN] = { cgbl_audio_read, cgbl_audio_write, CGBL_EVENT_AUDIO, 0x00 },
+    [CGBL_AUDIO_CHANNEL_1_LENGTH - CGBL_BUS_IO_BEGIN] = { cgbl_audio_read, cgbl_audio_write, CGBL_EVENT_AUDIO, 0x00 },
+    [CGBL_AUDIO_CHANNEL_1_SWEEP - CGBL_BUS_IO_BEGIN] = { cgbl_audio_read, cgbl_audio_write, CGBL_EVENT_AUDIO, 0x00 },
+    [CGBL_AUDIO_CHANNEL_2_ENVELOPE - CGBL_BUS_IO_BEGIN] = { cgbl_audio_read, cgbl_audio_write, CGBL_EVENT_AUDIO, 0x00 },
+    [CGBL_AUDIO_CHANNEL_2_FREQUENCY_HIGH - CGBL_BUS_IO_BEGIN] = { cgbl_audio_read, cgbl_audio_write, CGBL_EVENT_AUDIO, 0x00 },
+    [CGBL_AUDIO_CHANNEL_2_FREQUENCY_LOW - CGBL_BUS_IO_BEGIN] = { cgbl_audio_read, cgbl_audio_write, CGBL_EVENT_AUDIO, 0x00 },
+    [CGBL_AUDIO_CHANNEL_2_LENGTH - CGBL_BUS_IO_BEGIN] = { cgbl_audio_read, cgbl_audio_write, CGBL_EVENT_AUDIO, 0x00 },
+    [CGBL_AUDIO_CHANNEL_3_CONTROL - CGBL_BUS_IO_BEGIN] = { cgbl_audio_read, cgbl_audio_write, CGBL_EVENT_AUDIO, 0x00 },
+    [CGBL_AUDIO_CHANNEL_3_FREQUENCY_HIGH - CGBL_BUS_IO_BEGIN] = { cgbl_audio_read, cgbl_audio_write, CGBL_EVENT_AUDIO, 0x00 },
+    [CGBL_AUDIO_CHANNEL_3_FREQUENCY_LOW - CGBL_BUS_IO_BEGIN] = { cgbl_audio_read, cgbl_audio_write, CGBL_EVENT_AUDIO, 0x00 },
+    [CGBL_AUDIO_CHANNEL_3_LENGTH - CGBL_BUS_IO_BEGIN] = { cgbl_audio_read, cgbl_audio_write, CGBL_EVENT_AUDIO, 0x00 },
+    [CGBL_AUDIO_CHANNEL_3_LEVEL - CGBL_BUS_IO_BEGIN] = { cgbl_audio_read, cgbl_audio_write, CGBL_EVENT_AUDIO, 0x00 },
+    [CGBL_AUDIO_CHANNEL_4_CONTROL - CGBL_BUS_IO_BEGIN] = { cgbl_audio_read, cgbl_audio_write, CGBL_EVENT_AUDIO, 0x00 },
+    [CGBL_AUDIO_CHANNEL_4_ENVELOPE - CGBL_BUS_IO_BEGIN] = { cgbl_audio_read, cgbl_audio_write, CGBL_EVENT_AUDIO, 0x00 },
+    [CGBL_AUDIO_CHANNEL_4_FREQUENCY - CGBL_BUS_IO_BEGIN] = { cgbl_audio_read, cgbl_audio_write, CGBL_EVENT_AUDIO, 0x00 },
+    [CGBL_AUDIO_CHANNEL_4_LENGTH - CGBL_BUS_IO_BEGIN] = { cgbl_audio_read, cgbl_audio_write, CGBL_EVENT_AUDIO, 0x00 },
+    [CGBL_AUDIO_CONTROL - CGBL_BUS_IO_BEGIN] = { cgbl_audio_read, cgbl_audio_write, CGBL_EVENT_AUDIO, 0x00 },
+    [CGBL_AUDIO_MIXER - CGBL_BUS_IO_BEGIN] = { cgbl_audio_read, cgbl_audio_write, CGBL_EVENT_AUDIO, 0x00 },
+    [CGBL_AUDIO_RAM_BEGIN - CGBL_BUS_IO_BEGIN ... CGBL_AUDIO_RAM_END - CGBL_BUS_IO_BEGIN] = { cgbl_audio_read, cgbl_audio_write,
+                                                                                              CGBL_EVENT_AUDIO, 0x00 },
+    [CGBL_AUDIO_VOLUME - CGBL_BUS_IO_BEGIN] = { cgbl_audio_read, cgbl_audio_write, CGBL_EVENT_AUDIO, 0x00 },
+    [CGBL_BOOTLOADER_DISABLE - CGBL_BUS_IO_BEGIN] = { NULL, cgbl_memory_write, CGBL_EVENT_PROCESSOR, 0x00 },
+    [CGBL_BUS_MODE - CGBL_BUS_IO_BEGIN] = { cgbl_bus_io_read, cgbl_bus_io_write, CGBL_EVENT_PROCESSOR, 0xFB },
+    [CGBL_BUS_PRIORITY - CGBL_BUS_IO_BEGIN] = { cgbl_bus_io_read, cgbl_bus_io_write, CGBL_EVENT_PROCESSOR, 0xFE },
+    [CGBL_BUS_SPEED - CGBL_BUS_IO_BEGIN] = { cgbl_bus_io_read, cgbl_bus_io_write, CGBL_EVENT_PROCESSOR, 0x7E },
+    [CGBL_INFRARED_CONTROL - CGBL_BUS_IO_BEGIN] = { cgbl_infrared_read, cgbl_infrared_write, CGBL_EVENT_INFRARED, 0x3E },
+    [CGBL_INPUT_STATE - CGBL_BUS_IO_BEGIN] = { cgbl_input_read, cgbl_input_write, CGBL_EVENT_INPUT, 0xC0 },
+    [CGBL_MEMORY_RAM_WORK_SELECT - CGBL_BUS_IO_BEGIN] = { cgbl_memory_read, cgbl_memory_write, CGBL_EVENT_PROCESSOR, 0xF8 },
+    [CGBL_PROCESSOR_INTERRUPT_FLAG - CGBL_BUS_IO_BEGIN] = { cgbl_processor_read, cgbl_processor_write, CGBL_EVENT_PROCESSOR, 0xE0 },
+    [CGBL_SERIAL_CONTROL - CGBL_BUS_IO_BEGIN] = { cgbl_serial_read, cgbl_serial_write, CGBL_EVENT_SERIAL, 0x7C },
+    [CGBL_SERIAL_DATA - CGBL_BUS_IO_BEGIN] = { cgbl_serial_read, cgbl_serial_write, CGBL_EVENT_SERIAL, 0x00 },
+    [CGBL_TIMER_CONTROL - CGBL_BUS_IO_BEGIN] = { cgbl_timer_read, cgbl_timer_write, CGBL_EVENT_TIMER, 0xF8 },
+    [CGBL_TIMER_COUNTER - CGBL_BUS_IO_BEGIN] = { cgbl_timer_read, cgbl_timer_write, CGBL_EVENT_TIMER, 0x00 },
+    [CGBL_TIMER_DIVIDER - CGBL_BUS_IO_BEGIN] = { cgbl_timer_read, cgbl_timer_write, CGBL_EVENT_TIMER, 0x00 },
+    [CGBL_TIMER_MODULO - CGBL_BUS_IO_BEGIN] = { cgbl_timer_read, cgbl_timer_write, CGBL_EVENT_TIMER, 0x00 },
+    [CGBL_VIDEO_CONTROL - CGBL_BUS_IO_BEGIN] = { cgbl_video_read, cgbl_video_write, CGBL_EVENT_VIDEO, 0x00 },
+    [CGBL_VIDEO_LINE_Y - CGBL_BUS_IO_BEGIN] = { cgbl_video_read, cgbl_video_write, CGBL_EVENT_VIDEO, 0x00 },
+    [CGBL_VIDEO_LINE_Y_COINCIDENCE - CGBL_BUS_IO_BEGIN] = { cgbl_video_read, cgbl_video_write, CGBL_EVENT_VIDEO, 0x00 },
+    [CGBL_VIDEO_PALETTE_BACKGROUND - CGBL_BUS_IO_BEGIN] = { cgbl_video_read, cgbl_video_write, CGBL_EVENT_VIDEO, 0x00 },
+    [CGBL_VIDEO_PALETTE_BACKGROUND_CONTROL - CGBL_BUS_IO_BEGIN] = { cgbl_video_read, cgbl_video_write, CGBL_EVENT_VIDEO, 0x00 },
+    [CGBL_VIDEO_PALETTE_BACKGROUND_DATA - CGBL_BUS_IO_BEGIN] = { cgbl_video_read, cgbl_video_write, CGBL_EVENT_VIDEO, 0x00 },
+    [CGBL_VIDEO_PALETTE_OBJECT_0 - CGBL_BUS_IO_BEGIN] = { cgbl_video_read, cgbl_video_write, CGBL_EVENT_VIDEO, 0x00 },
+    [CGBL_VIDEO_PALETTE_OBJECT_1 - CGBL_BUS_IO_BEGIN] = { cgbl_video_read, cgbl_video_write, CGBL_EVENT_VIDEO, 0x00 },
+    [CGBL_VIDEO_PALETTE_OBJECT_CONTROL - CGBL_BUS_IO_BEGIN] = { cgbl_video_read, cgbl_video_write, CGBL_EVENT_VIDEO, 0x00 },
+    [CGBL_VIDEO_PALETTE_OBJECT_DATA - CGBL_BUS_IO_BEGIN] = { cgbl_video_read, cgbl_video_write, CGBL_EVENT_VIDEO, 0x00 },
+    [CGBL_VIDEO_RAM_SELECT - CGBL_BUS_IO_BEGIN] = { cgbl_video_read, cgbl_video_write, CGBL_EVENT_VIDEO, 0xFE },
+    [CGBL_VIDEO_SCROLL_X - CGBL_BUS_IO_BEGIN] = { cgbl_video_read, cgbl_video_write, CGBL_EVENT_VIDEO, 0x00 },
+    [CGBL_VIDEO_SCROLL_Y - CGBL_BUS_IO_BEGIN] = { cgbl_video_read, cgbl_video_write, CGBL_EVENT_VIDEO, 0x00 },
+    [CGBL_VIDEO_STATUS - CGBL_BUS_IO_BEGIN] = { cgbl_video_read, cgbl_video_write, CGBL_EVENT_VIDEO, 0x80 },
+    [CGBL_VIDEO_TRANSFER_CONTROL - CGBL_BUS_IO_BEGIN] = { cgbl_video_read, cgbl_video_write, CGBL_EVENT_VIDEO, 0x00 },
+    [CGBL_VIDEO_TRANSFER_DESTINATION_HIGH - CGBL_BUS_IO_BEGIN] = { cgbl_video_read, cgbl_video_write, CGBL_EVENT_VIDEO, 0x00 },
+    [CGBL_VIDEO_TRANSFER_DESTINATION_LOW - CGBL_BUS_IO_BEGIN] = { cgbl_video_read, cgbl_video_write, CGBL_EVENT_VIDEO, 0x00 },
+    [CGBL_VIDEO_TRANSFER_OBJECTS - CGBL_BUS_IO_BEGIN] = { cgbl_video_read, cgbl_video_write, CGBL_EVENT_VIDEO, 0x00 },
+    [CGBL_VIDEO_TRANSFER_SOURCE_HIGH - CGBL_BUS_IO_BEGIN] = { cgbl_video_read, cgbl_video_write, CGBL_EVENT_VIDEO, 0x00 },
+    [CGBL_VIDEO_TRANSFER_SOURCE_LOW - CGBL_BUS_IO_BEGIN] = { cgbl_video_read, cgbl_video_write, CGBL_EVENT_VIDEO, 0x00 },
+    [CGBL_VIDEO_WINDOW_X - CGBL_BUS_IO_BEGIN] = { cgbl_video_read, cgbl_video_write, CGBL_EVENT_VIDEO, 0x00 },
+    [CGBL_VIDEO_WINDOW_Y - CGBL_BUS_IO_BEGIN] = { cgbl_video_read, cgbl_video_write, CGBL_EVENT_VIDEO, 0x00 },
+};
+
+static cgbl_error_e cgbl_bus_event(cgbl_context_t *const context) {
+    cgbl_error_e result = context->bus.status, status = CGBL_SUCCESS;
+    context->bus.deadline = UINT64_MAX;
+    context->bus.status = CGBL_SUCCESS;
+    for (cgbl_event_e event = 0; event < CGBL_EVENT_PROCESSOR; ++event) {
+        if (context->bus.event[event].deadline < context->bus.cycle) {
+            context->bus.current = event;
+            context->bus.watch.invalid = true;
+            if ((status = cgbl_bus_sync(context, event)) != CGBL_SUCCESS) {
+                result = status;
+            }
+        }
+        if (context->bus.event[event].deadline < context->bus.deadline) {
+            context->bus.deadline = context->bus.event[event].deadline;
+        }
+    }
+    context->bus.current = CGBL_EVENT_PROCESSOR;
+    return result;
+}
 
-cgbl_mode_e cgbl_bus_mode(void) {
-    return bus.mode.dmg ? CGBL_MODE_DMG : CGBL_MODE_CGB;
+static cgbl_error_e cgbl_bus_processor(cgbl_context_t *const context, uint64_t cycle) {
+    cgbl_error_e result = CGBL_SUCCESS;
+    uint32_t cycles = (cycle - context->bus.cycle) + 1;
+    context->bus.cycle = cycle;
+    context->bus.event[CGBL_EVENT_PROCESSOR].cycle = cycle + 1;
+    result = cgbl_processor_step(context, cycles);
+    ++context->bus.cycle;
+    return result;
+}
+
+static void cgbl_bus_skip(cgbl_context_t *const context) {
+    uint64_t cycle = context->bus.event[CGBL_EVENT_PROCESSOR].deadline;
+    if (cycle > context->bus.deadline) {
+        cycle = context->bus.deadline;
+    }
+    if (cycle > context->bus.cycle) {
+        context->bus.event[CGBL_EVENT_PROCESSOR].cycle = cycle;
+        cgbl_processor_step(context, cycle - context->bus.cycle);
+        context->bus.cycle = cycle;
+    }
 }
 
-cgbl_priority_e cgbl_bus_priority(void) {
-    return bus.priority.dmg ? CGBL_PRIORITY_DMG : CGBL_PRIORITY_CGB;
+bool cgbl_bus_advance(cgbl_context_t *const context, uint32_t cycles) {
+    uint64_t cycle = context->bus.event[CGBL_EVENT_PROCESSOR].cycle + cycles;
+    if ((cycle > context->bus.deadline) || (context->bus.status != CGBL_SUCCESS)) {
+        return false;
+    }
+    context->bus.cycle = cycle;
+    context->bus.event[CGBL_EVENT_PROCESSOR].cycle = cycle + 1;
+    return true;
 }
 
-uint8_t cgbl_bus_read(uint16_t address) {
+uint16_t cgbl_bus_bank(cgbl_context_t *const context, uint16_t address) {
+    return context->bus.page.bank[address >> 8];
+}
+
+void cgbl_bus_clock(cgbl_context_t *const context, uint8_t cycles) {
+    cgbl_error_e status = CGBL_SUCCESS;
+    context->bus.cycle += cycles;
+    context->bus.event[CGBL_EVENT_PROCESSOR].cycle = context->bus.cycle + 1;
+    if ((context->bus.cycle > context->bus.deadline) && ((status = cgbl_bus_event(context)) != CGBL_SUCCESS)) {
+        context->bus.status = status;
+    }
+}
+
+uint64_t cgbl_bus_cycle(cgbl_context_t *const context) {
+    return context->bus.cycle;
+}
+
+uint32_t cgbl_bus_edge(uint16_t divider, uint16_t mask) {
+    uint32_t period = mask << 1, result = (mask - divider) & (period - 1);
+    return result ? result : period;
+}
+
+uint32_t cgbl_bus_generation(cgbl_context_t *const context, uint16_t address) {
+    return context->bus.page.generation[address >> 8];
+}
+
+void cgbl_bus_invalidate(cgbl_context_t *const context, uint16_t address) {
+    ++context->bus.page.generation[address >> 8];
+}
+
+void cgbl_bus_map(cgbl_context_t *const context, uint16_t begin, uint16_t end, const uint8_t *read, uint8_t *write) {
+    const uint8_t *rom = cgbl_cartridge_rom_bank(context, 0);
+    uint32_t length = cgbl_cartridge_rom_count(context) * CGBL_CARTRIDGE_ROM_WIDTH;
+    for (uint16_t page = begin >> 8; page <= (end >> 8); ++page) {
+        const uint8_t *data = read ? read + ((page << 8) - begin) : NULL;
+        if (context->bus.page.read[page] != data) {
+            ++context->bus.page.generation[page];
+        }
+        context->bus.page.bank[page] =
+            (data && (data >= rom) && (data < (rom + length))) ? (data - rom) / CGBL_CARTRIDGE_ROM_WIDTH : CGBL_BUS_BANK_NONE;
+        context->bus.page.read[page] = data;
+        context->bus.page.write[page] = write ? write + ((page << 8) - begin) : NULL;
+    }
+}
+
+cgbl_mode_e cgbl_bus_mode(cgbl_context_t *const context) {
+    return context->bus.mode.dmg ? CGBL_MODE_DMG : CGBL_MODE_CGB;
+}
+
+const uint8_t *cgbl_bus_page(cgbl_context_t *const context, uint16_t address) {
+    return context->bus.page.read[address >> 8] ? context->bus.page.read[address >> 8] + (address & 0xFF) : NULL;
+}
+
+cgbl_priority_e cgbl_bus_priority(cgbl_context_t *const context) {
+    return context->bus.priority.dmg ? CGBL_PRIORITY_DMG : CGBL_PRIORITY_CGB;
+}
+
+uint8_t cgbl_bus_read(cgbl_context_t *const context, uint16_t address) {
     uint8_t result = 0xFF;
+    if (context->bus.page.read[address >> 8]) {
+        return context->bus.page.read[address >> 8][address & 0xFF];
+    }
     switch (address) {
-    case CGBL_AUDIO_CHANNEL_1_ENVELOPE:
-    case CGBL_AUDIO_CHANNEL_1_FREQUENCY_HIGH:
-    case CGBL_AUDIO_CHANNEL_1_FREQUENCY_LOW:
-    case CGBL_AUDIO_CHANNEL_1_LENGTH:
-    case CGBL_AUDIO_CHANNEL_1_SWEEP:
-    case CGBL_AUDIO_CHANNEL_2_ENVELOPE:
-    case CGBL_AUDIO_CHANNEL_2_FREQUENCY_HIGH:
-    case CGBL_AUDIO_CHANNEL_2_FREQUENCY_LOW:
-    case CGBL_AUDIO_CHANNEL_2_LENGTH:
-    case CGBL_AUDIO_CHANNEL_3_CONTROL:
-    case CGBL_AUDIO_CHANNEL_3_FREQUENCY_HIGH:
-    case CGBL_AUDIO_CHANNEL_3_FREQUENCY_LOW:
-    case CGBL_AUDIO_CHANNEL_3_LENGTH:
-    case CGBL_AUDIO_CHANNEL_3_LEVEL:
-    case CGBL_AUDIO_CHANNEL_4_CONTROL:
-    case CGBL_AUDIO_CHANNEL_4_ENVELOPE:
-    case CGBL_AUDIO_CHANNEL_4_FREQUENCY:
-    case CGBL_AUDIO_CHANNEL_4_LENGTH:
-    case CGBL_AUDIO_CONTROL:
-    case CGBL_AUDIO_MIXER:
-    case CGBL_AUDIO_RAM_BEGIN ... CGBL_AUDIO_RAM_END:
-    case CGBL_AUDIO_VOLUME:
-        result = cgbl_audio_read(address);
-        break;
-    case CGBL_BUS_MODE:
-        if (cgbl_bus_mode() == CGBL_MODE_CGB) {
-            result = bus.mode.raw;
-        }
-        break;
-    case CGBL_BUS_PRIORITY:
-        if (cgbl_bus_mode() == CGBL_MODE_CGB) {
-            result = bus.priority.raw;
+    case CGBL_BUS_IO_BEGIN ... CGBL_BUS_IO_END:
+        if (IO[address - CGBL_BUS_IO_BEGIN].read) {
+            cgbl_bus_sync(context, IO[address - CGBL_BUS_IO_BEGIN].event);
+            result = IO[address - CGBL_BUS_IO_BEGIN].read(context, address) | IO[address - CGBL_BUS_IO_BEGIN].mask;
         }
-        break;
-    case CGBL_BUS_SPEED:
-        if (cgbl_bus_mode() == CGBL_MODE_CGB) {
-            result = bus.speed.raw;
+        switch (address) {
+        case CGBL_PROCESSOR_INTERRUPT_FLAG:
+        case CGBL_VIDEO_LINE_Y:
+        case CGBL_VIDEO_STATUS:
+            break;
+        case CGBL_TIMER_DIVIDER:
+            if (context->bus.watch.divider && (context->bus.watch.data != result)) {
+                context->bus.watch.invalid = true;
+            }
+            context->bus.watch.divider = true;
+            context->bus.watch.data = result;
+            break;
+        default:
+            context->bus.watch.invalid = true;
+            break;
         }
         break;
-    case CGBL_INFRARED_CONTROL:
-        result = cgbl_infrared_read(address);
-        break;
-    case CGBL_INPUT_STATE:
-        result = cgbl_input_read(address);
-        break;
     case CGBL_PROCESSOR_INTERRUPT_ENABLE:
-    case CGBL_PROCESSOR_INTERRUPT_FLAG:
-        result = cgbl_processor_read(address);
+        result = cgbl_processor_read(context, address);
         break;
-    case CGBL_SERIAL_CONTROL:
-    case CGBL_SERIAL_DATA:
-        result = cgbl_serial_read(address);
-        break;
-    case CGBL_TIMER_CONTROL:
-    case CGBL_TIMER_COUNTER:
-    case CGBL_TIMER_DIVIDER:
-    case CGBL_TIMER_MODULO:
-        result = cgbl_timer_read(address);
-        break;
-    case CGBL_VIDEO_CONTROL:
-    case CGBL_VIDEO_LINE_Y:
-    case CGBL_VIDEO_LINE_Y_COINCIDENCE:
-    case CGBL_VIDEO_PALETTE_BACKGROUND:
-    case CGBL_VIDEO_PALETTE_BACKGROUND_CONTROL:
-    case CGBL_VIDEO_PALETTE_BACKGROUND_DATA:
-    case CGBL_VIDEO_PALETTE_OBJECT_0:
-    case CGBL_VIDEO_PALETTE_OBJECT_1:
-    case CGBL_VIDEO_PALETTE_OBJECT_CONTROL:
-    case CGBL_VIDEO_PALETTE_OBJECT_DATA:
     case CGBL_VIDEO_RAM_BEGIN ... CGBL_VIDEO_RAM_END:
+        result = cgbl_video_read(context, address);
+        break;
     case CGBL_VIDEO_RAM_OBJECT_BEGIN ... CGBL_VIDEO_RAM_OBJECT_END:
-    case CGBL_VIDEO_RAM_SELECT:
-    case CGBL_VIDEO_SCROLL_X:
-    case CGBL_VIDEO_SCROLL_Y:
-    case CGBL_VIDEO_STATUS:
-    case CGBL_VIDEO_TRANSFER_CONTROL:
-    case CGBL_VIDEO_TRANSFER_DESTINATION_HIGH:
-    case CGBL_VIDEO_TRANSFER_DESTINATION_LOW:
-    case CGBL_VIDEO_TRANSFER_OBJECTS:
-    case CGBL_VIDEO_TRANSFER_SOURCE_HIGH:
-    case CGBL_VIDEO_TRANSFER_SOURCE_LOW:
-    case CGBL_VIDEO_WINDOW_X:
-    case CGBL_VIDEO_WINDOW_Y:
-        result = cgbl_video_read(address);
+        cgbl_bus_sync(context, CGBL_EVENT_VIDEO);
+        result = cgbl_video_read(context, address);
         break;
     default:
-        result = cgbl_memory_read(address);
+        result = cgbl_memory_read(context, address);
         break;
     }
     return result;
 }
 
-cgbl_error_e cgbl_bus_reset(const cgbl_bank_t *const rom, cgbl_bank_t *const ram) {
+cgbl_error_e cgbl_bus_reset(cgbl_context_t *const context, const cgbl_bank_t *const rom, cgbl_bank_t *const ram) {
     cgbl_error_e result = CGBL_SUCCESS;
-    memset(&bus, 0, sizeof(bus));
-    bus.mode.raw = 0xFB;
-    bus.priority.raw = 0xFE;
-    bus.speed.raw = 0x7E;
-    if ((result = cgbl_memory_reset(rom, ram)) == CGBL_SUCCESS) {
-        cgbl_audio_reset();
-        cgbl_infrared_reset();
-        cgbl_input_reset();
-        cgbl_processor_reset();
-        cgbl_serial_reset();
-        cgbl_timer_reset();
-        cgbl_video_reset();
+    memset(&context->bus, 0, sizeof(context->bus));
+    context->bus.current = CGBL_EVENT_PROCESSOR;
+    context->bus.mode.raw = 0xFB;
+    context->bus.priority.raw = 0xFE;
+    context->bus.speed.raw = 0x7E;
+    if ((result = cgbl_memory_reset(context, rom, ram)) == CGBL_SUCCESS) {
+        cgbl_audio_reset(context);
+        cgbl_infrared_reset(context);
+        cgbl_input_reset(context);
+        cgbl_processor_reset(context);
+        cgbl_serial_reset(context);
+        cgbl_timer_reset(context);
+        cgbl_video_reset(context);
     }
     return result;
 }
 
-cgbl_error_e cgbl_bus_run(void) {
+cgbl_error_e cgbl_bus_run(cgbl_context_t *const context) {
     cgbl_error_e result = CGBL_SUCCESS;
-    for (;;) {
-        if ((result = cgbl_processor_step()) != CGBL_SUCCESS) {
-            break;
-        }
-        cgbl_audio_step();
-        cgbl_cartridge_step();
-        cgbl_infrared_step();
-        cgbl_input_step();
-        cgbl_serial_step();
-        cgbl_timer_step();
-        if ((result = cgbl_video_step()) != CGBL_SUCCESS) {
-            break;
+    cgbl_bus_sync_all(context);
+    do {
+        while ((context->bus.cycle <= context->bus.deadline) && (context->bus.status == CGBL_SUCCESS)) {
+            uint64_t cycle = context->bus.event[CGBL_EVENT_PROCESSOR].deadline;
+            if (cycle > context->bus.deadline) {
+                cycle = context->bus.deadline;
+            }
+            if ((result = cgbl_bus_processor(context, cycle)) != CGBL_SUCCESS) {
+                return result;
+            }
         }
-    }
+    } while ((result = cgbl_bus_event(context)) == CGBL_SUCCESS);
+    cgbl_bus_sync_all(context);
     return result;
 }
 
-cgbl_error_e cgbl_bus_run_breakpoint(uint16_t breakpoint) {
+cgbl_error_e cgbl_bus_run_breakpoint(cgbl_context_t *const context, uint16_t breakpoint) {
     cgbl_error_e result = CGBL_SUCCESS;
+    cgbl_bus_sync_all(context);
     for (;;) {
-        if ((result = cgbl_processor_step_breakpoint(breakpoint)) != CGBL_SUCCESS) {
+        context->bus.event[CGBL_EVENT_PROCESSOR].cycle = context->bus.cycle + 1;
+        if ((result = cgbl_processor_step_breakpoint(context, breakpoint)) != CGBL_SUCCESS) {
             if (result != CGBL_COMPLETE) {
                 break;
             }
         }
-        cgbl_audio_step();
-        cgbl_cartridge_step();
-        cgbl_infrared_step();
-        cgbl_input_step();
-        cgbl_serial_step();
-        cgbl_timer_step();
-        if ((result = cgbl_video_step()) != CGBL_SUCCESS) {
+        ++context->bus.cycle;
+        if ((result = cgbl_bus_event(context)) != CGBL_SUCCESS) {
             break;
         }
+        if (!cgbl_processor_breakpoint(context, breakpoint)) {
+            cgbl_bus_skip(context);
+        }
     }
+    cgbl_bus_sync_all(context);
     return result;
 }
 
-cgbl_speed_e cgbl_bus_speed(void) {
-    return bus.speed.doubled ? CGBL_SPEED_DOUBLE : CGBL_SPEED_NORMAL;
+void cgbl_bus_schedule(cgbl_context_t *const context, cgbl_event_e event, uint32_t cycles) {
+    context->bus.event[event].deadline = context->bus.event[event].cycle + cycles;
+    if ((event < CGBL_EVENT_PROCESSOR) && (context->bus.event[event].deadline < context->bus.deadline)) {
+        context->bus.deadline = context->bus.event[event].deadline;
+    }
+}
+
+cgbl_speed_e cgbl_bus_speed(cgbl_context_t *const context) {
+    return context->bus.speed.doubled ? CGBL_SPEED_DOUBLE : CGBL_SPEED_NORMAL;
 }
 
-bool cgbl_bus_speed_change(void) {
-    if (bus.speed.armed) {
-        bus.speed.armed = false;
-        bus.speed.doubled = !bus.speed.doubled;
+bool cgbl_bus_speed_change(cgbl_context_t *const context) {
+    if (context->bus.speed.armed) {
+        context->bus.watch.invalid = true;
+        cgbl_bus_sync_all(context);
+        context->bus.speed.armed = false;
+        context->bus.speed.doubled = !context->bus.speed.doubled;
+        cgbl_bus_sync_all(context);
         return true;
     }
     return false;
 }
 
-cgbl_error_e cgbl_bus_step(uint16_t breakpoint) {
+cgbl_error_e cgbl_bus_step(cgbl_context_t *const context, uint16_t breakpoint) {
     cgbl_error_e result = CGBL_SUCCESS;
+    cgbl_bus_sync_all(context);
     for (;;) {
-        if ((result = cgbl_processor_step_breakpoint(breakpoint)) != CGBL_SUCCESS) {
+        context->bus.event[CGBL_EVENT_PROCESSOR].cycle = context->bus.cycle + 1;
+        if ((result = cgbl_processor_step_breakpoint(context, breakpoint)) != CGBL_SUCCESS) {
             if (result == CGBL_COMPLETE) {
                 result = CGBL_SUCCESS;
             }
             break;
         }
-        cgbl_audio_step();
-        cgbl_cartridge_step();
-        cgbl_infrared_step();
-        cgbl_input_step();
-        cgbl_serial_step();
-        cgbl_timer_step();
-        if ((result = cgbl_video_step()) != CGBL_SUCCESS) {
+        ++context->bus.cycle;
+        if ((result = cgbl_bus_event(context)) != CGBL_SUCCESS) {
             break;
         }
     }
+    cgbl_bus_sync_all(context);
     return result;
 }
 
-void cgbl_bus_write(uint16_t address, uint8_t data) {
-    switch (address) {
-    case CGBL_AUDIO_CHANNEL_1_ENVELOPE:
-    case CGBL_AUDIO_CHANNEL_1_FREQUENCY_HIGH:
-    case CGBL_AUDIO_CHANNEL_1_FREQUENCY_LOW:
-    case CGBL_AUDIO_CHANNEL_1_LENGTH:
-    case CGBL_AUDIO_CHANNEL_1_SWEEP:
-    case CGBL_AUDIO_CHANNEL_2_ENVELOPE:
-    case CGBL_AUDIO_CHANNEL_2_FREQUENCY_HIGH:
-    case CGBL_AUDIO_CHANNEL_2_FREQUENCY_LOW:
-    case CGBL_AUDIO_CHANNEL_2_LENGTH:
-    case CGBL_AUDIO_CHANNEL_3_CONTROL:
-    case CGBL_AUDIO_CHANNEL_3_FREQUENCY_HIGH:
-    case CGBL_AUDIO_CHANNEL_3_FREQUENCY_LOW:
-    case CGBL_AUDIO_CHANNEL_3_LENGTH:
-    case CGBL_AUDIO_CHANNEL_3_LEVEL:
-    case CGBL_AUDIO_CHANNEL_4_CONTROL:
-    case CGBL_AUDIO_CHANNEL_4_ENVELOPE:
-    case CGBL_AUDIO_CHANNEL_4_FREQUENCY:
-    case CGBL_AUDIO_CHANNEL_4_LENGTH:
-    case CGBL_AUDIO_CONTROL:
-    case CGBL_AUDIO_MIXER:
-    case CGBL_AUDIO_RAM_BEGIN ... CGBL_AUDIO_RAM_END:
-    case CGBL_AUDIO_VOLUME:
-        cgbl_audio_write(address, data);
-        break;
-    case CGBL_BUS_MODE:
-        if (cgbl_bootloader_enabled() && (cgbl_bus_mode() == CGBL_MODE_CGB)) {
-            bus.mode.dmg = (data & 4) >> 2;
+cgbl_error_e cgbl_bus_sync(cgbl_context_t *const context, cgbl_event_e event) {
+    cgbl_error_e result = CGBL_SUCCESS;
+    if (event < CGBL_EVENT_PROCESSOR) {
+        uint64_t cycle = context->bus.cycle - ((event > context->bus.current) ? 1 : 0);
+        uint32_t cycles = cycle - context->bus.event[event].cycle;
+        context->bus.event[event].cycle = cycle;
+        context->bus.event[event].deadline = UINT64_MAX;
+        switch (event) {
+        case CGBL_EVENT_AUDIO:
+            cgbl_audio_step(context, cycles);
+            break;
+        case CGBL_EVENT_CARTRIDGE:
+            cgbl_cartridge_step(context, cycles);
+            break;
+        case CGBL_EVENT_INFRARED:
+            cgbl_infrared_step(context, cycles);
+            break;
+        case CGBL_EVENT_INPUT:
+            cgbl_input_step(context, cycles);
+            break;
+        case CGBL_EVENT_SERIAL:
+            cgbl_serial_step(context, cycles);
+            break;
+        case CGBL_EVENT_TIMER:
+            cgbl_timer_step(context, cycles);
+            break;
+        case CGBL_EVENT_VIDEO:
+            result = cgbl_video_step(context, cycles);
+            break;
+        default:
+            break;
         }
-        break;
-    case CGBL_BUS_PRIORITY:
-        if (cgbl_bus_mode() == CGBL_MODE_CGB) {
-            bus.priority.dmg = data & 1;
+    }
+    return result;
+}
+
+void cgbl_bus_watch(cgbl_context_t *const context) {
+    memset(&context->bus.watch, 0, sizeof(context->bus.watch));
+}
+
+bool cgbl_bus_watched(cgbl_context_t *const context, uint64_t *const deadline) {
+    if (context->bus.watch.invalid) {
+        return false;
+    }
+    *deadline = context->bus.deadline;
+    if (context->bus.watch.divider) {
+        uint32_t edge = 0;
+        cgbl_bus_sync(context, CGBL_EVENT_TIMER);
+        if (cgbl_timer_read(context, CGBL_TIMER_DIVIDER) != context->bus.watch.data) {
+            return false;
         }
-        break;
-    case CGBL_BUS_SPEED:
-        if (cgbl_bus_mode() == CGBL_MODE_CGB) {
-            bus.speed.armed = data & 1;
+        if ((edge = cgbl_timer_divider_edge(context)) < (*deadline - context->bus.cycle)) {
+            *deadline = context->bus.cycle + edge;
+        }
+    }
+    return true;
+}
+
+void cgbl_bus_write(cgbl_context_t *const context, uint16_t address, uint8_t data) {
+    context->bus.watch.invalid = true;
+    ++context->bus.page.generation[address >> 8];
+    if (context->bus.page.write[address >> 8]) {
+        context->bus.page.write[address >> 8][address & 0xFF] = data;
+        return;
+    }
+    switch (address) {
+    case CGBL_BUS_IO_BEGIN ... CGBL_BUS_IO_END:
+        if (IO[address - CGBL_BUS_IO_BEGIN].write) {
+            cgbl_bus_sync(context, IO[address - CGBL_BUS_IO_BEGIN].event);
+            IO[address - CGBL_BUS_IO_BEGIN].write(context, address, data);
+            cgbl_bus_sync(context, IO[address - CGBL_BUS_IO_BEGIN].event);
         }
-        break;
-    case CGBL_INFRARED_CONTROL:
-        cgbl_infrared_write(address, data);
-        break;
-    case CGBL_INPUT_STATE:
-        cgbl_input_write(address, data);
         break;
     case CGBL_PROCESSOR_INTERRUPT_ENABLE:
-    case CGBL_PROCESSOR_INTERRUPT_FLAG:
-        cgbl_processor_write(address, data);
+        cgbl_processor_write(context, address, data);
         break;
-    case CGBL_SERIAL_CONTROL:
-    case CGBL_SERIAL_DATA:
-        cgbl_serial_write(address, data);
-        break;
-    case CGBL_TIMER_CONTROL:
-    case CGBL_TIMER_COUNTER:
-    case CGBL_TIMER_DIVIDER:
-    case CGBL_TIMER_MODULO:
-        cgbl_timer_write(address, data);
-        break;
-    case CGBL_VIDEO_CONTROL:
-    case CGBL_VIDEO_LINE_Y:
-    case CGBL_VIDEO_LINE_Y_COINCIDENCE:
-    case CGBL_VIDEO_PALETTE_BACKGROUND:
-    case CGBL_VIDEO_PALETTE_BACKGROUND_CONTROL:
-    case CGBL_VIDEO_PALETTE_BACKGROUND_DATA:
-    case CGBL_VIDEO_PALETTE_OBJECT_0:
-    case CGBL_VIDEO_PALETTE_OBJECT_1:
-    case CGBL_VIDEO_PALETTE_OBJECT_CONTROL:
-    case CGBL_VIDEO_PALETTE_OBJECT_DATA:
     case CGBL_VIDEO_RAM_BEGIN ... CGBL_VIDEO_RAM_END:
+        cgbl_video_write(context, address, data);
+        break;
     case CGBL_VIDEO_RAM_OBJECT_BEGIN ... CGBL_VIDEO_RAM_OBJECT_END:
-    case CGBL_VIDEO_RAM_SELECT:
-    case CGBL_VIDEO_SCROLL_X:
-    case CGBL_VIDEO_SCROLL_Y:
-    case CGBL_VIDEO_STATUS:
-    case CGBL_VIDEO_TRANSFER_CONTROL:
-    case CGBL_VIDEO_TRANSFER_DESTINATION_HIGH:
-    case CGBL_VIDEO_TRANSFER_DESTINATION_LOW:
-    case CGBL_VIDEO_TRANSFER_OBJECTS:
-    case CGBL_VIDEO_TRANSFER_SOURCE_HIGH:
-    case CGBL_VIDEO_TRANSFER_SOURCE_LOW:
-    case CGBL_VIDEO_WINDOW_X:
-    case CGBL_VIDEO_WINDOW_Y:
-        cgbl_video_write(address, data);
+        cgbl_bus_sync(context, CGBL_EVENT_VIDEO);
+        cgbl_video_write(context, address, data);
         break;
     default:
-        cgbl_memory_write(address, data);
+        cgbl_memory_write(context, address, data);
         break;
     }
 }
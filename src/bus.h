@@ -8,10 +8,27 @@
 
 #include "common.h"
 
+#define CGBL_BUS_BANK_NONE 0xFFFF
+#define CGBL_BUS_IO_BEGIN 0xFF00
+#define CGBL_BUS_IO_END 0xFF7F
 #define CGBL_BUS_MODE 0xFF4C
 #define CGBL_BUS_PRIORITY 0xFF6C
 #define CGBL_BUS_SPEED 0xFF4D
 
+#define CGBL_BUS_IO_WIDTH CGBL_WIDTH(CGBL_BUS_IO_BEGIN, CGBL_BUS_IO_END)
+
+typedef enum {
+    CGBL_EVENT_AUDIO = 0,
+    CGBL_EVENT_CARTRIDGE,
+    CGBL_EVENT_INFRARED,
+    CGBL_EVENT_INPUT,
+    CGBL_EVENT_SERIAL,
+    CGBL_EVENT_TIMER,
+    CGBL_EVENT_VIDEO,
+    CGBL_EVENT_PROCESSOR,
+    CGBL_EVENT_MAX
+} cgbl_event_e;
+
 typedef enum {
     CGBL_MODE_DMG = 0,
     CGBL_MODE_CGB,
@@ -35,15 +52,71 @@ typedef struct {
     uint8_t *data;
 } cgbl_bank_t;
 
-cgbl_mode_e cgbl_bus_mode(void);
-cgbl_priority_e cgbl_bus_priority(void);
-uint8_t cgbl_bus_read(uint16_t address);
-cgbl_error_e cgbl_bus_reset(const cgbl_bank_t *const rom, cgbl_bank_t *const ram);
-cgbl_error_e cgbl_bus_run(void);
-cgbl_error_e cgbl_bus_run_breakpoint(uint16_t breakpoint);
-cgbl_speed_e cgbl_bus_speed(void);
-bool cgbl_bus_speed_change(void);
-cgbl_error_e cgbl_bus_step(uint16_t breakpoint);
-void cgbl_bus_write(uint16_t address, uint8_t data);
+typedef struct {
+    uint64_t cycle;
+    uint64_t deadline;
+    cgbl_event_e current;
+    cgbl_error_e status;
+    struct {
+        uint64_t cycle;
+        uint64_t deadline;
+    } event[CGBL_EVENT_MAX];
+    struct {
+        uint16_t bank[256];
+        uint32_t generation[256];
+        const uint8_t *read[256];
+        uint8_t *write[256];
+    } page;
+    struct {
+        bool divider;
+        bool invalid;
+        uint8_t data;
+    } watch;
+    union {
+        uint8_t raw;
+        struct {
+            uint8_t : 2;
+            uint8_t dmg : 1;
+        };
+    } mode;
+    union {
+        uint8_t raw;
+        struct {
+            uint8_t dmg : 1;
+        };
+    } priority;
+    union {
+        uint8_t raw;
+        struct {
+            uint8_t armed : 1;
+            uint8_t : 6;
+            uint8_t doubled : 1;
+        };
+    } speed;
+} cgbl_bus_t;
+
+bool cgbl_bus_advance(cgbl_context_t *const context, uint32_t cycles);
+uint16_t cgbl_bus_bank(cgbl_context_t *const context, uint16_t address);
+void cgbl_bus_clock(cgbl_context_t *const context, uint8_t cycles);
+uint64_t cgbl_bus_cycle(cgbl_context_t *const context);
+uint32_t cgbl_bus_edge(uint16_t divider, uint16_t mask);
+uint32_t cgbl_bus_generation(cgbl_context_t *const context, uint16_t address);
+void cgbl_bus_invalidate(cgbl_context_t *const context, uint16_t address);
+void cgbl_bus_map(cgbl_context_t *const context, uint16_t begin, uint16_t end, const uint8_t *read, uint8_t *write);
+cgbl_mode_e cgbl_bus_mode(cgbl_context_t *const context);
+const uint8_t *cgbl_bus_page(cgbl_context_t *const context, uint16_t address);
+cgbl_priority_e cgbl_bus_priority(cgbl_context_t *const context);
+uint8_t cgbl_bus_read(cgbl_context_t *const context, uint16_t address);
+cgbl_error_e cgbl_bus_reset(cgbl_context_t *const context, const cgbl_bank_t *const rom, cgbl_bank_t *const ram);
+cgbl_error_e cgbl_bus_run(cgbl_context_t *const context);
+cgbl_error_e cgbl_bus_run_breakpoint(cgbl_context_t *const context, uint16_t breakpoint);
+void cgbl_bus_schedule(cgbl_context_t *const context, cgbl_event_e event, uint32_t cycles);
+cgbl_speed_e cgbl_bus_speed(cgbl_context_t *const context);
+bool cgbl_bus_speed_change(cgbl_context_t *const context);
+cgbl_error_e cgbl_bus_step(cgbl_context_t *const context, uint16_t breakpoint);
+cgbl_error_e cgbl_bus_sync(cgbl_context_t *const context, cgbl_event_e event);
+void cgbl_bus_watch(cgbl_context_t *const context);
+bool cgbl_bus_watched(cgbl_context_t *const context, uint64_t *const deadline);
+void cgbl_bus_write(cgbl_context_t *const context, uint16_t address, uint8_t data);
 
 #endif /* CGBL_BUS_H_ */
@@ -4,6 +4,7 @@
  */
 
 #include "audio.h"
+#include "context.h"
 #include <string.h>
 
 static const uint32_t DIVIDER[] = { 8, 16, 32, 48, 64, 80, 96, 112 };
@@ -15,523 +16,330 @@ static const float PULSE[][8] = { { -1.f, -1.f, -1.f, -1.f, -1.f, -1.f, -1.f, 1.
 
 static const uint8_t SHIFT[] = { 4, 0, 1, 2 };
 
-static struct {
-    uint32_t cycle;
-    uint16_t delay;
-    uint32_t index;
-    uint8_t ram[CGBL_AUDIO_RAM_WIDTH];
-    float sample[CGBL_AUDIO_SAMPLES];
-    struct {
-        uint32_t delay;
-        uint8_t position;
-        uint8_t volume;
-        union {
-            uint8_t raw;
-            struct {
-                uint8_t period : 3;
-                uint8_t direction : 1;
-                uint8_t volume : 4;
-            };
-        } envelope;
-        struct {
-            uint8_t low;
-            union {
-                uint8_t raw;
-                struct {
-                    uint8_t period : 3;
-                    uint8_t : 3;
-                    uint8_t enabled : 1;
-                    uint8_t trigger : 1;
-                };
-            } high;
-        } frequency;
-        union {
-            uint8_t raw;
-            struct {
-                uint8_t timer : 6;
-                uint8_t duty : 2;
-            };
-        } length;
-        union {
-            uint8_t raw;
-            struct {
-                uint8_t shift : 3;
-                uint8_t direction : 1;
-                uint8_t period : 3;
-            };
-        } sweep;
-        struct {
-            uint8_t length;
-            struct {
-                uint8_t period;
-            } envelope;
-            struct {
-                bool enabled;
-                uint16_t frequency;
-                uint8_t period;
-            } sweep;
-        } timer;
-    } channel_1;
-    struct {
-        uint32_t delay;
-        uint8_t position;
-        uint8_t volume;
-        union {
-            uint8_t raw;
-            struct {
-                uint8_t period : 3;
-                uint8_t direction : 1;
-                uint8_t volume : 4;
-            };
-        } envelope;
-        struct {
-            uint8_t low;
-            union {
-                uint8_t raw;
-                struct {
-                    uint8_t period : 3;
-                    uint8_t : 3;
-                    uint8_t enabled : 1;
-                    uint8_t trigger : 1;
-                };
-            } high;
-        } frequency;
-        union {
-            uint8_t raw;
-            struct {
-                uint8_t timer : 6;
-                uint8_t duty : 2;
-            };
-        } length;
-        struct {
-            uint8_t length;
-            struct {
-                uint8_t period;
-            } envelope;
-        } timer;
-    } channel_2;
-    struct {
-        uint32_t delay;
-        uint8_t length;
-        uint8_t position;
-        union {
-            uint8_t raw;
-            struct {
-                uint8_t : 7;
-                uint8_t enabled : 1;
-            };
-        } control;
-        struct {
-            uint8_t low;
-            union {
-                uint8_t raw;
-                struct {
-                    uint8_t period : 3;
-                    uint8_t : 3;
-                    uint8_t enabled : 1;
-                    uint8_t trigger : 1;
-                };
-            } high;
-        } frequency;
-        union {
-            uint8_t raw;
-            struct {
-                uint8_t : 5;
-                uint8_t output : 2;
-            };
-        } level;
-        struct {
-            uint16_t length;
-        } timer;
-    } channel_3;
-    struct {
-        uint32_t delay;
-        uint16_t sample;
-        uint8_t volume;
-        union {
-            uint8_t raw;
-            struct {
-                struct {
-                    uint8_t : 6;
-                    uint8_t enabled : 1;
-                    uint8_t trigger : 1;
-                };
-            };
-        } control;
-        union {
-            uint8_t raw;
-            struct {
-                uint8_t period : 3;
-                uint8_t direction : 1;
-                uint8_t volume : 4;
-            };
-        } envelope;
-        union {
-            uint8_t raw;
-            struct {
-                uint8_t divider : 3;
-                uint8_t width : 1;
-                uint8_t shift : 4;
-            };
-        } frequency;
-        union {
-            uint8_t raw;
-            struct {
-                uint8_t timer : 6;
-                uint8_t : 2;
-            };
-        } length;
-        struct {
-            uint8_t length;
-            struct {
-                uint8_t period;
-            } envelope;
-        } timer;
-    } channel_4;
-    union {
-        uint8_t raw;
-        struct {
-            uint8_t channel_1_enabled : 1;
-            uint8_t channel_2_enabled : 1;
-            uint8_t channel_3_enabled : 1;
-            uint8_t channel_4_enabled : 1;
-            uint8_t : 3;
-            uint8_t enabled : 1;
-        };
-    } control;
-    union {
-        uint8_t raw;
-        struct {
-            uint8_t channel_1_right : 1;
-            uint8_t channel_2_right : 1;
-            uint8_t channel_3_right : 1;
-            uint8_t channel_4_right : 1;
-            uint8_t channel_1_left : 1;
-            uint8_t channel_2_left : 1;
-            uint8_t channel_3_left : 1;
-            uint8_t channel_4_left : 1;
-        };
-    } mixer;
-    union {
-        uint8_t raw;
-        struct {
-            uint8_t right : 3;
-            uint8_t : 1;
-            uint8_t left : 3;
-            uint8_t : 1;
-        };
-    } volume;
-} audio = {};
-
-static void cgbl_audio_channel_1_envelope(void) {
-    if (audio.channel_1.timer.envelope.period && !--audio.channel_1.timer.envelope.period) {
-        audio.channel_1.timer.envelope.period = audio.channel_1.envelope.period;
-        if (audio.channel_1.envelope.direction) {
-            if (audio.channel_1.volume < 15) {
-                ++audio.channel_1.volume;
+static void cgbl_audio_channel_1_envelope(cgbl_context_t *const context) {
+    if (context->audio.channel_1.timer.envelope.period && !--context->audio.channel_1.timer.envelope.period) {
+        context->audio.channel_1.timer.envelope.period = context->audio.channel_1.envelope.period;
+        if (context->audio.channel_1.envelope.direction) {
+            if (context->audio.channel_1.volume < 15) {
+                ++context->audio.channel_1.volume;
             }
-        } else if (audio.channel_1.volume) {
-            --audio.channel_1.volume;
+        } else if (context->audio.channel_1.volume) {
+            --context->audio.channel_1.volume;
         }
     }
 }
 
-static void cgbl_audio_channel_1_length(void) {
-    if (audio.channel_1.frequency.high.enabled && audio.channel_1.timer.length) {
-        if (!--audio.channel_1.timer.length) {
-            audio.control.channel_1_enabled = false;
+static void cgbl_audio_channel_1_length(cgbl_context_t *const context) {
+    if (context->audio.channel_1.frequency.high.enabled && context->audio.channel_1.timer.length) {
+        if (!--context->audio.channel_1.timer.length) {
+            context->audio.control.channel_1_enabled = false;
         }
     }
 }
 
-static void cgbl_audio_channel_1_sample(float *const left, float *const right) {
-    if (audio.control.channel_1_enabled) {
-        float sample = (PULSE[audio.channel_1.length.duty][audio.channel_1.position] * audio.channel_1.volume) / 15.f;
-        if (audio.mixer.channel_1_left) {
+static void cgbl_audio_channel_1_sample(cgbl_context_t *const context, float *const left, float *const right) {
+    if (context->audio.control.channel_1_enabled) {
+        float sample =
+            (PULSE[context->audio.channel_1.length.duty][context->audio.channel_1.position] * context->audio.channel_1.volume) / 15.f;
+        if (context->audio.mixer.channel_1_left) {
             *left += sample;
         }
-        if (audio.mixer.channel_1_right) {
+        if (context->audio.mixer.channel_1_right) {
             *right += sample;
         }
     }
 }
 
-static void cgbl_audio_channel_1_step(void) {
-    if (audio.control.channel_1_enabled) {
-        if (!audio.channel_1.delay) {
-            audio.channel_1.delay = (2048 - ((audio.channel_1.frequency.high.period << 8) | audio.channel_1.frequency.low)) * 4;
-            audio.channel_1.position = (audio.channel_1.position + 1) & 7;
+static void cgbl_audio_channel_1_step(cgbl_context_t *const context, uint32_t cycles) {
+    if (context->audio.control.channel_1_enabled) {
+        if (cycles > context->audio.channel_1.delay) {
+            uint32_t period = (2048 - ((context->audio.channel_1.frequency.high.period << 8) | context->audio.channel_1.frequency.low)) * 4,
+                     count = ((cycles - context->audio.channel_1.delay - 1) / period) + 1;
+            context->audio.channel_1.delay += (count * period) - cycles;
+            context->audio.channel_1.position = (context->audio.channel_1.position + count) & 7;
+        } else {
+            context->audio.channel_1.delay -= cycles;
         }
-        --audio.channel_1.delay;
     }
 }
 
-static void cgbl_audio_channel_1_sweep(void) {
-    if (audio.channel_1.timer.sweep.period && !--audio.channel_1.timer.sweep.period) {
-        audio.channel_1.timer.sweep.period = !audio.channel_1.sweep.period ? 8 : audio.channel_1.sweep.period;
-        if (audio.channel_1.timer.sweep.enabled && audio.channel_1.sweep.period) {
-            uint16_t frequency = audio.channel_1.timer.sweep.frequency >> audio.channel_1.sweep.shift;
-            if (audio.channel_1.sweep.direction) {
-                frequency = audio.channel_1.timer.sweep.frequency - frequency;
+static void cgbl_audio_channel_1_sweep(cgbl_context_t *const context) {
+    if (context->audio.channel_1.timer.sweep.period && !--context->audio.channel_1.timer.sweep.period) {
+        context->audio.channel_1.timer.sweep.period = !context->audio.channel_1.sweep.period ? 8 : context->audio.channel_1.sweep.period;
+        if (context->audio.channel_1.timer.sweep.enabled && context->audio.channel_1.sweep.period) {
+            uint16_t frequency = context->audio.channel_1.timer.sweep.frequency >> context->audio.channel_1.sweep.shift;
+            if (context->audio.channel_1.sweep.direction) {
+                frequency = context->audio.channel_1.timer.sweep.frequency - frequency;
             } else {
-                frequency = audio.channel_1.timer.sweep.frequency + frequency;
+                frequency = context->audio.channel_1.timer.sweep.frequency + frequency;
             }
             if (frequency > 2047) {
-                audio.channel_1.timer.sweep.enabled = false;
-            } else if (audio.channel_1.sweep.shift) {
-                audio.channel_1.frequency.high.period = frequency >> 8;
-                audio.channel_1.frequency.low = frequency;
-                audio.channel_1.timer.sweep.frequency = frequency;
+                context->audio.channel_1.timer.sweep.enabled = false;
+            } else if (context->audio.channel_1.sweep.shift) {
+                context->audio.channel_1.frequency.high.period = frequency >> 8;
+                context->audio.channel_1.frequency.low = frequency;
+                context->audio.channel_1.timer.sweep.frequency = frequency;
             }
         }
     }
 }
 
-static void cgbl_audio_channel_1_trigger(void) {
-    if (audio.channel_1.frequency.high.trigger) {
-        audio.channel_1.timer.envelope.period = audio.channel_1.envelope.period;
-        audio.channel_1.timer.length = 64 - audio.channel_1.length.timer;
-        audio.channel_1.timer.sweep.enabled = (audio.channel_1.sweep.period || audio.channel_1.sweep.shift);
-        audio.channel_1.timer.sweep.frequency = (audio.channel_1.frequency.high.period << 8) | audio.channel_1.frequency.low;
-        audio.channel_1.timer.sweep.period = !audio.channel_1.sweep.period ? 8 : audio.channel_1.sweep.period;
-        audio.channel_1.volume = audio.channel_1.envelope.volume;
-        audio.control.channel_1_enabled = true;
+static void cgbl_audio_channel_1_trigger(cgbl_context_t *const context) {
+    if (context->audio.channel_1.frequency.high.trigger) {
+        context->audio.channel_1.timer.envelope.period = context->audio.channel_1.envelope.period;
+        context->audio.channel_1.timer.length = 64 - context->audio.channel_1.length.timer;
+        context->audio.channel_1.timer.sweep.enabled = (context->audio.channel_1.sweep.period || context->audio.channel_1.sweep.shift);
+        context->audio.channel_1.timer.sweep.frequency =
+            (context->audio.channel_1.frequency.high.period << 8) | context->audio.channel_1.frequency.low;
+        context->audio.channel_1.timer.sweep.period = !context->audio.channel_1.sweep.period ? 8 : context->audio.channel_1.sweep.period;
+        context->audio.channel_1.volume = context->audio.channel_1.envelope.volume;
+        context->audio.control.channel_1_enabled = true;
     }
 }
 
-static void cgbl_audio_channel_2_envelope(void) {
-    if (audio.channel_2.timer.envelope.period && !--audio.channel_2.timer.envelope.period) {
-        audio.channel_2.timer.envelope.period = audio.channel_2.envelope.period;
-        if (audio.channel_2.envelope.direction) {
-            if (audio.channel_2.volume < 15) {
-                ++audio.channel_2.volume;
+static void cgbl_audio_channel_2_envelope(cgbl_context_t *const context) {
+    if (context->audio.channel_2.timer.envelope.period && !--context->audio.channel_2.timer.envelope.period) {
+        context->audio.channel_2.timer.envelope.period = context->audio.channel_2.envelope.period;
+        if (context->audio.channel_2.envelope.direction) {
+            if (context->audio.channel_2.volume < 15) {
+                ++context->audio.channel_2.volume;
             }
-        } else if (audio.channel_2.volume) {
-            --audio.channel_2.volume;
+        } else if (context->audio.channel_2.volume) {
+            --context->audio.channel_2.volume;
         }
     }
 }
 
-static void cgbl_audio_channel_2_length(void) {
-    if (audio.channel_2.frequency.high.enabled && audio.channel_2.timer.length) {
-        if (!--audio.channel_2.timer.length) {
-            audio.control.channel_2_enabled = false;
+static void cgbl_audio_channel_2_length(cgbl_context_t *const context) {
+    if (context->audio.channel_2.frequency.high.enabled && context->audio.channel_2.timer.length) {
+        if (!--context->audio.channel_2.timer.length) {
+            context->audio.control.channel_2_enabled = false;
         }
     }
 }
 
-static void cgbl_audio_channel_2_sample(float *const left, float *const right) {
-    if (audio.control.channel_2_enabled) {
-        float sample = (PULSE[audio.channel_2.length.duty][audio.channel_2.position] * audio.channel_2.volume) / 15.f;
-        if (audio.mixer.channel_2_left) {
+static void cgbl_audio_channel_2_sample(cgbl_context_t *const context, float *const left, float *const right) {
+    if (context->audio.control.channel_2_enabled) {
+        float sample =
+            (PULSE[context->audio.channel_2.length.duty][context->audio.channel_2.position] * context->audio.channel_2.volume) / 15.f;
+        if (context->audio.mixer.channel_2_left) {
             *left += sample;
         }
-        if (audio.mixer.channel_2_right) {
+        if (context->audio.mixer.channel_2_right) {
             *right += sample;
         }
     }
 }
 
-static void cgbl_audio_channel_2_step(void) {
-    if (audio.control.channel_2_enabled) {
-        if (!audio.channel_2.delay) {
-            audio.channel_2.delay = (2048 - ((audio.channel_2.frequency.high.period << 8) | audio.channel_2.frequency.low)) * 4;
-            audio.channel_2.position = (audio.channel_2.position + 1) & 7;
+static void cgbl_audio_channel_2_step(cgbl_context_t *const context, uint32_t cycles) {
+    if (context->audio.control.channel_2_enabled) {
+        if (cycles > context->audio.channel_2.delay) {
+            uint32_t period = (2048 - ((context->audio.channel_2.frequency.high.period << 8) | context->audio.channel_2.frequency.low)) * 4,
+                     count = ((cycles - context->audio.channel_2.delay - 1) / period) + 1;
+            context->audio.channel_2.delay += (count * period) - cycles;
+            context->audio.channel_2.position = (context->audio.channel_2.position + count) & 7;
+        } else {
+            context->audio.channel_2.delay -= cycles;
         }
-        --audio.channel_2.delay;
     }
 }
 
-static void cgbl_audio_channel_2_trigger(void) {
-    if (audio.channel_2.frequency.high.trigger) {
-        audio.channel_2.timer.envelope.period = audio.channel_2.envelope.period;
-        audio.channel_2.timer.length = 64 - audio.channel_2.length.timer;
-        audio.channel_2.volume = audio.channel_2.envelope.volume;
-        audio.control.channel_2_enabled = true;
+static void cgbl_audio_channel_2_trigger(cgbl_context_t *const context) {
+    if (context->audio.channel_2.frequency.high.trigger) {
+        context->audio.channel_2.timer.envelope.period = context->audio.channel_2.envelope.period;
+        context->audio.channel_2.timer.length = 64 - context->audio.channel_2.length.timer;
+        context->audio.channel_2.volume = context->audio.channel_2.envelope.volume;
+        context->audio.control.channel_2_enabled = true;
     }
 }
 
-static void cgbl_audio_channel_3_length(void) {
-    if (audio.channel_3.frequency.high.enabled && audio.channel_3.timer.length) {
-        if (!--audio.channel_3.timer.length) {
-            audio.control.channel_3_enabled = false;
+static void cgbl_audio_channel_3_length(cgbl_context_t *const context) {
+    if (context->audio.channel_3.frequency.high.enabled && context->audio.channel_3.timer.length) {
+        if (!--context->audio.channel_3.timer.length) {
+            context->audio.control.channel_3_enabled = false;
         }
     }
 }
 
-static void cgbl_audio_channel_3_sample(float *const left, float *const right) {
-    if (audio.control.channel_3_enabled) {
+static void cgbl_audio_channel_3_sample(cgbl_context_t *const context, float *const left, float *const right) {
+    if (context->audio.control.channel_3_enabled) {
         float sample = 0.f;
-        uint8_t data = audio.ram[audio.channel_3.position / 2];
-        if (!(audio.channel_3.position % 2)) {
+        uint8_t data = context->audio.ram[context->audio.channel_3.position / 2];
+        if (!(context->audio.channel_3.position % 2)) {
             data >>= 4;
         }
         data &= 15;
-        data >>= SHIFT[audio.channel_3.level.output];
+        data >>= SHIFT[context->audio.channel_3.level.output];
         sample = data / 15.f;
-        if (audio.mixer.channel_3_left) {
+        if (context->audio.mixer.channel_3_left) {
             *left += sample;
         }
-        if (audio.mixer.channel_3_right) {
+        if (context->audio.mixer.channel_3_right) {
             *right += sample;
         }
     }
 }
 
-static void cgbl_audio_channel_3_step(void) {
-    if (audio.control.channel_3_enabled) {
-        if (!audio.channel_3.delay) {
-            audio.channel_3.delay = (2048 - ((audio.channel_3.frequency.high.period << 8) | audio.channel_3.frequency.low)) * 2;
-            audio.channel_3.position = (audio.channel_3.position + 1) & 31;
+static void cgbl_audio_channel_3_step(cgbl_context_t *const context, uint32_t cycles) {
+    if (context->audio.control.channel_3_enabled) {
+        if (cycles > context->audio.channel_3.delay) {
+            uint32_t period = (2048 - ((context->audio.channel_3.frequency.high.period << 8) | context->audio.channel_3.frequency.low)) * 2,
+                     count = ((cycles - context->audio.channel_3.delay - 1) / period) + 1;
+            context->audio.channel_3.delay += (count * period) - cycles;
+            context->audio.channel_3.position = (context->audio.channel_3.position + count) & 31;
+        } else {
+            context->audio.channel_3.delay -= cycles;
         }
-        --audio.channel_3.delay;
     }
 }
 
-static void cgbl_audio_channel_3_trigger(void) {
-    if (audio.channel_3.frequency.high.trigger) {
-        audio.channel_3.position = 0;
-        audio.channel_3.timer.length = 256 - audio.channel_3.length;
-        audio.control.channel_3_enabled = true;
+static void cgbl_audio_channel_3_trigger(cgbl_context_t *const context) {
+    if (context->audio.channel_3.frequency.high.trigger) {
+        context->audio.channel_3.position = 0;
+        context->audio.channel_3.timer.length = 256 - context->audio.channel_3.length;
+        context->audio.control.channel_3_enabled = true;
     }
 }
 
-static void cgbl_audio_channel_4_envelope(void) {
-    if (audio.channel_4.timer.envelope.period && !--audio.channel_4.timer.envelope.period) {
-        audio.channel_4.timer.envelope.period = audio.channel_4.envelope.period;
-        if (audio.channel_4.envelope.direction) {
-            if (audio.channel_4.volume < 15) {
-                ++audio.channel_4.volume;
+static void cgbl_audio_channel_4_envelope(cgbl_context_t *const context) {
+    if (context->audio.channel_4.timer.envelope.period && !--context->audio.channel_4.timer.envelope.period) {
+        context->audio.channel_4.timer.envelope.period = context->audio.channel_4.envelope.period;
+        if (context->audio.channel_4.envelope.direction) {
+            if (context->audio.channel_4.volume < 15) {
+                ++context->audio.channel_4.volume;
             }
-        } else if (audio.channel_4.volume) {
-            --audio.channel_4.volume;
+        } else if (context->audio.channel_4.volume) {
+            --context->audio.channel_4.volume;
         }
     }
 }
 
-static void cgbl_audio_channel_4_length(void) {
-    if (audio.channel_4.control.enabled && audio.channel_4.timer.length) {
-        if (!--audio.channel_4.timer.length) {
-            audio.control.channel_4_enabled = false;
+static void cgbl_audio_channel_4_length(cgbl_context_t *const context) {
+    if (context->audio.channel_4.control.enabled && context->audio.channel_4.timer.length) {
+        if (!--context->audio.channel_4.timer.length) {
+            context->audio.control.channel_4_enabled = false;
         }
     }
 }
 
-static void cgbl_audio_channel_4_sample(float *const left, float *const right) {
-    if (audio.control.channel_4_enabled) {
-        float sample = (((audio.channel_4.sample & 1) ? 1.f : -1.f) * audio.channel_4.volume) / 15.f;
-        if (audio.mixer.channel_4_left) {
+static void cgbl_audio_channel_4_sample(cgbl_context_t *const context, float *const left, float *const right) {
+    if (context->audio.control.channel_4_enabled) {
+        float sample = (((context->audio.channel_4.sample & 1) ? 1.f : -1.f) * context->audio.channel_4.volume) / 15.f;
+        if (context->audio.mixer.channel_4_left) {
             *left += sample;
         }
-        if (audio.mixer.channel_4_right) {
+        if (context->audio.mixer.channel_4_right) {
             *right += sample;
         }
     }
 }
 
-static void cgbl_audio_channel_4_step(void) {
-    if (audio.control.channel_4_enabled) {
-        if (!audio.channel_4.delay) {
+static void cgbl_audio_channel_4_step(cgbl_context_t *const context, uint32_t cycles) {
+    if (context->audio.control.channel_4_enabled) {
+        while (cycles > context->audio.channel_4.delay) {
             uint16_t sample = 0;
-            audio.channel_4.delay = DIVIDER[audio.channel_4.frequency.divider] << audio.channel_4.frequency.shift;
-            sample = !((audio.channel_4.sample & 1) ^ ((audio.channel_4.sample & 2) >> 1));
-            audio.channel_4.sample = (audio.channel_4.sample >> 1) | (sample << 14);
-            if (audio.channel_4.frequency.width) {
-                audio.channel_4.sample &= ~(1 << 6);
-                audio.channel_4.sample |= (sample << 6);
+            cycles -= context->audio.channel_4.delay + 1;
+            context->audio.channel_4.delay =
+                (DIVIDER[context->audio.channel_4.frequency.divider] << context->audio.channel_4.frequency.shift) - 1;
+            sample = !((context->audio.channel_4.sample & 1) ^ ((context->audio.channel_4.sample & 2) >> 1));
+            context->audio.channel_4.sample = (context->audio.channel_4.sample >> 1) | (sample << 14);
+            if (context->audio.channel_4.frequency.width) {
+                context->audio.channel_4.sample &= ~(1 << 6);
+                context->audio.channel_4.sample |= (sample << 6);
             }
         }
-        --audio.channel_4.delay;
+        context->audio.channel_4.delay -= cycles;
     }
 }
 
-static void cgbl_audio_channel_4_trigger(void) {
-    if (audio.channel_4.control.trigger) {
-        audio.channel_4.sample = 0;
-        audio.channel_4.timer.envelope.period = audio.channel_4.envelope.period;
-        audio.channel_4.timer.length = 64 - audio.channel_4.length.timer;
-        audio.channel_4.volume = audio.channel_4.envelope.volume;
-        audio.control.channel_4_enabled = true;
+static void cgbl_audio_channel_4_trigger(cgbl_context_t *const context) {
+    if (context->audio.channel_4.control.trigger) {
+        context->audio.channel_4.sample = 0;
+        context->audio.channel_4.timer.envelope.period = context->audio.channel_4.envelope.period;
+        context->audio.channel_4.timer.length = 64 - context->audio.channel_4.length.timer;
+        context->audio.channel_4.volume = context->audio.channel_4.envelope.volume;
+        context->audio.control.channel_4_enabled = true;
     }
 }
 
-void cgbl_audio_interrupt(void) {
-    cgbl_audio_channel_1_length();
-    cgbl_audio_channel_2_length();
-    cgbl_audio_channel_3_length();
-    cgbl_audio_channel_4_length();
-    if (!(audio.cycle % 2)) {
-        cgbl_audio_channel_1_sweep();
+void cgbl_audio_interrupt(cgbl_context_t *const context) {
+    cgbl_bus_sync(context, CGBL_EVENT_AUDIO);
+    cgbl_audio_channel_1_length(context);
+    cgbl_audio_channel_2_length(context);
+    cgbl_audio_channel_3_length(context);
+    cgbl_audio_channel_4_length(context);
+    if (!(context->audio.cycle % 2)) {
+        cgbl_audio_channel_1_sweep(context);
     }
-    if (!(audio.cycle % 4)) {
-        cgbl_audio_channel_1_envelope();
-        cgbl_audio_channel_2_envelope();
-        cgbl_audio_channel_4_envelope();
+    if (!(context->audio.cycle % 4)) {
+        cgbl_audio_channel_1_envelope(context);
+        cgbl_audio_channel_2_envelope(context);
+        cgbl_audio_channel_4_envelope(context);
     }
-    if (++audio.cycle >= 4) {
-        audio.cycle = 0;
+    if (++context->audio.cycle >= 4) {
+        context->audio.cycle = 0;
     }
 }
 
-uint8_t cgbl_audio_read(uint16_t address) {
+uint8_t cgbl_audio_read(cgbl_context_t *const context, uint16_t address) {
     uint8_t result = 0xFF;
     switch (address) {
     case CGBL_AUDIO_CHANNEL_1_ENVELOPE:
-        result = audio.channel_1.envelope.raw;
+        result = context->audio.channel_1.envelope.raw;
         break;
     case CGBL_AUDIO_CHANNEL_1_FREQUENCY_HIGH:
-        result = audio.channel_1.frequency.high.raw;
+        result = context->audio.channel_1.frequency.high.raw;
         break;
     case CGBL_AUDIO_CHANNEL_1_LENGTH:
-        result = audio.channel_1.length.raw;
+        result = context->audio.channel_1.length.raw;
         break;
     case CGBL_AUDIO_CHANNEL_1_SWEEP:
-        result = audio.channel_1.sweep.raw;
+        result = context->audio.channel_1.sweep.raw;
         break;
     case CGBL_AUDIO_CHANNEL_2_ENVELOPE:
-        result = audio.channel_2.envelope.raw;
+        result = context->audio.channel_2.envelope.raw;
         break;
     case CGBL_AUDIO_CHANNEL_2_FREQUENCY_HIGH:
-        result = audio.channel_2.frequency.high.raw;
+        result = context->audio.channel_2.frequency.high.raw;
         break;
     case CGBL_AUDIO_CHANNEL_2_LENGTH:
-        result = audio.channel_2.length.raw;
+        result = context->audio.channel_2.length.raw;
         break;
     case CGBL_AUDIO_CHANNEL_3_CONTROL:
-        result = audio.channel_3.control.raw;
+        result = context->audio.channel_3.control.raw;
         break;
     case CGBL_AUDIO_CHANNEL_3_FREQUENCY_HIGH:
-        result = audio.channel_3.frequency.high.raw;
+        result = context->audio.channel_3.frequency.high.raw;
         break;
     case CGBL_AUDIO_CHANNEL_3_LENGTH:
-        result = audio.channel_3.length;
+        result = context->audio.channel_3.length;
         break;
     case CGBL_AUDIO_CHANNEL_3_LEVEL:
-        result = audio.channel_3.level.raw;
+        result = context->audio.channel_3.level.raw;
         break;
     case CGBL_AUDIO_CHANNEL_4_CONTROL:
-        result = audio.channel_4.control.raw;
+        result = context->audio.channel_4.control.raw;
         break;
     case CGBL_AUDIO_CHANNEL_4_ENVELOPE:
-        result = audio.channel_4.envelope.raw;
+        result = context->audio.channel_4.envelope.raw;
         break;
     case CGBL_AUDIO_CHANNEL_4_FREQUENCY:
-        result = audio.channel_4.frequency.raw;
+        result = context->audio.channel_4.frequency.raw;
         break;
     case CGBL_AUDIO_CHANNEL_4_LENGTH:
-        result = audio.channel_4.length.raw;
+        result = context->audio.channel_4.length.raw;
         break;
     case CGBL_AUDIO_CONTROL:
-        result = audio.control.raw;
+        result = context->audio.control.raw;
         break;
     case CGBL_AUDIO_MIXER:
-        result = audio.mixer.raw;
+        result = context->audio.mixer.raw;
         break;
     case CGBL_AUDIO_RAM_BEGIN ... CGBL_AUDIO_RAM_END:
-        result = audio.ram[address - CGBL_AUDIO_RAM_BEGIN];
+        result = context->audio.ram[address - CGBL_AUDIO_RAM_BEGIN];
         break;
     case CGBL_AUDIO_VOLUME:
-        result = audio.volume.raw;
+        result = context->audio.volume.raw;
         break;
     default:
         break;
@@ -539,169 +347,177 @@ uint8_t cgbl_audio_read(uint16_t address) {
     return result;
 }
 
-void cgbl_audio_reset(void) {
-    memset(&audio, 0, sizeof(audio));
-    audio.channel_1.frequency.high.raw = 0x38;
-    audio.channel_1.sweep.raw = 0x80;
-    audio.channel_2.frequency.high.raw = 0x38;
-    audio.channel_3.control.raw = 0x7F;
-    audio.channel_3.frequency.high.raw = 0x38;
-    audio.channel_3.level.raw = 0x9F;
-    audio.channel_4.control.raw = 0x3F;
-    audio.channel_4.length.raw = 0xC0;
-    audio.control.raw = 0x70;
-    audio.volume.raw = 0x88;
+void cgbl_audio_reset(cgbl_context_t *const context) {
+    memset(&context->audio, 0, sizeof(context->audio));
+    context->audio.channel_1.frequency.high.raw = 0x38;
+    context->audio.channel_1.sweep.raw = 0x80;
+    context->audio.channel_2.frequency.high.raw = 0x38;
+    context->audio.channel_3.control.raw = 0x7F;
+    context->audio.channel_3.frequency.high.raw = 0x38;
+    context->audio.channel_3.level.raw = 0x9F;
+    context->audio.channel_4.control.raw = 0x3F;
+    context->audio.channel_4.length.raw = 0xC0;
+    context->audio.control.raw = 0x70;
+    context->audio.volume.raw = 0x88;
 }
 
-const float (*cgbl_audio_sample(void)) [CGBL_AUDIO_SAMPLES] { return &audio.sample; }
+const float (*cgbl_audio_sample(cgbl_context_t *const context)) [CGBL_AUDIO_SAMPLES] { return &context->audio.sample; }
 
-void cgbl_audio_step(void) {
-    cgbl_audio_channel_1_step();
-    cgbl_audio_channel_2_step();
-    cgbl_audio_channel_3_step();
-    cgbl_audio_channel_4_step();
-    if (!audio.delay) {
-        float left = 0.f, right = 0.f;
-        if (audio.control.enabled) {
-            cgbl_audio_channel_1_sample(&left, &right);
-            cgbl_audio_channel_2_sample(&left, &right);
-            cgbl_audio_channel_3_sample(&left, &right);
-            cgbl_audio_channel_4_sample(&left, &right);
-            left *= (audio.volume.left + 1.f) / 8.f;
-            right *= (audio.volume.right + 1.f) / 8.f;
-        }
-        audio.sample[audio.index++] = ((left / 4.f) + (right / 4.f)) / 2.f;
-        if (audio.index >= CGBL_LENGTH(audio.sample)) {
-            audio.index = 0;
-        }
-        audio.delay = 88;
+void cgbl_audio_step(cgbl_context_t *const context, uint32_t cycles) {
+    while (cycles) {
+        uint32_t count = cycles;
+        if (count > context->audio.delay) {
+            count = context->audio.delay + 1;
+        }
+        cgbl_audio_channel_1_step(context, count);
+        cgbl_audio_channel_2_step(context, count);
+        cgbl_audio_channel_3_step(context, count);
+        cgbl_audio_channel_4_step(context, count);
+        context->audio.delay -= count - 1;
+        cycles -= count;
+        if (!context->audio.delay) {
+            float left = 0.f, right = 0.f;
+            if (context->audio.control.enabled) {
+                cgbl_audio_channel_1_sample(context, &left, &right);
+                cgbl_audio_channel_2_sample(context, &left, &right);
+                cgbl_audio_channel_3_sample(context, &left, &right);
+                cgbl_audio_channel_4_sample(context, &left, &right);
+                left *= (context->audio.volume.left + 1.f) / 8.f;
+                right *= (context->audio.volume.right + 1.f) / 8.f;
+            }
+            context->audio.sample[context->audio.index++] = ((left / 4.f) + (right / 4.f)) / 2.f;
+            if (context->audio.index >= CGBL_LENGTH(context->audio.sample)) {
+                context->audio.index = 0;
+            }
+            context->audio.delay = 88;
+        }
+        --context->audio.delay;
     }
-    --audio.delay;
 }
 
-void cgbl_audio_write(uint16_t address, uint8_t data) {
+void cgbl_audio_write(cgbl_context_t *const context, uint16_t address, uint8_t data) {
     switch (address) {
     case CGBL_AUDIO_CHANNEL_1_ENVELOPE:
-        if (audio.control.enabled) {
-            audio.channel_1.envelope.raw = data;
+        if (context->audio.control.enabled) {
+            context->audio.channel_1.envelope.raw = data;
         }
         break;
     case CGBL_AUDIO_CHANNEL_1_FREQUENCY_HIGH:
-        if (audio.control.enabled) {
-            audio.channel_1.frequency.high.raw = data | 0x38;
-            cgbl_audio_channel_1_trigger();
+        if (context->audio.control.enabled) {
+            context->audio.channel_1.frequency.high.raw = data | 0x38;
+            cgbl_audio_channel_1_trigger(context);
         }
         break;
     case CGBL_AUDIO_CHANNEL_1_FREQUENCY_LOW:
-        if (audio.control.enabled) {
-            audio.channel_1.frequency.low = data;
+        if (context->audio.control.enabled) {
+            context->audio.channel_1.frequency.low = data;
         }
         break;
     case CGBL_AUDIO_CHANNEL_1_LENGTH:
-        if (audio.control.enabled) {
-            audio.channel_1.length.raw = data;
+        if (context->audio.control.enabled) {
+            context->audio.channel_1.length.raw = data;
         }
         break;
     case CGBL_AUDIO_CHANNEL_1_SWEEP:
-        if (audio.control.enabled) {
-            audio.channel_1.sweep.raw = data | 0x80;
+        if (context->audio.control.enabled) {
+            context->audio.channel_1.sweep.raw = data | 0x80;
         }
         break;
     case CGBL_AUDIO_CHANNEL_2_ENVELOPE:
-        if (audio.control.enabled) {
-            audio.channel_2.envelope.raw = data;
+        if (context->audio.control.enabled) {
+            context->audio.channel_2.envelope.raw = data;
         }
         break;
     case CGBL_AUDIO_CHANNEL_2_FREQUENCY_HIGH:
-        if (audio.control.enabled) {
-            audio.channel_2.frequency.high.raw = data | 0x38;
-            cgbl_audio_channel_2_trigger();
+        if (context->audio.control.enabled) {
+            context->audio.channel_2.frequency.high.raw = data | 0x38;
+            cgbl_audio_channel_2_trigger(context);
         }
         break;
     case CGBL_AUDIO_CHANNEL_2_FREQUENCY_LOW:
-        if (audio.control.enabled) {
-            audio.channel_2.frequency.low = data;
+        if (context->audio.control.enabled) {
+            context->audio.channel_2.frequency.low = data;
         }
         break;
     case CGBL_AUDIO_CHANNEL_2_LENGTH:
-        if (audio.control.enabled) {
-            audio.channel_2.length.raw = data;
+        if (context->audio.control.enabled) {
+            context->audio.channel_2.length.raw = data;
         }
         break;
     case CGBL_AUDIO_CHANNEL_3_CONTROL:
-        if (audio.control.enabled) {
-            audio.channel_3.control.raw = data | 0x7F;
-            if (!audio.channel_3.control.enabled) {
-                audio.control.channel_3_enabled = false;
+        if (context->audio.control.enabled) {
+            context->audio.channel_3.control.raw = data | 0x7F;
+            if (!context->audio.channel_3.control.enabled) {
+                context->audio.control.channel_3_enabled = false;
             }
         }
         break;
     case CGBL_AUDIO_CHANNEL_3_FREQUENCY_HIGH:
-        if (audio.control.enabled) {
-            audio.channel_3.frequency.high.raw = data | 0x38;
-            cgbl_audio_channel_3_trigger();
+        if (context->audio.control.enabled) {
+            context->audio.channel_3.frequency.high.raw = data | 0x38;
+            cgbl_audio_channel_3_trigger(context);
         }
         break;
     case CGBL_AUDIO_CHANNEL_3_FREQUENCY_LOW:
-        if (audio.control.enabled) {
-            audio.channel_3.frequency.low = data;
+        if (context->audio.control.enabled) {
+            context->audio.channel_3.frequency.low = data;
         }
         break;
     case CGBL_AUDIO_CHANNEL_3_LENGTH:
-        if (audio.control.enabled) {
-            audio.channel_3.length = data;
+        if (context->audio.control.enabled) {
+            context->audio.channel_3.length = data;
         }
         break;
     case CGBL_AUDIO_CHANNEL_3_LEVEL:
-        if (audio.control.enabled) {
-            audio.channel_3.level.raw = data | 0x9F;
+        if (context->audio.control.enabled) {
+            context->audio.channel_3.level.raw = data | 0x9F;
         }
         break;
     case CGBL_AUDIO_CHANNEL_4_CONTROL:
-        if (audio.control.enabled) {
-            audio.channel_4.control.raw = data | 0x3F;
-            cgbl_audio_channel_4_trigger();
+        if (context->audio.control.enabled) {
+            context->audio.channel_4.control.raw = data | 0x3F;
+            cgbl_audio_channel_4_trigger(context);
         }
         break;
     case CGBL_AUDIO_CHANNEL_4_ENVELOPE:
-        if (audio.control.enabled) {
-            audio.channel_4.envelope.raw = data;
+        if (context->audio.control.enabled) {
+            context->audio.channel_4.envelope.raw = data;
         }
         break;
     case CGBL_AUDIO_CHANNEL_4_FREQUENCY:
-        if (audio.control.enabled) {
-            audio.channel_4.frequency.raw = data;
+        if (context->audio.control.enabled) {
+            context->audio.channel_4.frequency.raw = data;
         }
         break;
     case CGBL_AUDIO_CHANNEL_4_LENGTH:
-        if (audio.control.enabled) {
-            audio.channel_4.length.raw = data | 0xC0;
+        if (context->audio.control.enabled) {
+            context->audio.channel_4.length.raw = data | 0xC0;
         }
         break;
     case CGBL_AUDIO_CONTROL:
-        audio.control.raw |= data & 0x80;
-        if (!audio.control.enabled) {
-            memset(&audio.channel_1, 0, sizeof(audio.channel_1));
-            memset(&audio.channel_2, 0, sizeof(audio.channel_2));
-            memset(&audio.channel_3, 0, sizeof(audio.channel_3));
-            memset(&audio.channel_4, 0, sizeof(audio.channel_4));
-            memset(audio.ram, 0, sizeof(audio.ram));
-            memset(audio.sample, 0, sizeof(audio.sample));
+        context->audio.control.raw |= data & 0x80;
+        if (!context->audio.control.enabled) {
+            memset(&context->audio.channel_1, 0, sizeof(context->audio.channel_1));
+            memset(&context->audio.channel_2, 0, sizeof(context->audio.channel_2));
+            memset(&context->audio.channel_3, 0, sizeof(context->audio.channel_3));
+            memset(&context->audio.channel_4, 0, sizeof(context->audio.channel_4));
+            memset(context->audio.ram, 0, sizeof(context->audio.ram));
+            memset(context->audio.sample, 0, sizeof(context->audio.sample));
         }
         break;
     case CGBL_AUDIO_MIXER:
-        if (audio.control.enabled) {
-            audio.mixer.raw = data;
+        if (context->audio.control.enabled) {
+            context->audio.mixer.raw = data;
         }
         break;
     case CGBL_AUDIO_RAM_BEGIN ... CGBL_AUDIO_RAM_END:
-        if (audio.control.enabled) {
-            audio.ram[address - CGBL_AUDIO_RAM_BEGIN] = data;
+        if (context->audio.control.enabled) {
+            context->audio.ram[address - CGBL_AUDIO_RAM_BEGIN] = data;
         }
         break;
     case CGBL_AUDIO_VOLUME:
-        if (audio.control.enabled) {
-            audio.volume.raw = data;
+        if (context->audio.control.enabled) {
+            context->audio.volume.raw = data;
         }
         break;
     default:
@@ -30,16 +30,223 @@
 #define CGBL_AUDIO_MIXER 0xFF25
 #define CGBL_AUDIO_RAM_BEGIN 0xFF30
 #define CGBL_AUDIO_RAM_END 0xFF3F
-#define CGBL_AUDIO_SAMPLES 798
 #define CGBL_AUDIO_VOLUME 0xFF24
 
 #define CGBL_AUDIO_RAM_WIDTH CGBL_WIDTH(CGBL_AUDIO_RAM_BEGIN, CGBL_AUDIO_RAM_END)
 
-void cgbl_audio_interrupt(void);
-uint8_t cgbl_audio_read(uint16_t address);
-void cgbl_audio_reset(void);
-const float (*cgbl_audio_sample(void))[CGBL_AUDIO_SAMPLES];
-void cgbl_audio_step(void);
-void cgbl_audio_write(uint16_t address, uint8_t data);
+typedef struct {
+    uint32_t cycle;
+    uint16_t delay;
+    uint32_t index;
+    uint8_t ram[CGBL_AUDIO_RAM_WIDTH];
+    float sample[CGBL_AUDIO_SAMPLES];
+    struct {
+        uint32_t delay;
+        uint8_t position;
+        uint8_t volume;
+        union {
+            uint8_t raw;
+            struct {
+                uint8_t period : 3;
+                uint8_t direction : 1;
+                uint8_t volume : 4;
+            };
+        } envelope;
+        struct {
+            uint8_t low;
+            union {
+                uint8_t raw;
+                struct {
+                    uint8_t period : 3;
+                    uint8_t : 3;
+                    uint8_t enabled : 1;
+                    uint8_t trigger : 1;
+                };
+            } high;
+        } frequency;
+        union {
+            uint8_t raw;
+            struct {
+                uint8_t timer : 6;
+                uint8_t duty : 2;
+            };
+        } length;
+        union {
+            uint8_t raw;
+            struct {
+                uint8_t shift : 3;
+                uint8_t direction : 1;
+                uint8_t period : 3;
+            };
+        } sweep;
+        struct {
+            uint8_t length;
+            struct {
+                uint8_t period;
+            } envelope;
+            struct {
+                bool enabled;
+                uint16_t frequency;
+                uint8_t period;
+            } sweep;
+        } timer;
+    } channel_1;
+    struct {
+        uint32_t delay;
+        uint8_t position;
+        uint8_t volume;
+        union {
+            uint8_t raw;
+            struct {
+                uint8_t period : 3;
+                uint8_t direction : 1;
+                uint8_t volume : 4;
+            };
+        } envelope;
+        struct {
+            uint8_t low;
+            union {
+                uint8_t raw;
+                struct {
+                    uint8_t period : 3;
+                    uint8_t : 3;
+                    uint8_t enabled : 1;
+                    uint8_t trigger : 1;
+                };
+            } high;
+        } frequency;
+        union {
+            uint8_t raw;
+            struct {
+                uint8_t timer : 6;
+                uint8_t duty : 2;
+            };
+        } length;
+        struct {
+            uint8_t length;
+            struct {
+                uint8_t period;
+            } envelope;
+        } timer;
+    } channel_2;
+    struct {
+        uint32_t delay;
+        uint8_t length;
+        uint8_t position;
+        union {
+            uint8_t raw;
+            struct {
+                uint8_t : 7;
+                uint8_t enabled : 1;
+            };
+        } control;
+        struct {
+            uint8_t low;
+            union {
+                uint8_t raw;
+                struct {
+                    uint8_t period : 3;
+                    uint8_t : 3;
+                    uint8_t enabled : 1;
+                    uint8_t trigger : 1;
+                };
+            } high;
+        } frequency;
+        union {
+            uint8_t raw;
+            struct {
+                uint8_t : 5;
+                uint8_t output : 2;
+            };
+        } level;
+        struct {
+            uint16_t length;
+        } timer;
+    } channel_3;
+    struct {
+        uint32_t delay;
+        uint16_t sample;
+        uint8_t volume;
+        union {
+            uint8_t raw;
+            struct {
+                struct {
+                    uint8_t : 6;
+                    uint8_t enabled : 1;
+                    uint8_t trigger : 1;
+                };
+            };
+        } control;
+        union {
+            uint8_t raw;
+            struct {
+                uint8_t period : 3;
+                uint8_t direction : 1;
+                uint8_t volume : 4;
+            };
+        } envelope;
+        union {
+            uint8_t raw;
+            struct {
+                uint8_t divider : 3;
+                uint8_t width : 1;
+                uint8_t shift : 4;
+            };
+        } frequency;
+        union {
+            uint8_t raw;
+            struct {
+                uint8_t timer : 6;
+                uint8_t : 2;
+            };
+        } length;
+        struct {
+            uint8_t length;
+            struct {
+                uint8_t period;
+            } envelope;
+        } timer;
+    } channel_4;
+    union {
+        uint8_t raw;
+        struct {
+            uint8_t channel_1_enabled : 1;
+            uint8_t channel_2_enabled : 1;
+            uint8_t channel_3_enabled : 1;
+            uint8_t channel_4_enabled : 1;
+            uint8_t : 3;
+            uint8_t enabled : 1;
+        };
+    } control;
+    union {
+        uint8_t raw;
+        struct {
+            uint8_t channel_1_right : 1;
+            uint8_t channel_2_right : 1;
+            uint8_t channel_3_right : 1;
+            uint8_t channel_4_right : 1;
+            uint8_t channel_1_left : 1;
+            uint8_t channel_2_left : 1;
+            uint8_t channel_3_left : 1;
+            uint8_t channel_4_left : 1;
+        };
+    } mixer;
+    union {
+        uint8_t raw;
+        struct {
+            uint8_t right : 3;
+            uint8_t : 1;
+            uint8_t left : 3;
+            uint8_t : 1;
+        };
+    } volume;
+} cgbl_audio_t;
+
+void cgbl_audio_interrupt(cgbl_context_t *const context);
+uint8_t cgbl_audio_read(cgbl_context_t *const context, uint16_t address);
+void cgbl_audio_reset(cgbl_context_t *const context);
+const float (*cgbl_audio_sample(cgbl_context_t *const context))[CGBL_AUDIO_SAMPLES];
+void cgbl_audio_step(cgbl_context_t *const context, uint32_t cycles);
+void cgbl_audio_write(cgbl_context_t *const context, uint16_t address, uint8_t data);
 
 #endif /* CGBL_AUDIO_H_ */
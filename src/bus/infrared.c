@@ -4,28 +4,15 @@
  */
 
 #include "infrared.h"
+#include "context.h"
 #include <string.h>
 
-static struct {
-    bool overflow;
-    uint16_t divider;
-    union {
-        uint8_t raw;
-        struct {
-            uint8_t emitting : 1;
-            uint8_t receiving : 1;
-            uint8_t : 4;
-            uint8_t enabled : 2;
-        };
-    } control;
-} infrared = {};
-
-uint8_t cgbl_infrared_read(uint16_t address) {
+uint8_t cgbl_infrared_read(cgbl_context_t *const context, uint16_t address) {
     uint8_t result = 0xFF;
     switch (address) {
     case CGBL_INFRARED_CONTROL:
-        if (cgbl_bus_mode() == CGBL_MODE_CGB) {
-            result = infrared.control.raw;
+        if (cgbl_bus_mode(context) == CGBL_MODE_CGB) {
+            result = context->infrared.control.raw;
         }
         break;
     default:
@@ -34,28 +21,26 @@ uint8_t cgbl_infrared_read(uint16_t address) {
     return result;
 }
 
-void cgbl_infrared_reset(void) {
-    memset(&infrared, 0, sizeof(infrared));
-    infrared.control.raw = 0x3E;
+void cgbl_infrared_reset(cgbl_context_t *const context) {
+    memset(&context->infrared, 0, sizeof(context->infrared));
+    context->infrared.control.raw = 0x3E;
 }
 
-void cgbl_infrared_step(void) {
-    if ((cgbl_bus_mode() == CGBL_MODE_CGB) && infrared.control.enabled == 3) {
-        bool overflow = ++infrared.divider & 512;
-        if (overflow && !infrared.overflow) {
-            infrared.control.receiving = !infrared.control.emitting;
+void cgbl_infrared_step(cgbl_context_t *const context, uint32_t cycles) {
+    if ((cgbl_bus_mode(context) == CGBL_MODE_CGB) && context->infrared.control.enabled == 3) {
+        if (cycles >= cgbl_bus_edge(context->infrared.divider, 512)) {
+            context->infrared.control.receiving = !context->infrared.control.emitting;
         }
-        infrared.overflow = overflow;
+        context->infrared.divider += cycles;
     }
 }
 
-void cgbl_infrared_write(uint16_t address, uint8_t data) {
+void cgbl_infrared_write(cgbl_context_t *const context, uint16_t address, uint8_t data) {
     switch (address) {
     case CGBL_INFRARED_CONTROL:
-        if (cgbl_bus_mode() == CGBL_MODE_CGB) {
-            infrared.control.raw = (data & 0xC1) | 0x3E;
-            infrared.divider = 0;
-            infrared.overflow = false;
+        if (cgbl_bus_mode(context) == CGBL_MODE_CGB) {
+            context->infrared.control.raw = (data & 0xC1) | 0x3E;
+            context->infrared.divider = 0;
         }
         break;
     default:
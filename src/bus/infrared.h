@@ -10,9 +10,22 @@
 
 #define CGBL_INFRARED_CONTROL 0xFF56
 
-uint8_t cgbl_infrared_read(uint16_t address);
-void cgbl_infrared_reset(void);
-void cgbl_infrared_step(void);
-void cgbl_infrared_write(uint16_t address, uint8_t data);
+typedef struct {
+    uint16_t divider;
+    union {
+        uint8_t raw;
+        struct {
+            uint8_t emitting : 1;
+            uint8_t receiving : 1;
+            uint8_t : 4;
+            uint8_t enabled : 2;
+        };
+    } control;
+} cgbl_infrared_t;
+
+uint8_t cgbl_infrared_read(cgbl_context_t *const context, uint16_t address);
+void cgbl_infrared_reset(cgbl_context_t *const context);
+void cgbl_infrared_step(cgbl_context_t *const context, uint32_t cycles);
+void cgbl_infrared_write(cgbl_context_t *const context, uint16_t address, uint8_t data);
 
 #endif /* CGBL_INFRARED_H_ */
@@ -4,33 +4,17 @@
  */
 
 #include "input.h"
+#include "context.h"
 #include "processor.h"
 #include <string.h>
 
-static struct {
-    bool overflow;
-    uint16_t divider;
-    struct {
-        bool current[CGBL_BUTTON_MAX];
-        bool next[CGBL_BUTTON_MAX];
-    } button;
-    union {
-        uint8_t raw;
-        struct {
-            uint8_t pressed : 4;
-            uint8_t direction : 1;
-            uint8_t button : 1;
-        };
-    } state;
-} input = {};
+bool (*cgbl_input_button(cgbl_context_t *const context)) [CGBL_BUTTON_MAX] { return &context->input.button.next; }
 
-bool (*cgbl_input_button(void)) [CGBL_BUTTON_MAX] { return &input.button.next; }
-
-uint8_t cgbl_input_read(uint16_t address) {
+uint8_t cgbl_input_read(cgbl_context_t *const context, uint16_t address) {
     uint8_t result = 0xFF;
     switch (address) {
     case CGBL_INPUT_STATE:
-        result = input.state.raw;
+        result = context->input.state.raw;
         break;
     default:
         break;
@@ -38,43 +22,48 @@ uint8_t cgbl_input_read(uint16_t address) {
     return result;
 }
 
-void cgbl_input_reset(void) {
-    memset(&input, 0, sizeof(input));
-    input.state.raw = 0xCF;
+void cgbl_input_reset(cgbl_context_t *const context) {
+    memset(&context->input, 0, sizeof(context->input));
+    context->input.state.raw = 0xCF;
 }
 
-void cgbl_input_step(void) {
-    bool overflow = ++input.divider & 4096;
-    if (overflow && !input.overflow) {
+void cgbl_input_step(cgbl_context_t *const context, uint32_t cycles) {
+    uint32_t edge = 0;
+    while (cycles >= (edge = cgbl_bus_edge(context->input.divider, 4096))) {
         bool changed = false;
+        cycles -= edge;
+        context->input.divider += edge;
         for (cgbl_button_e button = 0; button < CGBL_BUTTON_MAX; ++button) {
-            if (input.button.current[button] != input.button.next[button]) {
-                input.button.current[button] = input.button.next[button];
+            if (context->input.button.current[button] != context->input.button.next[button]) {
+                context->input.button.current[button] = context->input.button.next[button];
                 changed = true;
             }
         }
         if (changed) {
-            cgbl_processor_interrupt(CGBL_INTERRUPT_INPUT);
+            cgbl_processor_interrupt(context, CGBL_INTERRUPT_INPUT);
         }
     }
-    input.overflow = overflow;
+    context->input.divider += cycles;
+    cgbl_bus_schedule(context, CGBL_EVENT_INPUT,
+                      memcmp(context->input.button.current, context->input.button.next, sizeof(context->input.button.current)) ?
+                          (edge - cycles - 1) : UINT32_MAX);
 }
 
-void cgbl_input_write(uint16_t address, uint8_t data) {
+void cgbl_input_write(cgbl_context_t *const context, uint16_t address, uint8_t data) {
     switch (address) {
     case CGBL_INPUT_STATE:
-        input.state.raw = data | 0xCF;
-        if (!input.state.button) {
+        context->input.state.raw = data | 0xCF;
+        if (!context->input.state.button) {
             for (cgbl_button_e button = CGBL_BUTTON_A; button <= CGBL_BUTTON_START; ++button) {
-                if (input.button.current[button]) {
-                    input.state.pressed &= ~(1 << (button - CGBL_BUTTON_A));
+                if (context->input.button.current[button]) {
+                    context->input.state.pressed &= ~(1 << (button - CGBL_BUTTON_A));
                 }
             }
         }
-        if (!input.state.direction) {
+        if (!context->input.state.direction) {
             for (cgbl_button_e button = CGBL_BUTTON_RIGHT; button <= CGBL_BUTTON_DOWN; ++button) {
-                if (input.button.current[button]) {
-                    input.state.pressed &= ~(1 << (button - CGBL_BUTTON_RIGHT));
+                if (context->input.button.current[button]) {
+                    context->input.state.pressed &= ~(1 << (button - CGBL_BUTTON_RIGHT));
                 }
             }
         }
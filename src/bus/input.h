@@ -10,22 +10,26 @@
 
 #define CGBL_INPUT_STATE 0xFF00
 
-typedef enum {
-    CGBL_BUTTON_A = 0,
-    CGBL_BUTTON_B,
-    CGBL_BUTTON_SELECT,
-    CGBL_BUTTON_START,
-    CGBL_BUTTON_RIGHT,
-    CGBL_BUTTON_LEFT,
-    CGBL_BUTTON_UP,
-    CGBL_BUTTON_DOWN,
-    CGBL_BUTTON_MAX
-} cgbl_button_e;
+typedef struct {
+    uint16_t divider;
+    struct {
+        bool current[CGBL_BUTTON_MAX];
+        bool next[CGBL_BUTTON_MAX];
+    } button;
+    union {
+        uint8_t raw;
+        struct {
+            uint8_t pressed : 4;
+            uint8_t direction : 1;
+            uint8_t button : 1;
+        };
+    } state;
+} cgbl_input_t;
 
-bool (*cgbl_input_button(void))[CGBL_BUTTON_MAX];
-uint8_t cgbl_input_read(uint16_t address);
-void cgbl_input_reset(void);
-void cgbl_input_step(void);
-void cgbl_input_write(uint16_t address, uint8_t data);
+bool (*cgbl_input_button(cgbl_context_t *const context))[CGBL_BUTTON_MAX];
+uint8_t cgbl_input_read(cgbl_context_t *const context, uint16_t address);
+void cgbl_input_reset(cgbl_context_t *const context);
+void cgbl_input_step(cgbl_context_t *const context, uint32_t cycles);
+void cgbl_input_write(cgbl_context_t *const context, uint16_t address, uint8_t data);
 
 #endif /* CGBL_INPUT_H_ */
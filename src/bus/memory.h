@@ -25,8 +25,24 @@
 #define CGBL_MEMORY_RAM_HIGH_WIDTH CGBL_WIDTH(CGBL_MEMORY_RAM_HIGH_BEGIN, CGBL_MEMORY_RAM_HIGH_END)
 #define CGBL_MEMORY_RAM_WORK_WIDTH CGBL_WIDTH(CGBL_MEMORY_RAM_WORK_0_BEGIN, CGBL_MEMORY_RAM_WORK_0_END)
 
-uint8_t cgbl_memory_read(uint16_t address);
-cgbl_error_e cgbl_memory_reset(const cgbl_bank_t *const rom, cgbl_bank_t *const ram);
-void cgbl_memory_write(uint16_t address, uint8_t data);
+typedef struct {
+    struct {
+        uint8_t ram[CGBL_MEMORY_RAM_HIGH_WIDTH];
+    } high;
+    struct {
+        union {
+            uint8_t raw;
+            struct {
+                uint8_t select : 3;
+            };
+        } bank;
+        uint8_t ram[8][CGBL_MEMORY_RAM_WORK_WIDTH];
+    } work;
+} cgbl_memory_t;
+
+void cgbl_memory_map(cgbl_context_t *const context);
+uint8_t cgbl_memory_read(cgbl_context_t *const context, uint16_t address);
+cgbl_error_e cgbl_memory_reset(cgbl_context_t *const context, const cgbl_bank_t *const rom, cgbl_bank_t *const ram);
+void cgbl_memory_write(cgbl_context_t *const context, uint16_t address, uint8_t data);
 
 #endif /* CGBL_MEMORY_H_ */
@@ -4,6 +4,7 @@
  */
 
 #include "bootloader.h"
+#include "context.h"
 #include <string.h>
 
 static const uint8_t BOOTROM[][CGBL_BOOTLOADER_ROM_WIDTH] = { {
@@ -13,24 +14,27 @@ static const uint8_t BOOTROM[][CGBL_BOOTLOADER_ROM_WIDTH] = { {
 #embed "bootloader/bootrom_1.bin"
                                                               } };
 
-static struct {
-    bool enabled;
-} bootloader = {};
+bool cgbl_bootloader_enabled(cgbl_context_t *const context) {
+    return context->bootloader.enabled;
+}
 
-bool cgbl_bootloader_enabled(void) {
-    return bootloader.enabled;
+void cgbl_bootloader_map(cgbl_context_t *const context) {
+    if (context->bootloader.enabled) {
+        cgbl_bus_map(context, CGBL_BOOTLOADER_ROM_0_BEGIN, CGBL_BOOTLOADER_ROM_0_END, BOOTROM[0], NULL);
+        cgbl_bus_map(context, CGBL_BOOTLOADER_ROM_1_BEGIN, CGBL_BOOTLOADER_ROM_1_END, BOOTROM[1], NULL);
+    }
 }
 
-uint8_t cgbl_bootloader_read(uint16_t address) {
+uint8_t cgbl_bootloader_read(cgbl_context_t *const context, uint16_t address) {
     uint8_t result = 0xFF;
     switch (address) {
     case CGBL_BOOTLOADER_ROM_0_BEGIN ... CGBL_BOOTLOADER_ROM_0_END:
-        if (bootloader.enabled) {
+        if (context->bootloader.enabled) {
             result = BOOTROM[0][address - CGBL_BOOTLOADER_ROM_0_BEGIN];
         }
         break;
     case CGBL_BOOTLOADER_ROM_1_BEGIN ... CGBL_BOOTLOADER_ROM_1_END:
-        if (bootloader.enabled) {
+        if (context->bootloader.enabled) {
             result = BOOTROM[1][address - CGBL_BOOTLOADER_ROM_1_BEGIN];
         }
         break;
@@ -40,16 +44,17 @@ uint8_t cgbl_bootloader_read(uint16_t address) {
     return result;
 }
 
-void cgbl_bootloader_reset(void) {
-    memset(&bootloader, 0, sizeof(bootloader));
-    bootloader.enabled = true;
+void cgbl_bootloader_reset(cgbl_context_t *const context) {
+    memset(&context->bootloader, 0, sizeof(context->bootloader));
+    context->bootloader.enabled = true;
 }
 
-void cgbl_bootloader_write(uint16_t address, uint8_t data) {
+void cgbl_bootloader_write(cgbl_context_t *const context, uint16_t address, uint8_t data) {
     switch (address) {
     case CGBL_BOOTLOADER_DISABLE:
-        if (bootloader.enabled && data) {
-            bootloader.enabled = false;
+        if (context->bootloader.enabled && data) {
+            context->bootloader.enabled = false;
+            cgbl_memory_map(context);
         }
         break;
     default:
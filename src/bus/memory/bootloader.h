@@ -16,9 +16,14 @@
 
 #define CGBL_BOOTLOADER_ROM_WIDTH CGBL_WIDTH(CGBL_BOOTLOADER_ROM_1_BEGIN, CGBL_BOOTLOADER_ROM_1_END)
 
-bool cgbl_bootloader_enabled(void);
-uint8_t cgbl_bootloader_read(uint16_t address);
-void cgbl_bootloader_reset(void);
-void cgbl_bootloader_write(uint16_t address, uint8_t data);
+typedef struct {
+    bool enabled;
+} cgbl_bootloader_t;
+
+bool cgbl_bootloader_enabled(cgbl_context_t *const context);
+void cgbl_bootloader_map(cgbl_context_t *const context);
+uint8_t cgbl_bootloader_read(cgbl_context_t *const context, uint16_t address);
+void cgbl_bootloader_reset(cgbl_context_t *const context);
+void cgbl_bootloader_write(cgbl_context_t *const context, uint16_t address, uint8_t data);
 
 #endif /* CGBL_BOOTLOADER_H_ */
@@ -3,6 +3,7 @@
  * SPDX-License-Identifier: MIT
  */
 
+#include "context.h"
 #include "mapper_0.h"
 #include "mapper_1.h"
 #include "mapper_2.h"
@@ -12,39 +13,6 @@
 #include <stdio.h>
 #include <string.h>
 
-typedef struct __attribute__((packed)) {
-    union {
-        uint8_t raw;
-        uint8_t counter : 6;
-    } second;
-    union {
-        uint8_t raw;
-        uint8_t counter : 6;
-    } minute;
-    union {
-        uint8_t raw;
-        uint8_t counter : 5;
-    } hour;
-    union {
-        struct {
-            uint16_t counter : 9;
-            uint16_t : 5;
-            uint16_t halt : 1;
-            uint16_t carry : 1;
-        };
-        struct {
-            uint8_t low;
-            uint8_t high;
-        };
-    } day;
-} cgbl_clock_t;
-
-typedef struct {
-    uint8_t (*read)(uint16_t address);
-    void (*reset)(void);
-    void (*write)(uint16_t address, uint8_t data);
-} cgbl_mapper_t;
-
 typedef struct __attribute__((packed)) {
     uint32_t magic;
     uint32_t length;
@@ -62,75 +30,56 @@ typedef struct __attribute__((packed)) {
 static const struct {
     uint8_t type;
     cgbl_mapper_t mapper;
-} MAPPER[] = { { -1, { NULL, NULL, NULL } },
-               { 0, { cgbl_mapper_0_read, NULL, cgbl_mapper_0_write } },
-               { 1, { cgbl_mapper_1_read, cgbl_mapper_1_reset, cgbl_mapper_1_write } },
-               { 2, { cgbl_mapper_1_read, cgbl_mapper_1_reset, cgbl_mapper_1_write } },
-               { 3, { cgbl_mapper_1_read, cgbl_mapper_1_reset, cgbl_mapper_1_write } },
-               { 5, { cgbl_mapper_2_read, cgbl_mapper_2_reset, cgbl_mapper_2_write } },
-               { 6, { cgbl_mapper_2_read, cgbl_mapper_2_reset, cgbl_mapper_2_write } },
-               { 8, { cgbl_mapper_0_read, NULL, cgbl_mapper_0_write } },
-               { 9, { cgbl_mapper_0_read, NULL, cgbl_mapper_0_write } },
-               { 15, { cgbl_mapper_3_read, cgbl_mapper_3_reset, cgbl_mapper_3_write } },
-               { 16, { cgbl_mapper_3_read, cgbl_mapper_3_reset, cgbl_mapper_3_write } },
-               { 17, { cgbl_mapper_3_read, cgbl_mapper_3_reset, cgbl_mapper_3_write } },
-               { 18, { cgbl_mapper_3_read, cgbl_mapper_3_reset, cgbl_mapper_3_write } },
-               { 19, { cgbl_mapper_3_read, cgbl_mapper_3_reset, cgbl_mapper_3_write } },
-               { 25, { cgbl_mapper_5_read, cgbl_mapper_5_reset, cgbl_mapper_5_write } },
-               { 26, { cgbl_mapper_5_read, cgbl_mapper_5_reset, cgbl_mapper_5_write } },
-               { 27, { cgbl_mapper_5_read, cgbl_mapper_5_reset, cgbl_mapper_5_write } },
-               { 28, { cgbl_mapper_5_read, cgbl_mapper_5_reset, cgbl_mapper_5_write } },
-               { 29, { cgbl_mapper_5_read, cgbl_mapper_5_reset, cgbl_mapper_5_write } },
-               { 30, { cgbl_mapper_5_read, cgbl_mapper_5_reset, cgbl_mapper_5_write } } };
+} MAPPER[] = { { -1, { NULL, NULL, NULL, NULL } },
+               { 0, { cgbl_mapper_0_map, cgbl_mapper_0_read, NULL, cgbl_mapper_0_write } },
+               { 1, { cgbl_mapper_1_map, cgbl_mapper_1_read, cgbl_mapper_1_reset, cgbl_mapper_1_write } },
+               { 2, { cgbl_mapper_1_map, cgbl_mapper_1_read, cgbl_mapper_1_reset, cgbl_mapper_1_write } },
+               { 3, { cgbl_mapper_1_map, cgbl_mapper_1_read, cgbl_mapper_1_reset, cgbl_mapper_1_write } },
+               { 5, { cgbl_mapper_2_map, cgbl_mapper_2_read, cgbl_mapper_2_reset, cgbl_mapper_2_write } },
+               { 6, { cgbl_mapper_2_map, cgbl_mapper_2_read, cgbl_mapper_2_reset, cgbl_mapper_2_write } },
+               { 8, { cgbl_mapper_0_map, cgbl_mapper_0_read, NULL, cgbl_mapper_0_write } },
+               { 9, { cgbl_mapper_0_map, cgbl_mapper_0_read, NULL, cgbl_mapper_0_write } },
+               { 15, { cgbl_mapper_3_map, cgbl_mapper_3_read, cgbl_mapper_3_reset, cgbl_mapper_3_write } },
+               { 16, { cgbl_mapper_3_map, cgbl_mapper_3_read, cgbl_mapper_3_reset, cgbl_mapper_3_write } },
+               { 17, { cgbl_mapper_3_map, cgbl_mapper_3_read, cgbl_mapper_3_reset, cgbl_mapper_3_write } },
+               { 18, { cgbl_mapper_3_map, cgbl_mapper_3_read, cgbl_mapper_3_reset, cgbl_mapper_3_write } },
+               { 19, { cgbl_mapper_3_map, cgbl_mapper_3_read, cgbl_mapper_3_reset, cgbl_mapper_3_write } },
+               { 25, { cgbl_mapper_5_map, cgbl_mapper_5_read, cgbl_mapper_5_reset, cgbl_mapper_5_write } },
+               { 26, { cgbl_mapper_5_map, cgbl_mapper_5_read, cgbl_mapper_5_reset, cgbl_mapper_5_write } },
+               { 27, { cgbl_mapper_5_map, cgbl_mapper_5_read, cgbl_mapper_5_reset, cgbl_mapper_5_write } },
+               { 28, { cgbl_mapper_5_map, cgbl_mapper_5_read, cgbl_mapper_5_reset, cgbl_mapper_5_write } },
+               { 29, { cgbl_mapper_5_map, cgbl_mapper_5_read, cgbl_mapper_5_reset, cgbl_mapper_5_write } },
+               { 30, { cgbl_mapper_5_map, cgbl_mapper_5_read, cgbl_mapper_5_reset, cgbl_mapper_5_write } } };
 
 static const uint16_t RAM[] = { 1, 1, 1, 4, 16, 8 };
 
 static const uint16_t ROM[] = { 2, 4, 8, 16, 32, 64, 128, 256, 512 };
 
-static struct {
-    uint8_t hash;
-    char title[12];
-    const cgbl_mapper_t *mapper;
-    struct {
-        uint32_t delay;
-        cgbl_clock_t latch;
-    } clock;
-    struct {
-        uint16_t count;
-        uint8_t *data;
-        cgbl_clock_t *clock;
-    } ram;
-    struct {
-        uint16_t count;
-        const uint8_t *data;
-    } rom;
-} cartridge = {};
-
-static void cgbl_cartridge_hash_reset(void) {
-    const char *title = (const char *)&cartridge.rom.data[CGBL_CARTRIDGE_HEADER_TITLE_BEGIN];
+static void cgbl_cartridge_hash_reset(cgbl_context_t *const context) {
+    const char *title = (const char *)&context->cartridge.rom.data[CGBL_CARTRIDGE_HEADER_TITLE_BEGIN];
     for (uint8_t index = 0; index < 16; ++index) {
-        cartridge.hash += title[index];
+        context->cartridge.hash += title[index];
     }
 }
 
-static cgbl_error_e cgbl_cartridge_mapper_reset(void) {
-    uint8_t type = cartridge.rom.data[CGBL_CARTRIDGE_HEADER_MAPPER];
+static cgbl_error_e cgbl_cartridge_mapper_reset(cgbl_context_t *const context) {
+    uint8_t type = context->cartridge.rom.data[CGBL_CARTRIDGE_HEADER_MAPPER];
     for (uint8_t index = 1; index < CGBL_LENGTH(MAPPER); ++index) {
         if (type == MAPPER[index].type) {
-            cartridge.mapper = &MAPPER[index].mapper;
-            if (cartridge.mapper->reset) {
-                cartridge.mapper->reset();
+            context->cartridge.mapper = &MAPPER[index].mapper;
+            if (context->cartridge.mapper->reset) {
+                context->cartridge.mapper->reset(context);
             }
             break;
         }
     }
-    if (!cartridge.mapper) {
+    if (!context->cartridge.mapper) {
         return CGBL_ERROR("Unsupported mapper: %02X", type);
     }
     return CGBL_SUCCESS;
 }
 
-static cgbl_error_e cgbl_cartridge_ram_reset(cgbl_bank_t *const bank) {
+static cgbl_error_e cgbl_cartridge_ram_reset(cgbl_context_t *const context, cgbl_bank_t *const bank) {
     uint8_t count = 0;
     uint32_t length = 0;
     cgbl_error_e result = CGBL_SUCCESS;
@@ -138,11 +87,11 @@ static cgbl_error_e cgbl_cartridge_ram_reset(cgbl_bank_t *const bank) {
     if (bank->length < sizeof(*ram)) {
         return CGBL_ERROR("Invalid ram length: %u bytes", bank->length);
     }
-    if ((count = cartridge.rom.data[CGBL_CARTRIDGE_HEADER_RAM]) >= CGBL_LENGTH(RAM)) {
+    if ((count = context->cartridge.rom.data[CGBL_CARTRIDGE_HEADER_RAM]) >= CGBL_LENGTH(RAM)) {
         return CGBL_ERROR("Unsupported ram type: %02X", count);
     }
-    cartridge.ram.count = RAM[count];
-    length = (cartridge.ram.count * CGBL_CARTRIDGE_RAM_WIDTH) + sizeof(*ram);
+    context->cartridge.ram.count = RAM[count];
+    length = (context->cartridge.ram.count * CGBL_CARTRIDGE_RAM_WIDTH) + sizeof(*ram);
     if (bank->length < length) {
         return CGBL_ERROR("Invalid ram length: %u bytes", bank->length);
     }
@@ -151,7 +100,7 @@ static cgbl_error_e cgbl_cartridge_ram_reset(cgbl_bank_t *const bank) {
             (ram->attribute.reserved != 0)) {
             return CGBL_ERROR("Unsupported ram header attributes");
         }
-        if (ram->length != (cartridge.ram.count * CGBL_CARTRIDGE_RAM_WIDTH)) {
+        if (ram->length != (context->cartridge.ram.count * CGBL_CARTRIDGE_RAM_WIDTH)) {
             return CGBL_ERROR("Invalid ram header length: %u bytes", ram->length);
         }
     } else {
@@ -162,12 +111,12 @@ static cgbl_error_e cgbl_cartridge_ram_reset(cgbl_bank_t *const bank) {
         ram->length = length - sizeof(*ram);
     }
     bank->length = length;
-    cartridge.ram.clock = &ram->clock;
-    cartridge.ram.data = ram->data;
+    context->cartridge.ram.clock = &ram->clock;
+    context->cartridge.ram.data = ram->data;
     return result;
 }
 
-static cgbl_error_e cgbl_cartridge_rom_reset(const cgbl_bank_t *const bank) {
+static cgbl_error_e cgbl_cartridge_rom_reset(cgbl_context_t *const context, const cgbl_bank_t *const bank) {
     uint8_t checksum = 0, count = 0;
     if (bank->length < CGBL_CARTRIDGE_ROM_WIDTH) {
         return CGBL_ERROR("Invalid rom length: %u bytes", bank->length);
@@ -181,48 +130,49 @@ static cgbl_error_e cgbl_cartridge_rom_reset(const cgbl_bank_t *const bank) {
     if ((count = bank->data[CGBL_CARTRIDGE_HEADER_ROM]) >= CGBL_LENGTH(ROM)) {
         return CGBL_ERROR("Unsupported rom type: %02X", count);
     }
-    cartridge.rom.count = ROM[count];
-    if (bank->length != (cartridge.rom.count * CGBL_CARTRIDGE_ROM_WIDTH)) {
+    context->cartridge.rom.count = ROM[count];
+    if (bank->length != (context->cartridge.rom.count * CGBL_CARTRIDGE_ROM_WIDTH)) {
         return CGBL_ERROR("Invalid rom length: %u bytes", bank->length);
     }
-    cartridge.rom.data = bank->data;
+    context->cartridge.rom.data = bank->data;
     return CGBL_SUCCESS;
 }
 
-static void cgbl_cartridge_title_reset(void) {
-    const char *title = (const char *)&cartridge.rom.data[CGBL_CARTRIDGE_HEADER_TITLE_BEGIN];
-    for (uint8_t index = 0; index < CGBL_LENGTH(cartridge.title); ++index) {
-        cartridge.title[index] = title[index];
-        if (cartridge.title[index] && (!isprint(cartridge.title[index]) || isspace(cartridge.title[index]))) {
-            cartridge.title[index] = ' ';
+static void cgbl_cartridge_title_reset(cgbl_context_t *const context) {
+    const char *title = (const char *)&context->cartridge.rom.data[CGBL_CARTRIDGE_HEADER_TITLE_BEGIN];
+    for (uint8_t index = 0; index < CGBL_LENGTH(context->cartridge.title); ++index) {
+        context->cartridge.title[index] = title[index];
+        if (context->cartridge.title[index] && (!isprint(context->cartridge.title[index]) || isspace(context->cartridge.title[index]))) {
+            context->cartridge.title[index] = ' ';
         }
     }
-    if (!strlen(cartridge.title)) {
-        snprintf(cartridge.title, CGBL_LENGTH(cartridge.title), "UNTITLED");
+    if (!strlen(context->cartridge.title)) {
+        snprintf(context->cartridge.title, CGBL_LENGTH(context->cartridge.title), "UNTITLED");
     }
 }
 
-void cgbl_cartridge_clock_latch(void) {
-    memcpy(&cartridge.clock.latch, cartridge.ram.clock, sizeof(*cartridge.ram.clock));
+void cgbl_cartridge_clock_latch(cgbl_context_t *const context) {
+    cgbl_bus_sync(context, CGBL_EVENT_CARTRIDGE);
+    memcpy(&context->cartridge.clock.latch, context->cartridge.ram.clock, sizeof(*context->cartridge.ram.clock));
 }
 
-uint8_t cgbl_cartridge_clock_read(cgbl_clock_e clock) {
+uint8_t cgbl_cartridge_clock_read(cgbl_context_t *const context, cgbl_clock_e clock) {
     uint8_t result = 0xFF;
     switch (clock) {
     case CGBL_CLOCK_DAY_HIGH:
-        result = cartridge.clock.latch.day.high;
+        result = context->cartridge.clock.latch.day.high;
         break;
     case CGBL_CLOCK_DAY_LOW:
-        result = cartridge.clock.latch.day.low;
+        result = context->cartridge.clock.latch.day.low;
         break;
     case CGBL_CLOCK_HOUR:
-        result = cartridge.clock.latch.hour.raw;
+        result = context->cartridge.clock.latch.hour.raw;
         break;
     case CGBL_CLOCK_MINUTE:
-        result = cartridge.clock.latch.minute.raw;
+        result = context->cartridge.clock.latch.minute.raw;
         break;
     case CGBL_CLOCK_SECOND:
-        result = cartridge.clock.latch.second.raw;
+        result = context->cartridge.clock.latch.second.raw;
         break;
     default:
         break;
@@ -230,107 +180,127 @@ uint8_t cgbl_cartridge_clock_read(cgbl_clock_e clock) {
     return result;
 }
 
-void cgbl_cartridge_clock_write(cgbl_clock_e clock, uint8_t data) {
+void cgbl_cartridge_clock_write(cgbl_context_t *const context, cgbl_clock_e clock, uint8_t data) {
+    cgbl_bus_sync(context, CGBL_EVENT_CARTRIDGE);
     switch (clock) {
     case CGBL_CLOCK_DAY_HIGH:
-        cartridge.ram.clock->day.high = data & 0xC1;
+        context->cartridge.ram.clock->day.high = data & 0xC1;
         break;
     case CGBL_CLOCK_DAY_LOW:
-        cartridge.ram.clock->day.low = data;
+        context->cartridge.ram.clock->day.low = data;
         break;
     case CGBL_CLOCK_HOUR:
-        cartridge.ram.clock->hour.counter = data;
+        context->cartridge.ram.clock->hour.counter = data;
         break;
     case CGBL_CLOCK_MINUTE:
-        cartridge.ram.clock->minute.counter = data;
+        context->cartridge.ram.clock->minute.counter = data;
         break;
     case CGBL_CLOCK_SECOND:
-        cartridge.ram.clock->second.counter = data;
+        context->cartridge.ram.clock->second.counter = data;
         break;
     default:
         break;
     }
 }
 
-uint8_t cgbl_cartridge_palette_hash(char *const disambiguation) {
-    *disambiguation = cartridge.title[3];
-    return cartridge.hash;
+void cgbl_cartridge_map(cgbl_context_t *const context) {
+    if (context->cartridge.mapper->map) {
+        context->cartridge.mapper->map(context);
+    } else {
+        cgbl_bus_map(context, CGBL_CARTRIDGE_ROM_0_BEGIN, CGBL_CARTRIDGE_ROM_1_END, NULL, NULL);
+        cgbl_bus_map(context, CGBL_CARTRIDGE_RAM_BEGIN, CGBL_CARTRIDGE_RAM_END, NULL, NULL);
+    }
+}
+
+uint8_t cgbl_cartridge_palette_hash(cgbl_context_t *const context, char *const disambiguation) {
+    *disambiguation = context->cartridge.title[3];
+    return context->cartridge.hash;
 }
 
-uint16_t cgbl_cartridge_ram_count(void) {
-    return cartridge.ram.count;
+uint8_t *cgbl_cartridge_ram_bank(cgbl_context_t *const context, uint16_t bank) {
+    return &context->cartridge.ram.data[bank * CGBL_CARTRIDGE_RAM_WIDTH];
 }
 
-uint8_t cgbl_cartridge_ram_read(uint16_t bank, uint16_t address) {
-    return cartridge.ram.data[(bank * CGBL_CARTRIDGE_RAM_WIDTH) + address];
+uint16_t cgbl_cartridge_ram_count(cgbl_context_t *const context) {
+    return context->cartridge.ram.count;
 }
 
-void cgbl_cartridge_ram_write(uint16_t bank, uint16_t address, uint8_t data) {
-    cartridge.ram.data[(bank * CGBL_CARTRIDGE_RAM_WIDTH) + address] = data;
+uint8_t cgbl_cartridge_ram_read(cgbl_context_t *const context, uint16_t bank, uint16_t address) {
+    return context->cartridge.ram.data[(bank * CGBL_CARTRIDGE_RAM_WIDTH) + address];
 }
 
-uint8_t cgbl_cartridge_read(uint16_t address) {
+void cgbl_cartridge_ram_write(cgbl_context_t *const context, uint16_t bank, uint16_t address, uint8_t data) {
+    context->cartridge.ram.data[(bank * CGBL_CARTRIDGE_RAM_WIDTH) + address] = data;
+}
+
+uint8_t cgbl_cartridge_read(cgbl_context_t *const context, uint16_t address) {
     uint8_t result = 0xFF;
-    if (cartridge.mapper->read) {
-        result = cartridge.mapper->read(address);
+    if (context->cartridge.mapper->read) {
+        result = context->cartridge.mapper->read(context, address);
     }
     return result;
 }
 
-cgbl_error_e cgbl_cartridge_reset(const cgbl_bank_t *const rom, cgbl_bank_t *const ram) {
+cgbl_error_e cgbl_cartridge_reset(cgbl_context_t *const context, const cgbl_bank_t *const rom, cgbl_bank_t *const ram) {
     cgbl_error_e result = CGBL_SUCCESS;
-    memset(&cartridge, 0, sizeof(cartridge));
-    cartridge.clock.delay = 4213440;
+    memset(&context->cartridge, 0, sizeof(context->cartridge));
+    context->cartridge.clock.delay = 4213440;
     if (ram->data && rom->data) {
-        if (((result = cgbl_cartridge_rom_reset(rom)) == CGBL_SUCCESS) && ((result = cgbl_cartridge_ram_reset(ram)) == CGBL_SUCCESS) &&
-            ((result = cgbl_cartridge_mapper_reset()) == CGBL_SUCCESS)) {
-            cgbl_cartridge_hash_reset();
-            cgbl_cartridge_title_reset();
+        if (((result = cgbl_cartridge_rom_reset(context, rom)) == CGBL_SUCCESS) &&
+            ((result = cgbl_cartridge_ram_reset(context, ram)) == CGBL_SUCCESS) &&
+            ((result = cgbl_cartridge_mapper_reset(context)) == CGBL_SUCCESS)) {
+            cgbl_cartridge_hash_reset(context);
+            cgbl_cartridge_title_reset(context);
         }
     } else {
-        cartridge.mapper = &MAPPER[0].mapper;
-        snprintf(cartridge.title, CGBL_LENGTH(cartridge.title), "UNDEFINED");
+        context->cartridge.mapper = &MAPPER[0].mapper;
+        snprintf(context->cartridge.title, CGBL_LENGTH(context->cartridge.title), "UNDEFINED");
     }
     return result;
 }
 
-uint16_t cgbl_cartridge_rom_count(void) {
-    return cartridge.rom.count;
+const uint8_t *cgbl_cartridge_rom_bank(cgbl_context_t *const context, uint16_t bank) {
+    return &context->cartridge.rom.data[bank * CGBL_CARTRIDGE_ROM_WIDTH];
+}
+
+uint16_t cgbl_cartridge_rom_count(cgbl_context_t *const context) {
+    return context->cartridge.rom.count;
 }
 
-uint8_t cgbl_cartridge_rom_read(uint16_t bank, uint16_t address) {
-    return cartridge.rom.data[(bank * CGBL_CARTRIDGE_ROM_WIDTH) + address];
+uint8_t cgbl_cartridge_rom_read(cgbl_context_t *const context, uint16_t bank, uint16_t address) {
+    return context->cartridge.rom.data[(bank * CGBL_CARTRIDGE_ROM_WIDTH) + address];
 }
 
-void cgbl_cartridge_step(void) {
-    if (!cartridge.clock.delay) {
-        if (cartridge.ram.clock && !cartridge.ram.clock->day.halt) {
-            if (++cartridge.ram.clock->second.counter == 60) {
-                cartridge.ram.clock->second.counter = 0;
-                if (++cartridge.ram.clock->minute.counter == 60) {
-                    cartridge.ram.clock->minute.counter = 0;
-                    if (++cartridge.ram.clock->hour.counter == 24) {
-                        cartridge.ram.clock->hour.counter = 0;
-                        if ((cartridge.ram.clock->day.carry = (cartridge.ram.clock->day.counter == 511))) {
-                            cartridge.ram.clock->day.counter = 0;
+void cgbl_cartridge_step(cgbl_context_t *const context, uint32_t cycles) {
+    while (cycles > context->cartridge.clock.delay) {
+        cycles -= context->cartridge.clock.delay + 1;
+        if (context->cartridge.ram.clock && !context->cartridge.ram.clock->day.halt) {
+            if (++context->cartridge.ram.clock->second.counter == 60) {
+                context->cartridge.ram.clock->second.counter = 0;
+                if (++context->cartridge.ram.clock->minute.counter == 60) {
+                    context->cartridge.ram.clock->minute.counter = 0;
+                    if (++context->cartridge.ram.clock->hour.counter == 24) {
+                        context->cartridge.ram.clock->hour.counter = 0;
+                        if ((context->cartridge.ram.clock->day.carry = (context->cartridge.ram.clock->day.counter == 511))) {
+                            context->cartridge.ram.clock->day.counter = 0;
                         } else {
-                            ++cartridge.ram.clock->day.counter;
+                            ++context->cartridge.ram.clock->day.counter;
                         }
                     }
                 }
             }
         }
-        cartridge.clock.delay = 4213440;
+        context->cartridge.clock.delay = 4213440 - 1;
     }
-    --cartridge.clock.delay;
+    context->cartridge.clock.delay -= cycles;
 }
 
-const char *cgbl_cartridge_title(void) {
-    return cartridge.title;
+const char *cgbl_cartridge_title(cgbl_context_t *const context) {
+    return context->cartridge.title;
 }
 
-void cgbl_cartridge_write(uint16_t address, uint8_t data) {
-    if (cartridge.mapper->write) {
-        cartridge.mapper->write(address, data);
+void cgbl_cartridge_write(cgbl_context_t *const context, uint16_t address, uint8_t data) {
+    if (context->cartridge.mapper->write) {
+        context->cartridge.mapper->write(context, address, data);
     }
 }
@@ -35,19 +35,75 @@ typedef enum {
     CGBL_CLOCK_MAX
 } cgbl_clock_e;
 
-void cgbl_cartridge_clock_latch(void);
-uint8_t cgbl_cartridge_clock_read(cgbl_clock_e clock);
-void cgbl_cartridge_clock_write(cgbl_clock_e clock, uint8_t data);
-uint8_t cgbl_cartridge_palette_hash(char *const disambiguation);
-uint16_t cgbl_cartridge_ram_count(void);
-uint8_t cgbl_cartridge_ram_read(uint16_t bank, uint16_t address);
-void cgbl_cartridge_ram_write(uint16_t bank, uint16_t address, uint8_t data);
-uint8_t cgbl_cartridge_read(uint16_t address);
-cgbl_error_e cgbl_cartridge_reset(const cgbl_bank_t *const rom, cgbl_bank_t *const ram);
-uint16_t cgbl_cartridge_rom_count(void);
-uint8_t cgbl_cartridge_rom_read(uint16_t bank, uint16_t address);
-void cgbl_cartridge_step(void);
-const char *cgbl_cartridge_title(void);
-void cgbl_cartridge_write(uint16_t address, uint8_t data);
+typedef struct __attribute__((packed)) {
+    union {
+        uint8_t raw;
+        uint8_t counter : 6;
+    } second;
+    union {
+        uint8_t raw;
+        uint8_t counter : 6;
+    } minute;
+    union {
+        uint8_t raw;
+        uint8_t counter : 5;
+    } hour;
+    union {
+        struct {
+            uint16_t counter : 9;
+            uint16_t : 5;
+            uint16_t halt : 1;
+            uint16_t carry : 1;
+        };
+        struct {
+            uint8_t low;
+            uint8_t high;
+        };
+    } day;
+} cgbl_clock_t;
+
+typedef struct {
+    void (*map)(cgbl_context_t *const context);
+    uint8_t (*read)(cgbl_context_t *const context, uint16_t address);
+    void (*reset)(cgbl_context_t *const context);
+    void (*write)(cgbl_context_t *const context, uint16_t address, uint8_t data);
+} cgbl_mapper_t;
+
+typedef struct {
+    uint8_t hash;
+    char title[12];
+    const cgbl_mapper_t *mapper;
+    struct {
+        uint32_t delay;
+        cgbl_clock_t latch;
+    } clock;
+    struct {
+        uint16_t count;
+        uint8_t *data;
+        cgbl_clock_t *clock;
+    } ram;
+    struct {
+        uint16_t count;
+        const uint8_t *data;
+    } rom;
+} cgbl_cartridge_t;
+
+void cgbl_cartridge_clock_latch(cgbl_context_t *const context);
+uint8_t cgbl_cartridge_clock_read(cgbl_context_t *const context, cgbl_clock_e clock);
+void cgbl_cartridge_clock_write(cgbl_context_t *const context, cgbl_clock_e clock, uint8_t data);
+void cgbl_cartridge_map(cgbl_context_t *const context);
+uint8_t cgbl_cartridge_palette_hash(cgbl_context_t *const context, char *const disambiguation);
+uint8_t *cgbl_cartridge_ram_bank(cgbl_context_t *const context, uint16_t bank);
+uint16_t cgbl_cartridge_ram_count(cgbl_context_t *const context);
+uint8_t cgbl_cartridge_ram_read(cgbl_context_t *const context, uint16_t bank, uint16_t address);
+void cgbl_cartridge_ram_write(cgbl_context_t *const context, uint16_t bank, uint16_t address, uint8_t data);
+uint8_t cgbl_cartridge_read(cgbl_context_t *const context, uint16_t address);
+cgbl_error_e cgbl_cartridge_reset(cgbl_context_t *const context, const cgbl_bank_t *const rom, cgbl_bank_t *const ram);
+const uint8_t *cgbl_cartridge_rom_bank(cgbl_context_t *const context, uint16_t bank);
+uint16_t cgbl_cartridge_rom_count(cgbl_context_t *const context);
+uint8_t cgbl_cartridge_rom_read(cgbl_context_t *const context, uint16_t bank, uint16_t address);
+void cgbl_cartridge_step(cgbl_context_t *const context, uint32_t cycles);
+const char *cgbl_cartridge_title(cgbl_context_t *const context);
+void cgbl_cartridge_write(cgbl_context_t *const context, uint16_t address, uint8_t data);
 
 #endif /* CGBL_CARTRIDGE_H_ */
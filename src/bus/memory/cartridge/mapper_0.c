@@ -4,18 +4,27 @@
  */
 
 #include "mapper_0.h"
+#include "context.h"
+#include <stddef.h>
 
-uint8_t cgbl_mapper_0_read(uint16_t address) {
+void cgbl_mapper_0_map(cgbl_context_t *const context) {
+    uint8_t *ram = cgbl_cartridge_ram_bank(context, 0);
+    cgbl_bus_map(context, CGBL_CARTRIDGE_ROM_0_BEGIN, CGBL_CARTRIDGE_ROM_0_END, cgbl_cartridge_rom_bank(context, 0), NULL);
+    cgbl_bus_map(context, CGBL_CARTRIDGE_ROM_1_BEGIN, CGBL_CARTRIDGE_ROM_1_END, cgbl_cartridge_rom_bank(context, 1), NULL);
+    cgbl_bus_map(context, CGBL_CARTRIDGE_RAM_BEGIN, CGBL_CARTRIDGE_RAM_END, ram, ram);
+}
+
+uint8_t cgbl_mapper_0_read(cgbl_context_t *const context, uint16_t address) {
     uint8_t result = 0xFF;
     switch (address) {
     case CGBL_CARTRIDGE_RAM_BEGIN ... CGBL_CARTRIDGE_RAM_END:
-        result = cgbl_cartridge_ram_read(0, address - CGBL_CARTRIDGE_RAM_BEGIN);
+        result = cgbl_cartridge_ram_read(context, 0, address - CGBL_CARTRIDGE_RAM_BEGIN);
         break;
     case CGBL_CARTRIDGE_ROM_0_BEGIN ... CGBL_CARTRIDGE_ROM_0_END:
-        result = cgbl_cartridge_rom_read(0, address - CGBL_CARTRIDGE_ROM_0_BEGIN);
+        result = cgbl_cartridge_rom_read(context, 0, address - CGBL_CARTRIDGE_ROM_0_BEGIN);
         break;
     case CGBL_CARTRIDGE_ROM_1_BEGIN ... CGBL_CARTRIDGE_ROM_1_END:
-        result = cgbl_cartridge_rom_read(1, address - CGBL_CARTRIDGE_ROM_1_BEGIN);
+        result = cgbl_cartridge_rom_read(context, 1, address - CGBL_CARTRIDGE_ROM_1_BEGIN);
         break;
     default:
         break;
@@ -23,10 +32,10 @@ uint8_t cgbl_mapper_0_read(uint16_t address) {
     return result;
 }
 
-void cgbl_mapper_0_write(uint16_t address, uint8_t data) {
+void cgbl_mapper_0_write(cgbl_context_t *const context, uint16_t address, uint8_t data) {
     switch (address) {
     case CGBL_CARTRIDGE_RAM_BEGIN ... CGBL_CARTRIDGE_RAM_END:
-        cgbl_cartridge_ram_write(0, address - CGBL_CARTRIDGE_RAM_BEGIN, data);
+        cgbl_cartridge_ram_write(context, 0, address - CGBL_CARTRIDGE_RAM_BEGIN, data);
         break;
     default:
         break;
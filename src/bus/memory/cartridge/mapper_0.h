@@ -8,7 +8,8 @@
 
 #include "cartridge.h"
 
-uint8_t cgbl_mapper_0_read(uint16_t address);
-void cgbl_mapper_0_write(uint16_t address, uint8_t data);
+void cgbl_mapper_0_map(cgbl_context_t *const context);
+uint8_t cgbl_mapper_0_read(cgbl_context_t *const context, uint16_t address);
+void cgbl_mapper_0_write(cgbl_context_t *const context, uint16_t address, uint8_t data);
 
 #endif /* CGBL_MAPPER_0_H_ */
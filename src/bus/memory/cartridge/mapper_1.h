@@ -17,8 +17,24 @@
 #define CGBL_MAPPER_1_RAM_ENABLE_BEGIN 0x0000
 #define CGBL_MAPPER_1_RAM_ENABLE_END 0x1FFF
 
-uint8_t cgbl_mapper_1_read(uint16_t address);
-void cgbl_mapper_1_reset(void);
-void cgbl_mapper_1_write(uint16_t address, uint8_t data);
+typedef struct {
+    struct {
+        uint8_t high;
+        uint8_t low;
+        uint8_t select;
+    } bank;
+    struct {
+        bool enabled;
+        uint16_t bank;
+    } ram;
+    struct {
+        uint16_t bank[2];
+    } rom;
+} cgbl_mapper_1_t;
+
+void cgbl_mapper_1_map(cgbl_context_t *const context);
+uint8_t cgbl_mapper_1_read(cgbl_context_t *const context, uint16_t address);
+void cgbl_mapper_1_reset(cgbl_context_t *const context);
+void cgbl_mapper_1_write(cgbl_context_t *const context, uint16_t address, uint8_t data);
 
 #endif /* CGBL_MAPPER_1_H_ */
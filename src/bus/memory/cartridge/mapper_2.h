@@ -11,8 +11,14 @@
 #define CGBL_MAPPER_2_BANK_SELECT_BEGIN 0x0000
 #define CGBL_MAPPER_2_BANK_SELECT_END 0x3FFF
 
-uint8_t cgbl_mapper_2_read(uint16_t address);
-void cgbl_mapper_2_reset(void);
-void cgbl_mapper_2_write(uint16_t address, uint8_t data);
+typedef struct {
+    bool enabled;
+    uint16_t bank;
+} cgbl_mapper_2_t;
+
+void cgbl_mapper_2_map(cgbl_context_t *const context);
+uint8_t cgbl_mapper_2_read(cgbl_context_t *const context, uint16_t address);
+void cgbl_mapper_2_reset(cgbl_context_t *const context);
+void cgbl_mapper_2_write(cgbl_context_t *const context, uint16_t address, uint8_t data);
 
 #endif /* CGBL_MAPPER_2_H_ */
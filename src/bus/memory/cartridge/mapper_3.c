@@ -4,50 +4,48 @@
  */
 
 #include "mapper_3.h"
+#include "context.h"
 #include <string.h>
 
-static struct {
-    struct {
-        bool latched;
-        cgbl_clock_e bank;
-    } clock;
-    struct {
-        bool enabled;
-        uint16_t bank;
-    } ram;
-    struct {
-        uint16_t bank;
-    } rom;
-} mapper_3 = {};
+static void cgbl_mapper_3_update(cgbl_context_t *const context) {
+    if (!context->mapper_3.rom.bank) {
+        ++context->mapper_3.rom.bank;
+    }
+    context->mapper_3.rom.bank &= cgbl_cartridge_rom_count(context) - 1;
+    context->mapper_3.ram.bank &= cgbl_cartridge_ram_count(context) - 1;
+}
 
-static void cgbl_mapper_3_update(void) {
-    if (!mapper_3.rom.bank) {
-        ++mapper_3.rom.bank;
+void cgbl_mapper_3_map(cgbl_context_t *const context) {
+    uint8_t *ram = NULL;
+    if (context->mapper_3.ram.enabled && !context->mapper_3.clock.bank) {
+        ram = cgbl_cartridge_ram_bank(context, context->mapper_3.ram.bank);
     }
-    mapper_3.rom.bank &= cgbl_cartridge_rom_count() - 1;
-    mapper_3.ram.bank &= cgbl_cartridge_ram_count() - 1;
+    cgbl_bus_map(context, CGBL_CARTRIDGE_ROM_0_BEGIN, CGBL_CARTRIDGE_ROM_0_END, cgbl_cartridge_rom_bank(context, 0), NULL);
+    cgbl_bus_map(context, CGBL_CARTRIDGE_ROM_1_BEGIN, CGBL_CARTRIDGE_ROM_1_END,
+                 cgbl_cartridge_rom_bank(context, context->mapper_3.rom.bank), NULL);
+    cgbl_bus_map(context, CGBL_CARTRIDGE_RAM_BEGIN, CGBL_CARTRIDGE_RAM_END, ram, ram);
 }
 
-uint8_t cgbl_mapper_3_read(uint16_t address) {
+uint8_t cgbl_mapper_3_read(cgbl_context_t *const context, uint16_t address) {
     uint8_t result = 0xFF;
     switch (address) {
     case CGBL_CARTRIDGE_RAM_BEGIN ... CGBL_CARTRIDGE_RAM_END:
-        if (mapper_3.ram.enabled) {
-            switch (mapper_3.clock.bank) {
+        if (context->mapper_3.ram.enabled) {
+            switch (context->mapper_3.clock.bank) {
             case CGBL_CLOCK_SECOND ... CGBL_CLOCK_DAY_HIGH:
-                result = cgbl_cartridge_clock_read(mapper_3.clock.bank);
+                result = cgbl_cartridge_clock_read(context, context->mapper_3.clock.bank);
                 break;
             default:
-                result = cgbl_cartridge_ram_read(mapper_3.ram.bank, address - CGBL_CARTRIDGE_RAM_BEGIN);
+                result = cgbl_cartridge_ram_read(context, context->mapper_3.ram.bank, address - CGBL_CARTRIDGE_RAM_BEGIN);
                 break;
             }
         }
         break;
     case CGBL_CARTRIDGE_ROM_0_BEGIN ... CGBL_CARTRIDGE_ROM_0_END:
-        result = cgbl_cartridge_rom_read(0, address - CGBL_CARTRIDGE_ROM_0_BEGIN);
+        result = cgbl_cartridge_rom_read(context, 0, address - CGBL_CARTRIDGE_ROM_0_BEGIN);
         break;
     case CGBL_CARTRIDGE_ROM_1_BEGIN ... CGBL_CARTRIDGE_ROM_1_END:
-        result = cgbl_cartridge_rom_read(mapper_3.rom.bank, address - CGBL_CARTRIDGE_ROM_1_BEGIN);
+        result = cgbl_cartridge_rom_read(context, context->mapper_3.rom.bank, address - CGBL_CARTRIDGE_ROM_1_BEGIN);
         break;
     default:
         break;
@@ -55,51 +53,55 @@ uint8_t cgbl_mapper_3_read(uint16_t address) {
     return result;
 }
 
-void cgbl_mapper_3_reset(void) {
-    memset(&mapper_3, 0, sizeof(mapper_3));
-    cgbl_mapper_3_update();
+void cgbl_mapper_3_reset(cgbl_context_t *const context) {
+    memset(&context->mapper_3, 0, sizeof(context->mapper_3));
+    cgbl_mapper_3_update(context);
 }
 
-void cgbl_mapper_3_write(uint16_t address, uint8_t data) {
+void cgbl_mapper_3_write(cgbl_context_t *const context, uint16_t address, uint8_t data) {
     switch (address) {
     case CGBL_CARTRIDGE_RAM_BEGIN ... CGBL_CARTRIDGE_RAM_END:
-        if (mapper_3.ram.enabled) {
-            switch (mapper_3.clock.bank) {
+        if (context->mapper_3.ram.enabled) {
+            switch (context->mapper_3.clock.bank) {
             case CGBL_CLOCK_SECOND ... CGBL_CLOCK_DAY_HIGH:
-                cgbl_cartridge_clock_write(mapper_3.clock.bank, data);
+                cgbl_cartridge_clock_write(context, context->mapper_3.clock.bank, data);
                 break;
             default:
-                cgbl_cartridge_ram_write(mapper_3.ram.bank, address - CGBL_CARTRIDGE_RAM_BEGIN, data);
+                cgbl_cartridge_ram_write(context, context->mapper_3.ram.bank, address - CGBL_CARTRIDGE_RAM_BEGIN, data);
                 break;
             }
         }
         break;
     case CGBL_MAPPER_3_CLOCK_LATCH_BEGIN ... CGBL_MAPPER_3_CLOCK_LATCH_END:
-        if (!data && !mapper_3.clock.latched) {
-            mapper_3.clock.latched = true;
-        } else if (data && mapper_3.clock.latched) {
-            mapper_3.clock.latched = false;
-            cgbl_cartridge_clock_latch();
+        if (!data && !context->mapper_3.clock.latched) {
+            context->mapper_3.clock.latched = true;
+        } else if (data && context->mapper_3.clock.latched) {
+            context->mapper_3.clock.latched = false;
+            cgbl_cartridge_clock_latch(context);
         }
         break;
     case CGBL_MAPPER_3_RAM_BANK_BEGIN ... CGBL_MAPPER_3_RAM_BANK_END:
         switch (data) {
         case CGBL_MAPPER_3_CLOCK_BANK_BEGIN ... CGBL_MAPPER_3_CLOCK_BANK_END:
-            mapper_3.clock.bank = (data - CGBL_MAPPER_3_CLOCK_BANK_BEGIN) + CGBL_CLOCK_SECOND;
+            context->mapper_3.clock.bank = (data - CGBL_MAPPER_3_CLOCK_BANK_BEGIN) + CGBL_CLOCK_SECOND;
+            cgbl_memory_map(context);
             break;
         default:
-            mapper_3.clock.bank = 0;
-            mapper_3.ram.bank = data & 3;
-            cgbl_mapper_3_update();
+            context->mapper_3.clock.bank = 0;
+            context->mapper_3.ram.bank = data & 3;
+            cgbl_mapper_3_update(context);
+            cgbl_memory_map(context);
             break;
         }
         break;
     case CGBL_MAPPER_3_RAM_ENABLE_BEGIN ... CGBL_MAPPER_3_RAM_ENABLE_END:
-        mapper_3.ram.enabled = ((data & 0xF) == 0xA);
+        context->mapper_3.ram.enabled = ((data & 0xF) == 0xA);
+        cgbl_memory_map(context);
         break;
     case CGBL_MAPPER_3_ROM_BANK_BEGIN ... CGBL_MAPPER_3_ROM_BANK_END:
-        mapper_3.rom.bank = data & 0x7F;
-        cgbl_mapper_3_update();
+        context->mapper_3.rom.bank = data & 0x7F;
+        cgbl_mapper_3_update(context);
+        cgbl_memory_map(context);
         break;
     default:
         break;
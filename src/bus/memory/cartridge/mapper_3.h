@@ -19,8 +19,23 @@
 #define CGBL_MAPPER_3_ROM_BANK_BEGIN 0x2000
 #define CGBL_MAPPER_3_ROM_BANK_END 0x3FFF
 
-uint8_t cgbl_mapper_3_read(uint16_t address);
-void cgbl_mapper_3_reset(void);
-void cgbl_mapper_3_write(uint16_t address, uint8_t data);
+typedef struct {
+    struct {
+        bool latched;
+        cgbl_clock_e bank;
+    } clock;
+    struct {
+        bool enabled;
+        uint16_t bank;
+    } ram;
+    struct {
+        uint16_t bank;
+    } rom;
+} cgbl_mapper_3_t;
+
+void cgbl_mapper_3_map(cgbl_context_t *const context);
+uint8_t cgbl_mapper_3_read(cgbl_context_t *const context, uint16_t address);
+void cgbl_mapper_3_reset(cgbl_context_t *const context);
+void cgbl_mapper_3_write(cgbl_context_t *const context, uint16_t address, uint8_t data);
 
 #endif /* CGBL_MAPPER_3_H_ */
@@ -17,8 +17,26 @@
 #define CGBL_MAPPER_5_ROM_BANK_LOW_BEGIN 0x2000
 #define CGBL_MAPPER_5_ROM_BANK_LOW_END 0x2FFF
 
-uint8_t cgbl_mapper_5_read(uint16_t address);
-void cgbl_mapper_5_reset(void);
-void cgbl_mapper_5_write(uint16_t address, uint8_t data);
+typedef struct {
+    union {
+        uint16_t raw;
+        struct {
+            uint16_t low : 8;
+            uint16_t high : 1;
+        };
+    } bank;
+    struct {
+        bool enabled;
+        uint16_t bank;
+    } ram;
+    struct {
+        uint16_t bank;
+    } rom;
+} cgbl_mapper_5_t;
+
+void cgbl_mapper_5_map(cgbl_context_t *const context);
+uint8_t cgbl_mapper_5_read(cgbl_context_t *const context, uint16_t address);
+void cgbl_mapper_5_reset(cgbl_context_t *const context);
+void cgbl_mapper_5_write(cgbl_context_t *const context, uint16_t address, uint8_t data);
 
 #endif /* CGBL_MAPPER_5_H_ */
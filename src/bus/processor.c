@@ -4,2175 +4,909 @@
  */
 
 #include "processor.h"
+#include "context.h"
 #include "timer.h"
 #include <string.h>
 
-typedef union {
-    uint8_t raw;
-    struct {
-        uint8_t : 4;
-        uint8_t input : 1;
-    };
-} cgbl_interrupt_t;
-
-static struct {
-    bool halt_bug;
-    bool halted;
-    bool stopped;
-    uint8_t delay;
-    cgbl_register_t af;
-    cgbl_register_t bc;
-    cgbl_register_t de;
-    cgbl_register_t hl;
-    cgbl_register_t pc;
-    cgbl_register_t sp;
-    struct {
-        uint16_t address;
-        cgbl_instruction_e opcode;
-    } instruction;
-    struct {
-        bool enabled;
-        uint8_t delay;
-        cgbl_interrupt_t enable;
-        cgbl_interrupt_t flag;
-    } interrupt;
-} processor = {};
-
-static cgbl_error_e cgbl_processor_instruction_adc(void) {
-    uint16_t carry = 0, sum = 0;
-    cgbl_register_t operand = {};
-    processor.delay = 4;
-    switch (processor.instruction.opcode) {
-    case CGBL_INSTRUCTION_ADC_A:
-        operand.low = processor.af.high;
-        break;
-    case CGBL_INSTRUCTION_ADC_B:
-        operand.low = processor.bc.high;
-        break;
-    case CGBL_INSTRUCTION_ADC_C:
-        operand.low = processor.bc.low;
-        break;
-    case CGBL_INSTRUCTION_ADC_D:
-        operand.low = processor.de.high;
-        break;
-    case CGBL_INSTRUCTION_ADC_E:
-        operand.low = processor.de.low;
-        break;
-    case CGBL_INSTRUCTION_ADC_H:
-        operand.low = processor.hl.high;
-        break;
-    case CGBL_INSTRUCTION_ADC_HLI:
-        processor.delay += 4;
-        operand.low = cgbl_bus_read(processor.hl.word);
-        break;
-    case CGBL_INSTRUCTION_ADC_L:
-        operand.low = processor.hl.low;
-        break;
-    case CGBL_INSTRUCTION_ADC_N:
-        processor.delay += 4;
-        operand.low = cgbl_bus_read(processor.pc.word++);
-        break;
-    default:
-        break;
+#ifdef CGBL_PROCESSOR_PROFILE
+#include <stdio.h>
+#endif /* CGBL_PROCESSOR_PROFILE */
+
+#define CGBL_PROCESSOR_CONDITION_ALWAYS true
+#define CGBL_PROCESSOR_CONDITION_C (context->processor.flag.carry & 0x100)
+#define CGBL_PROCESSOR_CONDITION_NC (!(context->processor.flag.carry & 0x100))
+#define CGBL_PROCESSOR_CONDITION_NZ (context->processor.flag.result)
+#define CGBL_PROCESSOR_CONDITION_Z (!context->processor.flag.result)
+
+#define CGBL_PROCESSOR_READ_A context->processor.af.high
+#define CGBL_PROCESSOR_READ_B context->processor.bc.high
+#define CGBL_PROCESSOR_READ_BCI cgbl_processor_load(context, context->processor.bc.word)
+#define CGBL_PROCESSOR_READ_C context->processor.bc.low
+#define CGBL_PROCESSOR_READ_D context->processor.de.high
+#define CGBL_PROCESSOR_READ_DEI cgbl_processor_load(context, context->processor.de.word)
+#define CGBL_PROCESSOR_READ_E context->processor.de.low
+#define CGBL_PROCESSOR_READ_FF00_CI cgbl_processor_load(context, 0xFF00 + context->processor.bc.low)
+#define CGBL_PROCESSOR_READ_FF00_NI cgbl_processor_load(context, 0xFF00 + cgbl_processor_fetch(context))
+#define CGBL_PROCESSOR_READ_H context->processor.hl.high
+#define CGBL_PROCESSOR_READ_HLI cgbl_processor_load(context, context->processor.hl.word)
+#define CGBL_PROCESSOR_READ_HLID cgbl_processor_load(context, context->processor.hl.word--)
+#define CGBL_PROCESSOR_READ_HLII cgbl_processor_load(context, context->processor.hl.word++)
+#define CGBL_PROCESSOR_READ_L context->processor.hl.low
+#define CGBL_PROCESSOR_READ_N cgbl_processor_fetch(context)
+#define CGBL_PROCESSOR_READ_NNI cgbl_processor_load(context, cgbl_processor_fetch_word(context))
+
+#define CGBL_PROCESSOR_REGISTER_AF context->processor.af
+#define CGBL_PROCESSOR_REGISTER_BC context->processor.bc
+#define CGBL_PROCESSOR_REGISTER_DE context->processor.de
+#define CGBL_PROCESSOR_REGISTER_HL context->processor.hl
+#define CGBL_PROCESSOR_REGISTER_SP context->processor.sp
+
+#define CGBL_PROCESSOR_WRITE_A(_DATA_) context->processor.af.high = (_DATA_)
+#define CGBL_PROCESSOR_WRITE_B(_DATA_) context->processor.bc.high = (_DATA_)
+#define CGBL_PROCESSOR_WRITE_BCI(_DATA_) cgbl_processor_store(context, context->processor.bc.word, (_DATA_))
+#define CGBL_PROCESSOR_WRITE_C(_DATA_) context->processor.bc.low = (_DATA_)
+#define CGBL_PROCESSOR_WRITE_D(_DATA_) context->processor.de.high = (_DATA_)
+#define CGBL_PROCESSOR_WRITE_DEI(_DATA_) cgbl_processor_store(context, context->processor.de.word, (_DATA_))
+#define CGBL_PROCESSOR_WRITE_E(_DATA_) context->processor.de.low = (_DATA_)
+#define CGBL_PROCESSOR_WRITE_FF00_CI(_DATA_) cgbl_processor_store(context, 0xFF00 + context->processor.bc.low, (_DATA_))
+#define CGBL_PROCESSOR_WRITE_FF00_NI(_DATA_) cgbl_processor_store(context, 0xFF00 + cgbl_processor_fetch(context), (_DATA_))
+#define CGBL_PROCESSOR_WRITE_H(_DATA_) context->processor.hl.high = (_DATA_)
+#define CGBL_PROCESSOR_WRITE_HLI(_DATA_) cgbl_processor_store(context, context->processor.hl.word, (_DATA_))
+#define CGBL_PROCESSOR_WRITE_HLID(_DATA_) cgbl_processor_store(context, context->processor.hl.word--, (_DATA_))
+#define CGBL_PROCESSOR_WRITE_HLII(_DATA_) cgbl_processor_store(context, context->processor.hl.word++, (_DATA_))
+#define CGBL_PROCESSOR_WRITE_L(_DATA_) context->processor.hl.low = (_DATA_)
+#define CGBL_PROCESSOR_WRITE_NNI(_DATA_) cgbl_processor_store(context, cgbl_processor_fetch_word(context), (_DATA_))
+
+#define CGBL_PROCESSOR_OPERATION_ADC(_SOURCE_) cgbl_processor_operation_adc(context, CGBL_PROCESSOR_READ_##_SOURCE_)
+#define CGBL_PROCESSOR_OPERATION_ADD(_SOURCE_) cgbl_processor_operation_add(context, CGBL_PROCESSOR_READ_##_SOURCE_)
+#define CGBL_PROCESSOR_OPERATION_ADD_HL(_REGISTER_) cgbl_processor_operation_add_hl(context, CGBL_PROCESSOR_REGISTER_##_REGISTER_.word)
+#define CGBL_PROCESSOR_OPERATION_ADD_SP(_REGISTER_) CGBL_PROCESSOR_REGISTER_##_REGISTER_.word = cgbl_processor_operation_add_sp(context)
+#define CGBL_PROCESSOR_OPERATION_AND(_SOURCE_) cgbl_processor_operation_and(context, CGBL_PROCESSOR_READ_##_SOURCE_)
+#define CGBL_PROCESSOR_OPERATION_BIT(_BIT_, _SOURCE_) cgbl_processor_operation_bit(context, _BIT_, CGBL_PROCESSOR_READ_##_SOURCE_)
+#define CGBL_PROCESSOR_OPERATION_CALL(_CONDITION_, _CYCLES_)                                                                               \
+    cgbl_processor_operation_call(context, CGBL_PROCESSOR_CONDITION_##_CONDITION_, _CYCLES_)
+#define CGBL_PROCESSOR_OPERATION_CCF() cgbl_processor_operation_ccf(context)
+#define CGBL_PROCESSOR_OPERATION_CP(_SOURCE_) cgbl_processor_operation_cp(context, CGBL_PROCESSOR_READ_##_SOURCE_)
+#define CGBL_PROCESSOR_OPERATION_CPL() cgbl_processor_operation_cpl(context)
+#define CGBL_PROCESSOR_OPERATION_DAA() cgbl_processor_operation_daa(context)
+#define CGBL_PROCESSOR_OPERATION_DEC(_TARGET_)                                                                                             \
+    CGBL_PROCESSOR_WRITE_##_TARGET_(cgbl_processor_operation_dec(context, CGBL_PROCESSOR_READ_##_TARGET_))
+#define CGBL_PROCESSOR_OPERATION_DEC_16(_REGISTER_) --CGBL_PROCESSOR_REGISTER_##_REGISTER_.word
+#define CGBL_PROCESSOR_OPERATION_DI() cgbl_processor_operation_di(context)
+#define CGBL_PROCESSOR_OPERATION_EI() cgbl_processor_operation_ei(context)
+#define CGBL_PROCESSOR_OPERATION_HALT() cgbl_processor_operation_halt(context)
+#define CGBL_PROCESSOR_OPERATION_INC(_TARGET_)                                                                                             \
+    CGBL_PROCESSOR_WRITE_##_TARGET_(cgbl_processor_operation_inc(context, CGBL_PROCESSOR_READ_##_TARGET_))
+#define CGBL_PROCESSOR_OPERATION_INC_16(_REGISTER_) ++CGBL_PROCESSOR_REGISTER_##_REGISTER_.word
+#define CGBL_PROCESSOR_OPERATION_JP(_CONDITION_, _CYCLES_)                                                                                 \
+    cgbl_processor_operation_jp(context, CGBL_PROCESSOR_CONDITION_##_CONDITION_, _CYCLES_)
+#define CGBL_PROCESSOR_OPERATION_JP_HL() context->processor.pc.word = context->processor.hl.word
+#define CGBL_PROCESSOR_OPERATION_JR(_CONDITION_, _CYCLES_)                                                                                 \
+    cgbl_processor_operation_jr(context, CGBL_PROCESSOR_CONDITION_##_CONDITION_, _CYCLES_)
+#define CGBL_PROCESSOR_OPERATION_LD(_TARGET_, _SOURCE_) CGBL_PROCESSOR_WRITE_##_TARGET_(CGBL_PROCESSOR_READ_##_SOURCE_)
+#define CGBL_PROCESSOR_OPERATION_LD_16(_REGISTER_) CGBL_PROCESSOR_REGISTER_##_REGISTER_.word = cgbl_processor_fetch_word(context)
+#define CGBL_PROCESSOR_OPERATION_LD_NNI_SP() cgbl_processor_operation_ld_nni_sp(context)
+#define CGBL_PROCESSOR_OPERATION_LD_SP_HL() context->processor.sp.word = context->processor.hl.word
+#define CGBL_PROCESSOR_OPERATION_NOP()
+#define CGBL_PROCESSOR_OPERATION_OR(_SOURCE_) cgbl_processor_operation_or(context, CGBL_PROCESSOR_READ_##_SOURCE_)
+#define CGBL_PROCESSOR_OPERATION_POP(_REGISTER_) CGBL_PROCESSOR_REGISTER_##_REGISTER_.word = cgbl_processor_pop(context)
+#define CGBL_PROCESSOR_OPERATION_POP_AF() cgbl_processor_operation_pop_af(context)
+#define CGBL_PROCESSOR_OPERATION_PUSH(_REGISTER_) cgbl_processor_push(context, CGBL_PROCESSOR_REGISTER_##_REGISTER_.word)
+#define CGBL_PROCESSOR_OPERATION_PUSH_AF() cgbl_processor_operation_push_af(context)
+#define CGBL_PROCESSOR_OPERATION_RES(_BIT_, _TARGET_) CGBL_PROCESSOR_WRITE_##_TARGET_(CGBL_PROCESSOR_READ_##_TARGET_ & ~(1 << (_BIT_)))
+#define CGBL_PROCESSOR_OPERATION_RET(_CONDITION_, _CYCLES_)                                                                                \
+    cgbl_processor_operation_ret(context, CGBL_PROCESSOR_CONDITION_##_CONDITION_, _CYCLES_)
+#define CGBL_PROCESSOR_OPERATION_RETI() cgbl_processor_operation_reti(context)
+#define CGBL_PROCESSOR_OPERATION_RL(_TARGET_)                                                                                              \
+    CGBL_PROCESSOR_WRITE_##_TARGET_(cgbl_processor_operation_rl(context, CGBL_PROCESSOR_READ_##_TARGET_))
+#define CGBL_PROCESSOR_OPERATION_RLA()                                                                                                     \
+    cgbl_processor_operation_rotate(context, cgbl_processor_operation_rl(context, context->processor.af.high))
+#define CGBL_PROCESSOR_OPERATION_RLC(_TARGET_)                                                                                             \
+    CGBL_PROCESSOR_WRITE_##_TARGET_(cgbl_processor_operation_rlc(context, CGBL_PROCESSOR_READ_##_TARGET_))
+#define CGBL_PROCESSOR_OPERATION_RLCA()                                                                                                    \
+    cgbl_processor_operation_rotate(context, cgbl_processor_operation_rlc(context, context->processor.af.high))
+#define CGBL_PROCESSOR_OPERATION_RR(_TARGET_)                                                                                              \
+    CGBL_PROCESSOR_WRITE_##_TARGET_(cgbl_processor_operation_rr(context, CGBL_PROCESSOR_READ_##_TARGET_))
+#define CGBL_PROCESSOR_OPERATION_RRA()                                                                                                     \
+    cgbl_processor_operation_rotate(context, cgbl_processor_operation_rr(context, context->processor.af.high))
+#define CGBL_PROCESSOR_OPERATION_RRC(_TARGET_)                                                                                             \
+    CGBL_PROCESSOR_WRITE_##_TARGET_(cgbl_processor_operation_rrc(context, CGBL_PROCESSOR_READ_##_TARGET_))
+#define CGBL_PROCESSOR_OPERATION_RRCA()                                                                                                    \
+    cgbl_processor_operation_rotate(context, cgbl_processor_operation_rrc(context, context->processor.af.high))
+#define CGBL_PROCESSOR_OPERATION_RST(_ADDRESS_) cgbl_processor_operation_rst(context, _ADDRESS_)
+#define CGBL_PROCESSOR_OPERATION_SBC(_SOURCE_) cgbl_processor_operation_sbc(context, CGBL_PROCESSOR_READ_##_SOURCE_)
+#define CGBL_PROCESSOR_OPERATION_SCF() cgbl_processor_operation_scf(context)
+#define CGBL_PROCESSOR_OPERATION_SET(_BIT_, _TARGET_) CGBL_PROCESSOR_WRITE_##_TARGET_(CGBL_PROCESSOR_READ_##_TARGET_ | (1 << (_BIT_)))
+#define CGBL_PROCESSOR_OPERATION_SLA(_TARGET_)                                                                                             \
+    CGBL_PROCESSOR_WRITE_##_TARGET_(cgbl_processor_operation_sla(context, CGBL_PROCESSOR_READ_##_TARGET_))
+#define CGBL_PROCESSOR_OPERATION_SRA(_TARGET_)                                                                                             \
+    CGBL_PROCESSOR_WRITE_##_TARGET_(cgbl_processor_operation_sra(context, CGBL_PROCESSOR_READ_##_TARGET_))
+#define CGBL_PROCESSOR_OPERATION_SRL(_TARGET_)                                                                                             \
+    CGBL_PROCESSOR_WRITE_##_TARGET_(cgbl_processor_operation_srl(context, CGBL_PROCESSOR_READ_##_TARGET_))
+#define CGBL_PROCESSOR_OPERATION_STOP() cgbl_processor_operation_stop(context)
+#define CGBL_PROCESSOR_OPERATION_SUB(_SOURCE_) cgbl_processor_operation_sub(context, CGBL_PROCESSOR_READ_##_SOURCE_)
+#define CGBL_PROCESSOR_OPERATION_SWAP(_TARGET_)                                                                                            \
+    CGBL_PROCESSOR_WRITE_##_TARGET_(cgbl_processor_operation_swap(context, CGBL_PROCESSOR_READ_##_TARGET_))
+#define CGBL_PROCESSOR_OPERATION_XOR(_SOURCE_) cgbl_processor_operation_xor(context, CGBL_PROCESSOR_READ_##_SOURCE_)
+#define CGBL_PROCESSOR_OPERATION_XXX()                                                                                                     \
+    return CGBL_ERROR("Illegal instruction: [%04X] %02X", context->processor.instruction.address, context->processor.instruction.opcode)
+
+#define CGBL_PROCESSOR_BRANCH(_OPCODE_, ...) [_OPCODE_] = true,
+#define CGBL_PROCESSOR_HANDLER(_OPCODE_, _CYCLES_, _FORMAT_, _OPERAND_, _OPERATION_, ...)                                                  \
+    static cgbl_error_e cgbl_processor_instruction_##_OPCODE_(cgbl_context_t *const context) {                                             \
+        context->processor.delay = _CYCLES_;                                                                                               \
+        CGBL_PROCESSOR_OPERATION_##_OPERATION_(__VA_ARGS__);                                                                               \
+        return CGBL_SUCCESS;                                                                                                               \
     }
-    sum = processor.af.high + operand.low + processor.af.carry;
-    carry = processor.af.high ^ operand.low ^ processor.af.carry ^ sum;
-    processor.af.carry = ((carry & 0x100) == 0x100);
-    processor.af.half_carry = ((carry & 0x10) == 0x10);
-    processor.af.negative = false;
-    processor.af.zero = !(sum & 0xFF);
-    processor.af.high = sum;
-    return CGBL_SUCCESS;
-}
-
-static cgbl_error_e cgbl_processor_instruction_add(void) {
-    uint16_t carry = 0, sum = 0;
-    cgbl_register_t operand = {};
-    processor.delay = 4;
-    switch (processor.instruction.opcode) {
-    case CGBL_INSTRUCTION_ADD_A:
-        operand.low = processor.af.high;
-        break;
-    case CGBL_INSTRUCTION_ADD_B:
-        operand.low = processor.bc.high;
-        break;
-    case CGBL_INSTRUCTION_ADD_C:
-        operand.low = processor.bc.low;
-        break;
-    case CGBL_INSTRUCTION_ADD_D:
-        operand.low = processor.de.high;
-        break;
-    case CGBL_INSTRUCTION_ADD_E:
-        operand.low = processor.de.low;
-        break;
-    case CGBL_INSTRUCTION_ADD_H:
-        operand.low = processor.hl.high;
-        break;
-    case CGBL_INSTRUCTION_ADD_HLI:
-        processor.delay += 4;
-        operand.low = cgbl_bus_read(processor.hl.word);
-        break;
-    case CGBL_INSTRUCTION_ADD_L:
-        operand.low = processor.hl.low;
-        break;
-    case CGBL_INSTRUCTION_ADD_N:
-        processor.delay += 4;
-        operand.low = cgbl_bus_read(processor.pc.word++);
-        break;
-    default:
-        break;
+#define CGBL_PROCESSOR_HANDLER_FUSION(_INDEX_, _FORMAT_, _OPCODE_, ...)                                                                    \
+    static cgbl_error_e cgbl_processor_fusion_##_INDEX_(cgbl_context_t *const context) {                                                   \
+        static const uint8_t OPCODE[] = { __VA_ARGS__ };                                                                                   \
+        cgbl_error_e result = cgbl_processor_instruction_##_OPCODE_(context);                                                              \
+        for (uint8_t index = 0; (result == CGBL_SUCCESS) && (index < CGBL_LENGTH(OPCODE)) && cgbl_processor_fuse(context); ++index) {      \
+            result = INSTRUCTION[0][OPCODE[index]](context);                                                                               \
+        }                                                                                                                                  \
+        return result;                                                                                                                     \
     }
-    sum = processor.af.high + operand.low;
-    carry = processor.af.high ^ operand.low ^ sum;
-    processor.af.carry = ((carry & 0x100) == 0x100);
-    processor.af.half_carry = ((carry & 0x10) == 0x10);
-    processor.af.negative = false;
-    processor.af.zero = !(sum & 0xFF);
-    processor.af.high = sum;
-    return CGBL_SUCCESS;
-}
-
-static cgbl_error_e cgbl_processor_instruction_add_hl(void) {
-    uint32_t carry = 0, sum = 0;
-    cgbl_register_t operand = {};
-    processor.delay = 8;
-    switch (processor.instruction.opcode) {
-    case CGBL_INSTRUCTION_ADD_HL_BC:
-        operand.word = processor.bc.word;
-        break;
-    case CGBL_INSTRUCTION_ADD_HL_DE:
-        operand.word = processor.de.word;
-        break;
-    case CGBL_INSTRUCTION_ADD_HL_HL:
-        operand.word = processor.hl.word;
-        break;
-    case CGBL_INSTRUCTION_ADD_HL_SP:
-        operand.word = processor.sp.word;
-        break;
-    default:
-        break;
-    }
-    sum = processor.hl.word + operand.word;
-    carry = processor.hl.word ^ operand.word ^ sum;
-    processor.af.carry = ((carry & 0x10000) == 0x10000);
-    processor.af.half_carry = ((carry & 0x1000) == 0x1000);
-    processor.af.negative = false;
-    processor.hl.word = sum;
-    return CGBL_SUCCESS;
-}
-
-static cgbl_error_e cgbl_processor_instruction_add_sp(void) {
-    uint32_t carry = 0, sum = 0;
-    cgbl_register_t operand = { .low = cgbl_bus_read(processor.pc.word++) };
-    processor.delay = 16;
-    sum = processor.sp.word + (int8_t)operand.low;
-    carry = processor.sp.word ^ (int8_t)operand.low ^ sum;
-    processor.af.carry = ((carry & 0x100) == 0x100);
-    processor.af.half_carry = ((carry & 0x10) == 0x10);
-    processor.af.negative = false;
-    processor.af.zero = false;
-    processor.sp.word = sum;
-    return CGBL_SUCCESS;
-}
-
-static cgbl_error_e cgbl_processor_instruction_and(void) {
-    processor.delay = 4;
-    switch (processor.instruction.opcode) {
-    case CGBL_INSTRUCTION_AND_A:
-        break;
-    case CGBL_INSTRUCTION_AND_B:
-        processor.af.high &= processor.bc.high;
-        break;
-    case CGBL_INSTRUCTION_AND_C:
-        processor.af.high &= processor.bc.low;
-        break;
-    case CGBL_INSTRUCTION_AND_D:
-        processor.af.high &= processor.de.high;
-        break;
-    case CGBL_INSTRUCTION_AND_E:
-        processor.af.high &= processor.de.low;
-        break;
-    case CGBL_INSTRUCTION_AND_H:
-        processor.af.high &= processor.hl.high;
-        break;
-    case CGBL_INSTRUCTION_AND_HLI:
-        processor.delay += 4;
-        processor.af.high &= cgbl_bus_read(processor.hl.word);
-        break;
-    case CGBL_INSTRUCTION_AND_L:
-        processor.af.high &= processor.hl.low;
-        break;
-    case CGBL_INSTRUCTION_AND_N:
-        processor.delay += 4;
-        processor.af.high &= cgbl_bus_read(processor.pc.word++);
-        break;
-    default:
-        break;
-    }
-    processor.af.carry = false;
-    processor.af.half_carry = true;
-    processor.af.negative = false;
-    processor.af.zero = !processor.af.high;
-    return CGBL_SUCCESS;
-}
-
-static cgbl_error_e cgbl_processor_instruction_bit(void) {
-    processor.delay = 8;
-    switch (processor.instruction.opcode) {
-    case CGBL_INSTRUCTION_BIT_0_A:
-    case CGBL_INSTRUCTION_BIT_1_A:
-    case CGBL_INSTRUCTION_BIT_2_A:
-    case CGBL_INSTRUCTION_BIT_3_A:
-    case CGBL_INSTRUCTION_BIT_4_A:
-    case CGBL_INSTRUCTION_BIT_5_A:
-    case CGBL_INSTRUCTION_BIT_6_A:
-    case CGBL_INSTRUCTION_BIT_7_A:
-        processor.af.zero = !(processor.af.high & (1 << ((processor.instruction.opcode - CGBL_INSTRUCTION_BIT_0_A) / 8)));
-        break;
-    case CGBL_INSTRUCTION_BIT_0_B:
-    case CGBL_INSTRUCTION_BIT_1_B:
-    case CGBL_INSTRUCTION_BIT_2_B:
-    case CGBL_INSTRUCTION_BIT_3_B:
-    case CGBL_INSTRUCTION_BIT_4_B:
-    case CGBL_INSTRUCTION_BIT_5_B:
-    case CGBL_INSTRUCTION_BIT_6_B:
-    case CGBL_INSTRUCTION_BIT_7_B:
-        processor.af.zero = !(processor.bc.high & (1 << ((processor.instruction.opcode - CGBL_INSTRUCTION_BIT_0_B) / 8)));
-        break;
-    case CGBL_INSTRUCTION_BIT_0_C:
-    case CGBL_INSTRUCTION_BIT_1_C:
-    case CGBL_INSTRUCTION_BIT_2_C:
-    case CGBL_INSTRUCTION_BIT_3_C:
-    case CGBL_INSTRUCTION_BIT_4_C:
-    case CGBL_INSTRUCTION_BIT_5_C:
-    case CGBL_INSTRUCTION_BIT_6_C:
-    case CGBL_INSTRUCTION_BIT_7_C:
-        processor.af.zero = !(processor.bc.low & (1 << ((processor.instruction.opcode - CGBL_INSTRUCTION_BIT_0_C) / 8)));
-        break;
-    case CGBL_INSTRUCTION_BIT_0_D:
-    case CGBL_INSTRUCTION_BIT_1_D:
-    case CGBL_INSTRUCTION_BIT_2_D:
-    case CGBL_INSTRUCTION_BIT_3_D:
-    case CGBL_INSTRUCTION_BIT_4_D:
-    case CGBL_INSTRUCTION_BIT_5_D:
-    case CGBL_INSTRUCTION_BIT_6_D:
-    case CGBL_INSTRUCTION_BIT_7_D:
-        processor.af.zero = !(processor.de.high & (1 << ((processor.instruction.opcode - CGBL_INSTRUCTION_BIT_0_D) / 8)));
-        break;
-    case CGBL_INSTRUCTION_BIT_0_E:
-    case CGBL_INSTRUCTION_BIT_1_E:
-    case CGBL_INSTRUCTION_BIT_2_E:
-    case CGBL_INSTRUCTION_BIT_3_E:
-    case CGBL_INSTRUCTION_BIT_4_E:
-    case CGBL_INSTRUCTION_BIT_5_E:
-    case CGBL_INSTRUCTION_BIT_6_E:
-    case CGBL_INSTRUCTION_BIT_7_E:
-        processor.af.zero = !(processor.de.low & (1 << ((processor.instruction.opcode - CGBL_INSTRUCTION_BIT_0_E) / 8)));
-        break;
-    case CGBL_INSTRUCTION_BIT_0_H:
-    case CGBL_INSTRUCTION_BIT_1_H:
-    case CGBL_INSTRUCTION_BIT_2_H:
-    case CGBL_INSTRUCTION_BIT_3_H:
-    case CGBL_INSTRUCTION_BIT_4_H:
-    case CGBL_INSTRUCTION_BIT_5_H:
-    case CGBL_INSTRUCTION_BIT_6_H:
-    case CGBL_INSTRUCTION_BIT_7_H:
-        processor.af.zero = !(processor.hl.high & (1 << ((processor.instruction.opcode - CGBL_INSTRUCTION_BIT_0_H) / 8)));
-        break;
-    case CGBL_INSTRUCTION_BIT_0_HLI:
-    case CGBL_INSTRUCTION_BIT_1_HLI:
-    case CGBL_INSTRUCTION_BIT_2_HLI:
-    case CGBL_INSTRUCTION_BIT_3_HLI:
-    case CGBL_INSTRUCTION_BIT_4_HLI:
-    case CGBL_INSTRUCTION_BIT_5_HLI:
-    case CGBL_INSTRUCTION_BIT_6_HLI:
-    case CGBL_INSTRUCTION_BIT_7_HLI:
-        processor.delay += 4;
-        processor.af.zero = !(cgbl_bus_read(processor.hl.word) & (1 << ((processor.instruction.opcode - CGBL_INSTRUCTION_BIT_0_HLI) / 8)));
-        break;
-    case CGBL_INSTRUCTION_BIT_0_L:
-    case CGBL_INSTRUCTION_BIT_1_L:
-    case CGBL_INSTRUCTION_BIT_2_L:
-    case CGBL_INSTRUCTION_BIT_3_L:
-    case CGBL_INSTRUCTION_BIT_4_L:
-    case CGBL_INSTRUCTION_BIT_5_L:
-    case CGBL_INSTRUCTION_BIT_6_L:
-    case CGBL_INSTRUCTION_BIT_7_L:
-        processor.af.zero = !(processor.hl.low & (1 << ((processor.instruction.opcode - CGBL_INSTRUCTION_BIT_0_L) / 8)));
-        break;
-    default:
-        break;
-    }
-    processor.af.half_carry = true;
-    processor.af.negative = false;
-    return CGBL_SUCCESS;
-}
-
-static cgbl_error_e cgbl_processor_instruction_call(void) {
-    bool taken = false;
-    cgbl_register_t operand = { .low = cgbl_bus_read(processor.pc.word++), .high = cgbl_bus_read(processor.pc.word++) };
-    processor.delay = 12;
-    switch (processor.instruction.opcode) {
-    case CGBL_INSTRUCTION_CALL:
-        taken = true;
-        break;
-    case CGBL_INSTRUCTION_CALL_C:
-        taken = processor.af.carry;
-        break;
-    case CGBL_INSTRUCTION_CALL_NC:
-        taken = !processor.af.carry;
-        break;
-    case CGBL_INSTRUCTION_CALL_NZ:
-        taken = !processor.af.zero;
-        break;
-    case CGBL_INSTRUCTION_CALL_Z:
-        taken = processor.af.zero;
-        break;
-    default:
-        break;
+#define CGBL_PROCESSOR_HANDLER_PREFIX(_OPCODE_, _CYCLES_, _FORMAT_, _OPERAND_, _OPERATION_, ...)                                           \
+    static cgbl_error_e cgbl_processor_instruction_prefix_##_OPCODE_(cgbl_context_t *const context) {                                      \
+        context->processor.delay = _CYCLES_;                                                                                               \
+        cgbl_processor_tick(context);                                                                                                      \
+        CGBL_PROCESSOR_OPERATION_##_OPERATION_(__VA_ARGS__);                                                                               \
+        return CGBL_SUCCESS;                                                                                                               \
     }
+#define CGBL_PROCESSOR_IGNORE(_OPCODE_, ...)
+#define CGBL_PROCESSOR_OPERAND(_OPCODE_, _CYCLES_, _FORMAT_, _OPERAND_, ...) [_OPCODE_] = CGBL_OPERAND_##_OPERAND_,
+#define CGBL_PROCESSOR_POINTER(_OPCODE_, ...) [_OPCODE_] = cgbl_processor_instruction_##_OPCODE_,
+#define CGBL_PROCESSOR_POINTER_FUSION(_INDEX_, _FORMAT_, ...)                                                                              \
+    { cgbl_processor_fusion_##_INDEX_, sizeof((const uint8_t[]){ __VA_ARGS__ }), { __VA_ARGS__ } },
+#define CGBL_PROCESSOR_POINTER_PREFIX(_OPCODE_, ...) [_OPCODE_] = cgbl_processor_instruction_prefix_##_OPCODE_,
+
+static inline void cgbl_processor_tick(cgbl_context_t *const context) {
+    context->processor.delay -= 4;
+    cgbl_bus_clock(context, (cgbl_bus_speed(context) == CGBL_SPEED_DOUBLE) ? 2 : 4);
+}
+
+static uint8_t cgbl_processor_fetch(cgbl_context_t *const context) {
+    cgbl_processor_tick(context);
+    return context->processor.instruction.data[context->processor.instruction.index++];
+}
+
+static uint16_t cgbl_processor_fetch_word(cgbl_context_t *const context) {
+    cgbl_register_t result = { .low = cgbl_processor_fetch(context) };
+    result.high = cgbl_processor_fetch(context);
+    return result.word;
+}
+
+static void cgbl_processor_flag_load(cgbl_context_t *const context) {
+    context->processor.flag.carry = (context->processor.af.carry << 8) | (context->processor.af.half_carry << 4);
+    context->processor.flag.negative = context->processor.af.negative;
+    context->processor.flag.result = !context->processor.af.zero;
+}
+
+static void cgbl_processor_flag_store(cgbl_context_t *const context) {
+    context->processor.af.carry = ((context->processor.flag.carry & 0x100) == 0x100);
+    context->processor.af.half_carry = ((context->processor.flag.carry & 0x10) == 0x10);
+    context->processor.af.negative = context->processor.flag.negative;
+    context->processor.af.zero = !context->processor.flag.result;
+}
+
+static inline uint8_t cgbl_processor_load(cgbl_context_t *const context, uint16_t address) {
+    cgbl_processor_tick(context);
+    return cgbl_bus_read(context, address);
+}
+
+static inline void cgbl_processor_store(cgbl_context_t *const context, uint16_t address, uint8_t data) {
+    cgbl_processor_tick(context);
+    cgbl_bus_write(context, address, data);
+}
+
+static inline uint16_t cgbl_processor_pop(cgbl_context_t *const context) {
+    cgbl_register_t result = { .low = cgbl_processor_load(context, context->processor.sp.word++) };
+    result.high = cgbl_processor_load(context, context->processor.sp.word++);
+    return result.word;
+}
+
+static inline void cgbl_processor_push(cgbl_context_t *const context, uint16_t data) {
+    cgbl_register_t operand = { .word = data };
+    cgbl_processor_tick(context);
+    cgbl_processor_store(context, --context->processor.sp.word, operand.high);
+    cgbl_processor_store(context, --context->processor.sp.word, operand.low);
+}
+
+static inline void cgbl_processor_operation_adc(cgbl_context_t *const context, uint8_t operand) {
+    uint16_t sum = context->processor.af.high + operand + ((context->processor.flag.carry >> 8) & 1);
+    context->processor.flag.carry = context->processor.af.high ^ operand ^ sum;
+    context->processor.flag.negative = false;
+    context->processor.flag.result = sum;
+    context->processor.af.high = sum;
+}
+
+static inline void cgbl_processor_operation_add(cgbl_context_t *const context, uint8_t operand) {
+    uint16_t sum = context->processor.af.high + operand;
+    context->processor.flag.carry = context->processor.af.high ^ operand ^ sum;
+    context->processor.flag.negative = false;
+    context->processor.flag.result = sum;
+    context->processor.af.high = sum;
+}
+
+static inline void cgbl_processor_operation_add_hl(cgbl_context_t *const context, uint16_t operand) {
+    uint32_t sum = context->processor.hl.word + operand;
+    context->processor.flag.carry = (context->processor.hl.word ^ operand ^ sum) >> 8;
+    context->processor.flag.negative = false;
+    context->processor.hl.word = sum;
+}
+
+static inline uint16_t cgbl_processor_operation_add_sp(cgbl_context_t *const context) {
+    int8_t operand = cgbl_processor_fetch(context);
+    uint32_t sum = context->processor.sp.word + operand;
+    context->processor.flag.carry = (context->processor.sp.word ^ operand ^ sum) & 0x110;
+    context->processor.flag.negative = false;
+    context->processor.flag.result = 1;
+    return sum;
+}
+
+static inline void cgbl_processor_operation_and(cgbl_context_t *const context, uint8_t operand) {
+    context->processor.af.high &= operand;
+    context->processor.flag.carry = 0x10;
+    context->processor.flag.negative = false;
+    context->processor.flag.result = context->processor.af.high;
+}
+
+static inline void cgbl_processor_operation_bit(cgbl_context_t *const context, uint8_t bit, uint8_t operand) {
+    context->processor.flag.carry = (context->processor.flag.carry & 0x100) | 0x10;
+    context->processor.flag.negative = false;
+    context->processor.flag.result = operand & (1 << bit);
+}
+
+static inline void cgbl_processor_operation_call(cgbl_context_t *const context, bool taken, uint8_t cycles) {
+    uint16_t operand = cgbl_processor_fetch_word(context);
     if (taken) {
-        processor.delay += 12;
-        cgbl_bus_write(--processor.sp.word, processor.pc.high);
-        cgbl_bus_write(--processor.sp.word, processor.pc.low);
-        processor.pc.word = operand.word;
+        context->processor.delay += cycles;
+        cgbl_processor_push(context, context->processor.pc.word);
+        context->processor.pc.word = operand;
     }
-    return CGBL_SUCCESS;
 }
 
-static cgbl_error_e cgbl_processor_instruction_ccf(void) {
-    processor.delay = 4;
-    processor.af.carry = !processor.af.carry;
-    processor.af.half_carry = false;
-    processor.af.negative = false;
-    return CGBL_SUCCESS;
+static inline void cgbl_processor_operation_ccf(cgbl_context_t *const context) {
+    context->processor.flag.carry = (context->processor.flag.carry & 0x100) ^ 0x100;
+    context->processor.flag.negative = false;
 }
 
-static cgbl_error_e cgbl_processor_instruction_cp(void) {
-    cgbl_register_t operand = {};
-    processor.delay = 4;
-    switch (processor.instruction.opcode) {
-    case CGBL_INSTRUCTION_CP_A:
-        operand.low = processor.af.high;
-        break;
-    case CGBL_INSTRUCTION_CP_B:
-        operand.low = processor.bc.high;
-        break;
-    case CGBL_INSTRUCTION_CP_C:
-        operand.low = processor.bc.low;
-        break;
-    case CGBL_INSTRUCTION_CP_D:
-        operand.low = processor.de.high;
-        break;
-    case CGBL_INSTRUCTION_CP_E:
-        operand.low = processor.de.low;
-        break;
-    case CGBL_INSTRUCTION_CP_H:
-        operand.low = processor.hl.high;
-        break;
-    case CGBL_INSTRUCTION_CP_HLI:
-        processor.delay += 4;
-        operand.low = cgbl_bus_read(processor.hl.word);
-        break;
-    case CGBL_INSTRUCTION_CP_L:
-        operand.low = processor.hl.low;
-        break;
-    case CGBL_INSTRUCTION_CP_N:
-        processor.delay += 4;
-        operand.low = cgbl_bus_read(processor.pc.word++);
-        break;
-    default:
-        break;
-    }
-    processor.af.carry = (processor.af.high < operand.low);
-    processor.af.half_carry = ((processor.af.high & 0x0F) < ((processor.af.high - operand.low) & 0x0F));
-    processor.af.negative = true;
-    processor.af.zero = (processor.af.high == operand.low);
-    return CGBL_SUCCESS;
-}
-
-static cgbl_error_e cgbl_processor_instruction_cpl(void) {
-    processor.delay = 4;
-    processor.af.high = ~processor.af.high;
-    processor.af.half_carry = true;
-    processor.af.negative = true;
-    return CGBL_SUCCESS;
-}
-
-static cgbl_error_e cgbl_processor_instruction_daa(void) {
-    processor.delay = 4;
-    if (!processor.af.negative) {
-        if (processor.af.carry || (processor.af.high > 0x99)) {
-            processor.af.high += 0x60;
-            processor.af.carry = true;
+static inline void cgbl_processor_operation_cp(cgbl_context_t *const context, uint8_t operand) {
+    uint16_t sum = context->processor.af.high - operand;
+    context->processor.flag.carry = context->processor.af.high ^ operand ^ sum;
+    context->processor.flag.negative = true;
+    context->processor.flag.result = sum;
+}
+
+static inline void cgbl_processor_operation_cpl(cgbl_context_t *const context) {
+    context->processor.af.high = ~context->processor.af.high;
+    context->processor.flag.carry |= 0x10;
+    context->processor.flag.negative = true;
+}
+
+static inline void cgbl_processor_operation_daa(cgbl_context_t *const context) {
+    uint16_t carry = context->processor.flag.carry & 0x100;
+    if (!context->processor.flag.negative) {
+        if (carry || (context->processor.af.high > 0x99)) {
+            context->processor.af.high += 0x60;
+            carry = 0x100;
         }
-        if (processor.af.half_carry || ((processor.af.high & 0xF) > 0x9)) {
-            processor.af.high += 0x6;
+        if ((context->processor.flag.carry & 0x10) || ((context->processor.af.high & 0xF) > 0x9)) {
+            context->processor.af.high += 0x6;
         }
     } else {
-        if (processor.af.carry) {
-            processor.af.high -= 0x60;
+        if (carry) {
+            context->processor.af.high -= 0x60;
         }
-        if (processor.af.half_carry) {
-            processor.af.high -= 0x6;
+        if (context->processor.flag.carry & 0x10) {
+            context->processor.af.high -= 0x6;
         }
     }
-    processor.af.half_carry = false;
-    processor.af.zero = !processor.af.high;
-    return CGBL_SUCCESS;
+    context->processor.flag.carry = carry;
+    context->processor.flag.result = context->processor.af.high;
 }
 
-static cgbl_error_e cgbl_processor_instruction_dec(void) {
-    cgbl_register_t operand = {};
-    processor.delay = 4;
-    switch (processor.instruction.opcode) {
-    case CGBL_INSTRUCTION_DEC_A:
-        operand.low = --processor.af.high;
-        break;
-    case CGBL_INSTRUCTION_DEC_B:
-        operand.low = --processor.bc.high;
-        break;
-    case CGBL_INSTRUCTION_DEC_C:
-        operand.low = --processor.bc.low;
-        break;
-    case CGBL_INSTRUCTION_DEC_D:
-        operand.low = --processor.de.high;
-        break;
-    case CGBL_INSTRUCTION_DEC_E:
-        operand.low = --processor.de.low;
-        break;
-    case CGBL_INSTRUCTION_DEC_H:
-        operand.low = --processor.hl.high;
-        break;
-    case CGBL_INSTRUCTION_DEC_HLI:
-        processor.delay += 8;
-        operand.low = cgbl_bus_read(processor.hl.word) - 1;
-        cgbl_bus_write(processor.hl.word, operand.low);
-        break;
-    case CGBL_INSTRUCTION_DEC_L:
-        operand.low = --processor.hl.low;
-        break;
-    default:
-        break;
-    }
-    processor.af.half_carry = ((operand.low & 0x0F) == 0x0F);
-    processor.af.negative = true;
-    processor.af.zero = !operand.low;
-    return CGBL_SUCCESS;
-}
-
-static cgbl_error_e cgbl_processor_instruction_dec_16(void) {
-    processor.delay = 8;
-    switch (processor.instruction.opcode) {
-    case CGBL_INSTRUCTION_DEC_BC:
-        --processor.bc.word;
-        break;
-    case CGBL_INSTRUCTION_DEC_DE:
-        --processor.de.word;
-        break;
-    case CGBL_INSTRUCTION_DEC_HL:
-        --processor.hl.word;
-        break;
-    case CGBL_INSTRUCTION_DEC_SP:
-        --processor.sp.word;
-        break;
-    default:
-        break;
-    }
-    return CGBL_SUCCESS;
+static inline uint8_t cgbl_processor_operation_dec(cgbl_context_t *const context, uint8_t operand) {
+    uint8_t result = operand - 1;
+    context->processor.flag.carry = (context->processor.flag.carry & 0x100) | ((operand ^ result) & 0x10);
+    context->processor.flag.negative = true;
+    context->processor.flag.result = result;
+    return result;
 }
 
-static cgbl_error_e cgbl_processor_instruction_di(void) {
-    processor.delay = 4;
-    processor.interrupt.delay = 0;
-    processor.interrupt.enabled = false;
-    return CGBL_SUCCESS;
+static inline void cgbl_processor_operation_di(cgbl_context_t *const context) {
+    context->processor.interrupt.delay = 0;
+    context->processor.interrupt.enabled = false;
 }
 
-static cgbl_error_e cgbl_processor_instruction_ei(void) {
-    processor.delay = 4;
-    if (!processor.interrupt.delay) {
-        processor.interrupt.delay = 2;
+static inline void cgbl_processor_operation_ei(cgbl_context_t *const context) {
+    if (!context->processor.interrupt.delay) {
+        context->processor.interrupt.delay = 2;
     }
-    return CGBL_SUCCESS;
 }
 
-static cgbl_error_e cgbl_processor_instruction_halt(void) {
-    processor.delay = 4;
-    processor.halt_bug = !processor.interrupt.enabled && (processor.interrupt.enable.raw & processor.interrupt.flag.raw & 0x1F);
-    processor.halted = true;
-    return CGBL_SUCCESS;
+static inline void cgbl_processor_operation_halt(cgbl_context_t *const context) {
+    context->processor.halt_bug =
+        !context->processor.interrupt.enabled && (context->processor.interrupt.enable.raw & context->processor.interrupt.flag.raw & 0x1F);
+    context->processor.halted = true;
 }
 
-static cgbl_error_e cgbl_processor_instruction_inc(void) {
-    cgbl_register_t operand = {};
-    processor.delay = 4;
-    switch (processor.instruction.opcode) {
-    case CGBL_INSTRUCTION_INC_A:
-        operand.low = ++processor.af.high;
-        break;
-    case CGBL_INSTRUCTION_INC_B:
-        operand.low = ++processor.bc.high;
-        break;
-    case CGBL_INSTRUCTION_INC_C:
-        operand.low = ++processor.bc.low;
-        break;
-    case CGBL_INSTRUCTION_INC_D:
-        operand.low = ++processor.de.high;
-        break;
-    case CGBL_INSTRUCTION_INC_E:
-        operand.low = ++processor.de.low;
-        break;
-    case CGBL_INSTRUCTION_INC_H:
-        operand.low = ++processor.hl.high;
-        break;
-    case CGBL_INSTRUCTION_INC_HLI:
-        processor.delay += 8;
-        operand.low = cgbl_bus_read(processor.hl.word) + 1;
-        cgbl_bus_write(processor.hl.word, operand.low);
-        break;
-    case CGBL_INSTRUCTION_INC_L:
-        operand.low = ++processor.hl.low;
-        break;
-    default:
-        break;
-    }
-    processor.af.half_carry = !(operand.low & 0x0F);
-    processor.af.negative = false;
-    processor.af.zero = !operand.low;
-    return CGBL_SUCCESS;
+static inline uint8_t cgbl_processor_operation_inc(cgbl_context_t *const context, uint8_t operand) {
+    uint8_t result = operand + 1;
+    context->processor.flag.carry = (context->processor.flag.carry & 0x100) | ((operand ^ result) & 0x10);
+    context->processor.flag.negative = false;
+    context->processor.flag.result = result;
+    return result;
 }
 
-static cgbl_error_e cgbl_processor_instruction_inc_16(void) {
-    processor.delay = 8;
-    switch (processor.instruction.opcode) {
-    case CGBL_INSTRUCTION_INC_BC:
-        ++processor.bc.word;
-        break;
-    case CGBL_INSTRUCTION_INC_DE:
-        ++processor.de.word;
-        break;
-    case CGBL_INSTRUCTION_INC_HL:
-        ++processor.hl.word;
-        break;
-    case CGBL_INSTRUCTION_INC_SP:
-        ++processor.sp.word;
-        break;
-    default:
-        break;
+static inline void cgbl_processor_operation_jp(cgbl_context_t *const context, bool taken, uint8_t cycles) {
+    uint16_t operand = cgbl_processor_fetch_word(context);
+    if (taken) {
+        context->processor.delay += cycles;
+        context->processor.pc.word = operand;
     }
-    return CGBL_SUCCESS;
 }
 
-static cgbl_error_e cgbl_processor_instruction_jp(void) {
-    bool taken = false;
-    cgbl_register_t operand = { .low = cgbl_bus_read(processor.pc.word++), .high = cgbl_bus_read(processor.pc.word++) };
-    processor.delay = 12;
-    switch (processor.instruction.opcode) {
-    case CGBL_INSTRUCTION_JP:
-        taken = true;
-        break;
-    case CGBL_INSTRUCTION_JP_C:
-        taken = processor.af.carry;
-        break;
-    case CGBL_INSTRUCTION_JP_NC:
-        taken = !processor.af.carry;
-        break;
-    case CGBL_INSTRUCTION_JP_NZ:
-        taken = !processor.af.zero;
-        break;
-    case CGBL_INSTRUCTION_JP_Z:
-        taken = processor.af.zero;
-        break;
-    default:
-        break;
-    }
+static inline void cgbl_processor_operation_jr(cgbl_context_t *const context, bool taken, uint8_t cycles) {
+    int8_t operand = cgbl_processor_fetch(context);
     if (taken) {
-        processor.delay += 4;
-        processor.pc.word = operand.word;
+        context->processor.delay += cycles;
+        context->processor.pc.word += operand;
     }
-    return CGBL_SUCCESS;
 }
 
-static cgbl_error_e cgbl_processor_instruction_jp_hl(void) {
-    processor.delay = 4;
-    processor.pc.word = processor.hl.word;
-    return CGBL_SUCCESS;
+static inline void cgbl_processor_operation_ld_nni_sp(cgbl_context_t *const context) {
+    uint16_t operand = cgbl_processor_fetch_word(context);
+    cgbl_processor_store(context, operand, context->processor.sp.low);
+    cgbl_processor_store(context, operand + 1, context->processor.sp.high);
 }
 
-static cgbl_error_e cgbl_processor_instruction_jr(void) {
-    bool taken = false;
-    cgbl_register_t operand = { .low = cgbl_bus_read(processor.pc.word++) };
-    processor.delay = 8;
-    switch (processor.instruction.opcode) {
-    case CGBL_INSTRUCTION_JR:
-        taken = true;
-        break;
-    case CGBL_INSTRUCTION_JR_C:
-        taken = processor.af.carry;
-        break;
-    case CGBL_INSTRUCTION_JR_NC:
-        taken = !processor.af.carry;
-        break;
-    case CGBL_INSTRUCTION_JR_NZ:
-        taken = !processor.af.zero;
-        break;
-    case CGBL_INSTRUCTION_JR_Z:
-        taken = processor.af.zero;
-        break;
-    default:
-        break;
-    }
+static inline void cgbl_processor_operation_or(cgbl_context_t *const context, uint8_t operand) {
+    context->processor.af.high |= operand;
+    context->processor.flag.carry = 0;
+    context->processor.flag.negative = false;
+    context->processor.flag.result = context->processor.af.high;
+}
+
+static inline void cgbl_processor_operation_pop_af(cgbl_context_t *const context) {
+    context->processor.af.word = cgbl_processor_pop(context) & 0xFFF0;
+    cgbl_processor_flag_load(context);
+}
+
+static inline void cgbl_processor_operation_push_af(cgbl_context_t *const context) {
+    cgbl_processor_flag_store(context);
+    cgbl_processor_push(context, context->processor.af.word);
+}
+
+static inline void cgbl_processor_operation_ret(cgbl_context_t *const context, bool taken, uint8_t cycles) {
     if (taken) {
-        processor.delay += 4;
-        processor.pc.word += (int8_t)operand.low;
+        context->processor.delay += cycles;
+        if (cycles > 8) {
+            cgbl_processor_tick(context);
+        }
+        context->processor.pc.word = cgbl_processor_pop(context);
     }
-    return CGBL_SUCCESS;
 }
 
-static cgbl_error_e cgbl_processor_instruction_ld(void) {
-    cgbl_register_t operand = {};
-    processor.delay = 4;
-    switch (processor.instruction.opcode) {
-    case CGBL_INSTRUCTION_LD_A_A:
-        break;
-    case CGBL_INSTRUCTION_LD_A_B:
-        processor.af.high = processor.bc.high;
-        break;
-    case CGBL_INSTRUCTION_LD_A_BCI:
-        processor.delay += 4;
-        processor.af.high = cgbl_bus_read(processor.bc.word);
-        break;
-    case CGBL_INSTRUCTION_LD_A_C:
-        processor.af.high = processor.bc.low;
-        break;
-    case CGBL_INSTRUCTION_LD_A_D:
-        processor.af.high = processor.de.high;
-        break;
-    case CGBL_INSTRUCTION_LD_A_DEI:
-        processor.delay += 4;
-        processor.af.high = cgbl_bus_read(processor.de.word);
-        break;
-    case CGBL_INSTRUCTION_LD_A_E:
-        processor.af.high = processor.de.low;
-        break;
-    case CGBL_INSTRUCTION_LD_A_FF00_CI:
-        processor.delay += 4;
-        processor.af.high = cgbl_bus_read(0xFF00 + processor.bc.low);
-        break;
-    case CGBL_INSTRUCTION_LD_A_FF00_NI:
-        processor.delay += 8;
-        processor.af.high = cgbl_bus_read(0xFF00 + cgbl_bus_read(processor.pc.word++));
-        break;
-    case CGBL_INSTRUCTION_LD_A_H:
-        processor.af.high = processor.hl.high;
-        break;
-    case CGBL_INSTRUCTION_LD_A_HLI:
-        processor.delay += 4;
-        processor.af.high = cgbl_bus_read(processor.hl.word);
-        break;
-    case CGBL_INSTRUCTION_LD_A_HLID:
-        processor.delay += 4;
-        processor.af.high = cgbl_bus_read(processor.hl.word--);
-        break;
-    case CGBL_INSTRUCTION_LD_A_HLII:
-        processor.delay += 4;
-        processor.af.high = cgbl_bus_read(processor.hl.word++);
-        break;
-    case CGBL_INSTRUCTION_LD_A_L:
-        processor.af.high = processor.hl.low;
-        break;
-    case CGBL_INSTRUCTION_LD_A_N:
-        processor.delay += 4;
-        processor.af.high = cgbl_bus_read(processor.pc.word++);
-        break;
-    case CGBL_INSTRUCTION_LD_A_NNI:
-        processor.delay += 12;
-        operand.low = cgbl_bus_read(processor.pc.word++);
-        operand.high = cgbl_bus_read(processor.pc.word++);
-        processor.af.high = cgbl_bus_read(operand.word);
-        break;
-    case CGBL_INSTRUCTION_LD_B_A:
-        processor.bc.high = processor.af.high;
-        break;
-    case CGBL_INSTRUCTION_LD_B_B:
-        break;
-    case CGBL_INSTRUCTION_LD_B_C:
-        processor.bc.high = processor.bc.low;
-        break;
-    case CGBL_INSTRUCTION_LD_B_D:
-        processor.bc.high = processor.de.high;
-        break;
-    case CGBL_INSTRUCTION_LD_B_E:
-        processor.bc.high = processor.de.low;
-        break;
-    case CGBL_INSTRUCTION_LD_B_H:
-        processor.bc.high = processor.hl.high;
-        break;
-    case CGBL_INSTRUCTION_LD_B_HLI:
-        processor.delay += 4;
-        processor.bc.high = cgbl_bus_read(processor.hl.word);
-        break;
-    case CGBL_INSTRUCTION_LD_B_L:
-        processor.bc.high = processor.hl.low;
-        break;
-    case CGBL_INSTRUCTION_LD_B_N:
-        processor.delay += 4;
-        processor.bc.high = cgbl_bus_read(processor.pc.word++);
-        break;
-    case CGBL_INSTRUCTION_LD_BC_NN:
-        processor.delay += 8;
-        processor.bc.low = cgbl_bus_read(processor.pc.word++);
-        processor.bc.high = cgbl_bus_read(processor.pc.word++);
-        break;
-    case CGBL_INSTRUCTION_LD_BCI_A:
-        processor.delay += 4;
-        cgbl_bus_write(processor.bc.word, processor.af.high);
-        break;
-    case CGBL_INSTRUCTION_LD_C_A:
-        processor.bc.low = processor.af.high;
-        break;
-    case CGBL_INSTRUCTION_LD_C_B:
-        processor.bc.low = processor.bc.high;
-        break;
-    case CGBL_INSTRUCTION_LD_C_C:
-        break;
-    case CGBL_INSTRUCTION_LD_C_D:
-        processor.bc.low = processor.de.high;
-        break;
-    case CGBL_INSTRUCTION_LD_C_E:
-        processor.bc.low = processor.de.low;
-        break;
-    case CGBL_INSTRUCTION_LD_C_H:
-        processor.bc.low = processor.hl.high;
-        break;
-    case CGBL_INSTRUCTION_LD_C_HLI:
-        processor.delay += 4;
-        processor.bc.low = cgbl_bus_read(processor.hl.word);
-        break;
-    case CGBL_INSTRUCTION_LD_C_L:
-        processor.bc.low = processor.hl.low;
-        break;
-    case CGBL_INSTRUCTION_LD_C_N:
-        processor.delay += 4;
-        processor.bc.low = cgbl_bus_read(processor.pc.word++);
-        break;
-    case CGBL_INSTRUCTION_LD_DE_NN:
-        processor.delay += 8;
-        processor.de.low = cgbl_bus_read(processor.pc.word++);
-        processor.de.high = cgbl_bus_read(processor.pc.word++);
-        break;
-    case CGBL_INSTRUCTION_LD_DEI_A:
-        processor.delay += 4;
-        cgbl_bus_write(processor.de.word, processor.af.high);
-        break;
-    case CGBL_INSTRUCTION_LD_D_A:
-        processor.de.high = processor.af.high;
-        break;
-    case CGBL_INSTRUCTION_LD_D_B:
-        processor.de.high = processor.bc.high;
-        break;
-    case CGBL_INSTRUCTION_LD_D_C:
-        processor.de.high = processor.bc.low;
-        break;
-    case CGBL_INSTRUCTION_LD_D_D:
-        break;
-    case CGBL_INSTRUCTION_LD_D_E:
-        processor.de.high = processor.de.low;
-        break;
-    case CGBL_INSTRUCTION_LD_D_H:
-        processor.de.high = processor.hl.high;
-        break;
-    case CGBL_INSTRUCTION_LD_D_HLI:
-        processor.delay += 4;
-        processor.de.high = cgbl_bus_read(processor.hl.word);
-        break;
-    case CGBL_INSTRUCTION_LD_D_L:
-        processor.de.high = processor.hl.low;
-        break;
-    case CGBL_INSTRUCTION_LD_D_N:
-        processor.delay += 4;
-        processor.de.high = cgbl_bus_read(processor.pc.word++);
-        break;
-    case CGBL_INSTRUCTION_LD_E_A:
-        processor.de.low = processor.af.high;
-        break;
-    case CGBL_INSTRUCTION_LD_E_B:
-        processor.de.low = processor.bc.high;
-        break;
-    case CGBL_INSTRUCTION_LD_E_C:
-        processor.de.low = processor.bc.low;
-        break;
-    case CGBL_INSTRUCTION_LD_E_D:
-        processor.de.low = processor.de.high;
-        break;
-    case CGBL_INSTRUCTION_LD_E_E:
-        break;
-    case CGBL_INSTRUCTION_LD_E_H:
-        processor.de.low = processor.hl.high;
-        break;
-    case CGBL_INSTRUCTION_LD_E_HLI:
-        processor.delay += 4;
-        processor.de.low = cgbl_bus_read(processor.hl.word);
-        break;
-    case CGBL_INSTRUCTION_LD_E_L:
-        processor.de.low = processor.hl.low;
-        break;
-    case CGBL_INSTRUCTION_LD_E_N:
-        processor.delay += 4;
-        processor.de.low = cgbl_bus_read(processor.pc.word++);
-        break;
-    case CGBL_INSTRUCTION_LD_FF00_CI_A:
-        processor.delay += 4;
-        cgbl_bus_write(0xFF00 + processor.bc.low, processor.af.high);
-        break;
-    case CGBL_INSTRUCTION_LD_FF00_NI_A:
-        processor.delay += 8;
-        cgbl_bus_write(0xFF00 + cgbl_bus_read(processor.pc.word++), processor.af.high);
-        break;
-    case CGBL_INSTRUCTION_LD_H_A:
-        processor.hl.high = processor.af.high;
-        break;
-    case CGBL_INSTRUCTION_LD_H_B:
-        processor.hl.high = processor.bc.high;
-        break;
-    case CGBL_INSTRUCTION_LD_H_C:
-        processor.hl.high = processor.bc.low;
-        break;
-    case CGBL_INSTRUCTION_LD_H_D:
-        processor.hl.high = processor.de.high;
-        break;
-    case CGBL_INSTRUCTION_LD_H_E:
-        processor.hl.high = processor.de.low;
-        break;
-    case CGBL_INSTRUCTION_LD_H_H:
-        break;
-    case CGBL_INSTRUCTION_LD_H_HLI:
-        processor.delay += 4;
-        processor.hl.high = cgbl_bus_read(processor.hl.word);
-        break;
-    case CGBL_INSTRUCTION_LD_H_L:
-        processor.hl.high = processor.hl.low;
-        break;
-    case CGBL_INSTRUCTION_LD_H_N:
-        processor.delay += 4;
-        processor.hl.high = cgbl_bus_read(processor.pc.word++);
-        break;
-    case CGBL_INSTRUCTION_LD_HL_NN:
-        processor.delay += 8;
-        processor.hl.low = cgbl_bus_read(processor.pc.word++);
-        processor.hl.high = cgbl_bus_read(processor.pc.word++);
-        break;
-    case CGBL_INSTRUCTION_LD_HLI_A:
-        processor.delay += 4;
-        cgbl_bus_write(processor.hl.word, processor.af.high);
-        break;
-    case CGBL_INSTRUCTION_LD_HLI_B:
-        processor.delay += 4;
-        cgbl_bus_write(processor.hl.word, processor.bc.high);
-        break;
-    case CGBL_INSTRUCTION_LD_HLI_C:
-        processor.delay += 4;
-        cgbl_bus_write(processor.hl.word, processor.bc.low);
-        break;
-    case CGBL_INSTRUCTION_LD_HLI_D:
-        processor.delay += 4;
-        cgbl_bus_write(processor.hl.word, processor.de.high);
-        break;
-    case CGBL_INSTRUCTION_LD_HLI_E:
-        processor.delay += 4;
-        cgbl_bus_write(processor.hl.word, processor.de.low);
-        break;
-    case CGBL_INSTRUCTION_LD_HLI_H:
-        processor.delay += 4;
-        cgbl_bus_write(processor.hl.word, processor.hl.high);
-        break;
-    case CGBL_INSTRUCTION_LD_HLI_L:
-        processor.delay += 4;
-        cgbl_bus_write(processor.hl.word, processor.hl.low);
-        break;
-    case CGBL_INSTRUCTION_LD_HLI_N:
-        processor.delay += 8;
-        cgbl_bus_write(processor.hl.word, cgbl_bus_read(processor.pc.word++));
-        break;
-    case CGBL_INSTRUCTION_LD_HLID_A:
-        processor.delay += 4;
-        cgbl_bus_write(processor.hl.word--, processor.af.high);
-        break;
-    case CGBL_INSTRUCTION_LD_HLII_A:
-        processor.delay += 4;
-        cgbl_bus_write(processor.hl.word++, processor.af.high);
-        break;
-    case CGBL_INSTRUCTION_LD_L_A:
-        processor.hl.low = processor.af.high;
-        break;
-    case CGBL_INSTRUCTION_LD_L_B:
-        processor.hl.low = processor.bc.high;
-        break;
-    case CGBL_INSTRUCTION_LD_L_C:
-        processor.hl.low = processor.bc.low;
-        break;
-    case CGBL_INSTRUCTION_LD_L_D:
-        processor.hl.low = processor.de.high;
-        break;
-    case CGBL_INSTRUCTION_LD_L_E:
-        processor.hl.low = processor.de.low;
-        break;
-    case CGBL_INSTRUCTION_LD_L_H:
-        processor.hl.low = processor.hl.high;
-        break;
-    case CGBL_INSTRUCTION_LD_L_HLI:
-        processor.delay += 4;
-        processor.hl.low = cgbl_bus_read(processor.hl.word);
-        break;
-    case CGBL_INSTRUCTION_LD_L_L:
-        break;
-    case CGBL_INSTRUCTION_LD_L_N:
-        processor.delay += 4;
-        processor.hl.low = cgbl_bus_read(processor.pc.word++);
-        break;
-    case CGBL_INSTRUCTION_LD_NNI_A:
-        processor.delay += 12;
-        operand.low = cgbl_bus_read(processor.pc.word++);
-        operand.high = cgbl_bus_read(processor.pc.word++);
-        cgbl_bus_write(operand.word, processor.af.high);
-        break;
-    case CGBL_INSTRUCTION_LD_NNI_SP:
-        processor.delay += 16;
-        operand.low = cgbl_bus_read(processor.pc.word++);
-        operand.high = cgbl_bus_read(processor.pc.word++);
-        cgbl_bus_write(operand.word, processor.sp.low);
-        cgbl_bus_write(operand.word + 1, processor.sp.high);
-        break;
-    case CGBL_INSTRUCTION_LD_SP_HL:
-        processor.delay += 4;
-        processor.sp.word = processor.hl.word;
-        break;
-    case CGBL_INSTRUCTION_LD_SP_NN:
-        processor.delay += 8;
-        processor.sp.low = cgbl_bus_read(processor.pc.word++);
-        processor.sp.high = cgbl_bus_read(processor.pc.word++);
-        break;
-    default:
-        break;
+static inline void cgbl_processor_operation_reti(cgbl_context_t *const context) {
+    context->processor.interrupt.delay = 0;
+    context->processor.interrupt.enabled = true;
+    context->processor.pc.word = cgbl_processor_pop(context);
+}
+
+static inline uint8_t cgbl_processor_operation_rl(cgbl_context_t *const context, uint8_t operand) {
+    uint8_t result = (operand << 1) | ((context->processor.flag.carry >> 8) & 1);
+    context->processor.flag.carry = (operand & 0x80) << 1;
+    context->processor.flag.negative = false;
+    context->processor.flag.result = result;
+    return result;
+}
+
+static inline uint8_t cgbl_processor_operation_rlc(cgbl_context_t *const context, uint8_t operand) {
+    uint8_t result = (operand << 1) | (operand >> 7);
+    context->processor.flag.carry = (operand & 0x80) << 1;
+    context->processor.flag.negative = false;
+    context->processor.flag.result = result;
+    return result;
+}
+
+static inline void cgbl_processor_operation_rotate(cgbl_context_t *const context, uint8_t operand) {
+    context->processor.af.high = operand;
+    context->processor.flag.result = 1;
+}
+
+static inline uint8_t cgbl_processor_operation_rr(cgbl_context_t *const context, uint8_t operand) {
+    uint8_t result = (operand >> 1) | ((context->processor.flag.carry >> 1) & 0x80);
+    context->processor.flag.carry = (operand & 1) << 8;
+    context->processor.flag.negative = false;
+    context->processor.flag.result = result;
+    return result;
+}
+
+static inline uint8_t cgbl_processor_operation_rrc(cgbl_context_t *const context, uint8_t operand) {
+    uint8_t result = (operand >> 1) | (operand << 7);
+    context->processor.flag.carry = (operand & 1) << 8;
+    context->processor.flag.negative = false;
+    context->processor.flag.result = result;
+    return result;
+}
+
+static inline void cgbl_processor_operation_rst(cgbl_context_t *const context, uint16_t address) {
+    cgbl_processor_push(context, context->processor.pc.word);
+    context->processor.pc.word = address;
+}
+
+static inline void cgbl_processor_operation_sbc(cgbl_context_t *const context, uint8_t operand) {
+    uint16_t sum = context->processor.af.high - operand - ((context->processor.flag.carry >> 8) & 1);
+    context->processor.flag.carry = context->processor.af.high ^ operand ^ sum;
+    context->processor.flag.negative = true;
+    context->processor.flag.result = sum;
+    context->processor.af.high = sum;
+}
+
+static inline void cgbl_processor_operation_scf(cgbl_context_t *const context) {
+    context->processor.flag.carry = 0x100;
+    context->processor.flag.negative = false;
+}
+
+static inline uint8_t cgbl_processor_operation_sla(cgbl_context_t *const context, uint8_t operand) {
+    uint8_t result = operand << 1;
+    context->processor.flag.carry = (operand & 0x80) << 1;
+    context->processor.flag.negative = false;
+    context->processor.flag.result = result;
+    return result;
+}
+
+static inline uint8_t cgbl_processor_operation_sra(cgbl_context_t *const context, uint8_t operand) {
+    uint8_t result = (operand >> 1) | (operand & 0x80);
+    context->processor.flag.carry = (operand & 1) << 8;
+    context->processor.flag.negative = false;
+    context->processor.flag.result = result;
+    return result;
+}
+
+static inline uint8_t cgbl_processor_operation_srl(cgbl_context_t *const context, uint8_t operand) {
+    uint8_t result = operand >> 1;
+    context->processor.flag.carry = (operand & 1) << 8;
+    context->processor.flag.negative = false;
+    context->processor.flag.result = result;
+    return result;
+}
+
+static inline void cgbl_processor_operation_stop(cgbl_context_t *const context) {
+    if (!cgbl_bus_speed_change(context)) {
+        cgbl_bus_write(context, CGBL_TIMER_DIVIDER, 0);
+        context->processor.stopped = true;
     }
-    return CGBL_SUCCESS;
 }
 
-static cgbl_error_e cgbl_processor_instruction_ld_hl(void) {
-    uint32_t carry = 0, sum = 0;
-    cgbl_register_t operand = { .low = cgbl_bus_read(processor.pc.word++) };
-    processor.delay = 12;
-    sum = processor.sp.word + (int8_t)operand.low;
-    carry = processor.sp.word ^ (int8_t)operand.low ^ sum;
-    processor.af.carry = ((carry & 0x100) == 0x100);
-    processor.af.half_carry = ((carry & 0x10) == 0x10);
-    processor.af.negative = false;
-    processor.af.zero = false;
-    processor.hl.word = sum;
-    return CGBL_SUCCESS;
+static inline void cgbl_processor_operation_sub(cgbl_context_t *const context, uint8_t operand) {
+    uint16_t sum = context->processor.af.high - operand;
+    context->processor.flag.carry = context->processor.af.high ^ operand ^ sum;
+    context->processor.flag.negative = true;
+    context->processor.flag.result = sum;
+    context->processor.af.high = sum;
 }
 
-static cgbl_error_e cgbl_processor_instruction_nop(void) {
-    processor.delay = 4;
-    return CGBL_SUCCESS;
+static inline uint8_t cgbl_processor_operation_swap(cgbl_context_t *const context, uint8_t operand) {
+    uint8_t result = (operand << 4) | (operand >> 4);
+    context->processor.flag.carry = 0;
+    context->processor.flag.negative = false;
+    context->processor.flag.result = result;
+    return result;
 }
 
-static cgbl_error_e cgbl_processor_instruction_or(void) {
-    processor.delay = 4;
-    switch (processor.instruction.opcode) {
-    case CGBL_INSTRUCTION_OR_A:
-        break;
-    case CGBL_INSTRUCTION_OR_B:
-        processor.af.high |= processor.bc.high;
-        break;
-    case CGBL_INSTRUCTION_OR_C:
-        processor.af.high |= processor.bc.low;
-        break;
-    case CGBL_INSTRUCTION_OR_D:
-        processor.af.high |= processor.de.high;
-        break;
-    case CGBL_INSTRUCTION_OR_E:
-        processor.af.high |= processor.de.low;
-        break;
-    case CGBL_INSTRUCTION_OR_H:
-        processor.af.high |= processor.hl.high;
-        break;
-    case CGBL_INSTRUCTION_OR_HLI:
-        processor.delay += 4;
-        processor.af.high |= cgbl_bus_read(processor.hl.word);
-        break;
-    case CGBL_INSTRUCTION_OR_L:
-        processor.af.high |= processor.hl.low;
-        break;
-    case CGBL_INSTRUCTION_OR_N:
-        processor.delay += 4;
-        processor.af.high |= cgbl_bus_read(processor.pc.word++);
-        break;
-    default:
-        break;
-    }
-    processor.af.carry = false;
-    processor.af.half_carry = false;
-    processor.af.negative = false;
-    processor.af.zero = !processor.af.high;
-    return CGBL_SUCCESS;
-}
-
-static cgbl_error_e cgbl_processor_instruction_pop(void) {
-    processor.delay = 12;
-    switch (processor.instruction.opcode) {
-    case CGBL_INSTRUCTION_POP_AF:
-        processor.af.low = cgbl_bus_read(processor.sp.word++) & 0xF0;
-        processor.af.high = cgbl_bus_read(processor.sp.word++);
-        break;
-    case CGBL_INSTRUCTION_POP_BC:
-        processor.bc.low = cgbl_bus_read(processor.sp.word++);
-        processor.bc.high = cgbl_bus_read(processor.sp.word++);
-        break;
-    case CGBL_INSTRUCTION_POP_DE:
-        processor.de.low = cgbl_bus_read(processor.sp.word++);
-        processor.de.high = cgbl_bus_read(processor.sp.word++);
-        break;
-    case CGBL_INSTRUCTION_POP_HL:
-        processor.hl.low = cgbl_bus_read(processor.sp.word++);
-        processor.hl.high = cgbl_bus_read(processor.sp.word++);
-        break;
-    default:
-        break;
+static inline void cgbl_processor_operation_xor(cgbl_context_t *const context, uint8_t operand) {
+    context->processor.af.high ^= operand;
+    context->processor.flag.carry = 0;
+    context->processor.flag.negative = false;
+    context->processor.flag.result = context->processor.af.high;
+}
+
+CGBL_PROCESSOR_INSTRUCTION(CGBL_PROCESSOR_HANDLER, CGBL_PROCESSOR_HANDLER)
+CGBL_PROCESSOR_INSTRUCTION_PREFIX(CGBL_PROCESSOR_HANDLER_PREFIX)
+
+static const bool BRANCH[CGBL_INSTRUCTION_MAX] = { CGBL_PROCESSOR_INSTRUCTION(CGBL_PROCESSOR_IGNORE, CGBL_PROCESSOR_BRANCH) };
+
+static cgbl_error_e (*const INSTRUCTION[][CGBL_INSTRUCTION_MAX])(cgbl_context_t *const context) = {
+    { CGBL_PROCESSOR_INSTRUCTION(CGBL_PROCESSOR_POINTER, CGBL_PROCESSOR_POINTER) },
+    { CGBL_PROCESSOR_INSTRUCTION_PREFIX(CGBL_PROCESSOR_POINTER_PREFIX) },
+};
+
+static const cgbl_operand_e OPERAND[CGBL_INSTRUCTION_MAX] = { CGBL_PROCESSOR_INSTRUCTION(CGBL_PROCESSOR_OPERAND, CGBL_PROCESSOR_OPERAND) };
+
+static uint32_t cgbl_processor_generation(cgbl_context_t *const context, uint16_t address, uint16_t bank) {
+    return (bank == CGBL_BUS_BANK_NONE) ? cgbl_bus_generation(context, address) : 0;
+}
+
+static bool cgbl_processor_match(cgbl_context_t *const context, const cgbl_block_t *const block, uint16_t address) {
+    uint16_t bank = cgbl_bus_bank(context, address);
+    return (block->bank == bank) && (block->generation == cgbl_processor_generation(context, address, bank));
+}
+
+static bool cgbl_processor_fuse(cgbl_context_t *const context) {
+    const cgbl_block_t *block = context->processor.block.current;
+    const cgbl_decode_t *decode = &block->decode[context->processor.block.index];
+    if (context->processor.interrupt.delay || (context->processor.interrupt.enable.raw & context->processor.interrupt.flag.raw & 0x1F) ||
+        (context->processor.pc.word == context->processor.loop.address) ||
+        ((block->address + decode->offset) != context->processor.pc.word) || !cgbl_processor_match(context, block, block->address) ||
+        !cgbl_bus_advance(context, (context->processor.delay / ((cgbl_bus_speed(context) == CGBL_SPEED_DOUBLE) ? 2 : 1)) - 1)) {
+        return false;
     }
-    return CGBL_SUCCESS;
+    context->processor.instruction.address = context->processor.pc.word;
+    context->processor.instruction.index = 0;
+    context->processor.instruction.opcode = decode->opcode;
+    context->processor.instruction.data[0] = decode->data[1];
+    context->processor.instruction.data[1] = decode->data[2];
+    context->processor.pc.word += decode->length;
+    ++context->processor.block.index;
+    return true;
 }
 
-static cgbl_error_e cgbl_processor_instruction_push(void) {
-    processor.delay = 16;
-    switch (processor.instruction.opcode) {
-    case CGBL_INSTRUCTION_PUSH_AF:
-        cgbl_bus_write(--processor.sp.word, processor.af.high);
-        cgbl_bus_write(--processor.sp.word, processor.af.low);
-        break;
-    case CGBL_INSTRUCTION_PUSH_BC:
-        cgbl_bus_write(--processor.sp.word, processor.bc.high);
-        cgbl_bus_write(--processor.sp.word, processor.bc.low);
-        break;
-    case CGBL_INSTRUCTION_PUSH_DE:
-        cgbl_bus_write(--processor.sp.word, processor.de.high);
-        cgbl_bus_write(--processor.sp.word, processor.de.low);
-        break;
-    case CGBL_INSTRUCTION_PUSH_HL:
-        cgbl_bus_write(--processor.sp.word, processor.hl.high);
-        cgbl_bus_write(--processor.sp.word, processor.hl.low);
-        break;
-    default:
-        break;
+CGBL_PROCESSOR_FUSION(CGBL_PROCESSOR_HANDLER_FUSION)
+
+static const cgbl_fusion_t FUSION[] = { CGBL_PROCESSOR_FUSION(CGBL_PROCESSOR_POINTER_FUSION) };
+
+static void cgbl_processor_decode(cgbl_context_t *const context, cgbl_block_t *const block, const uint8_t *address, uint16_t bank,
+                                  uint32_t generation) {
+    const uint8_t *begin = address;
+    uint16_t offset = context->processor.pc.word & 0xFF;
+    block->address = context->processor.pc.word;
+    block->bank = bank;
+    block->generation = generation;
+    block->count = 0;
+    while (block->count < CGBL_PROCESSOR_BLOCK_LENGTH) {
+        cgbl_decode_t *decode = &block->decode[block->count];
+        bool prefix = (address[0] == CGBL_INSTRUCTION_PREFIX);
+        uint8_t length = prefix ? 2 : (OPERAND[address[0]] + 1);
+        if ((offset + length) > 0x100) {
+            break;
+        }
+        decode->opcode = address[prefix];
+        decode->offset = address - begin;
+        decode->handler = INSTRUCTION[prefix][decode->opcode];
+        decode->length = length;
+        memcpy(decode->data, address, length);
+        ++block->count;
+        if (!prefix && BRANCH[decode->opcode]) {
+            break;
+        }
+        address += length;
+        offset += length;
     }
-    return CGBL_SUCCESS;
-}
-
-static cgbl_error_e cgbl_processor_instruction_res(void) {
-    processor.delay = 8;
-    switch (processor.instruction.opcode) {
-    case CGBL_INSTRUCTION_RES_0_A:
-    case CGBL_INSTRUCTION_RES_1_A:
-    case CGBL_INSTRUCTION_RES_2_A:
-    case CGBL_INSTRUCTION_RES_3_A:
-    case CGBL_INSTRUCTION_RES_4_A:
-    case CGBL_INSTRUCTION_RES_5_A:
-    case CGBL_INSTRUCTION_RES_6_A:
-    case CGBL_INSTRUCTION_RES_7_A:
-        processor.af.high &= ~(1 << ((processor.instruction.opcode - CGBL_INSTRUCTION_RES_0_A) / 8));
-        break;
-    case CGBL_INSTRUCTION_RES_0_B:
-    case CGBL_INSTRUCTION_RES_1_B:
-    case CGBL_INSTRUCTION_RES_2_B:
-    case CGBL_INSTRUCTION_RES_3_B:
-    case CGBL_INSTRUCTION_RES_4_B:
-    case CGBL_INSTRUCTION_RES_5_B:
-    case CGBL_INSTRUCTION_RES_6_B:
-    case CGBL_INSTRUCTION_RES_7_B:
-        processor.bc.high &= ~(1 << ((processor.instruction.opcode - CGBL_INSTRUCTION_RES_0_B) / 8));
-        break;
-    case CGBL_INSTRUCTION_RES_0_C:
-    case CGBL_INSTRUCTION_RES_1_C:
-    case CGBL_INSTRUCTION_RES_2_C:
-    case CGBL_INSTRUCTION_RES_3_C:
-    case CGBL_INSTRUCTION_RES_4_C:
-    case CGBL_INSTRUCTION_RES_5_C:
-    case CGBL_INSTRUCTION_RES_6_C:
-    case CGBL_INSTRUCTION_RES_7_C:
-        processor.bc.low &= ~(1 << ((processor.instruction.opcode - CGBL_INSTRUCTION_RES_0_C) / 8));
-        break;
-    case CGBL_INSTRUCTION_RES_0_D:
-    case CGBL_INSTRUCTION_RES_1_D:
-    case CGBL_INSTRUCTION_RES_2_D:
-    case CGBL_INSTRUCTION_RES_3_D:
-    case CGBL_INSTRUCTION_RES_4_D:
-    case CGBL_INSTRUCTION_RES_5_D:
-    case CGBL_INSTRUCTION_RES_6_D:
-    case CGBL_INSTRUCTION_RES_7_D:
-        processor.de.high &= ~(1 << ((processor.instruction.opcode - CGBL_INSTRUCTION_RES_0_D) / 8));
-        break;
-    case CGBL_INSTRUCTION_RES_0_E:
-    case CGBL_INSTRUCTION_RES_1_E:
-    case CGBL_INSTRUCTION_RES_2_E:
-    case CGBL_INSTRUCTION_RES_3_E:
-    case CGBL_INSTRUCTION_RES_4_E:
-    case CGBL_INSTRUCTION_RES_5_E:
-    case CGBL_INSTRUCTION_RES_6_E:
-    case CGBL_INSTRUCTION_RES_7_E:
-        processor.de.low &= ~(1 << ((processor.instruction.opcode - CGBL_INSTRUCTION_RES_0_E) / 8));
-        break;
-    case CGBL_INSTRUCTION_RES_0_H:
-    case CGBL_INSTRUCTION_RES_1_H:
-    case CGBL_INSTRUCTION_RES_2_H:
-    case CGBL_INSTRUCTION_RES_3_H:
-    case CGBL_INSTRUCTION_RES_4_H:
-    case CGBL_INSTRUCTION_RES_5_H:
-    case CGBL_INSTRUCTION_RES_6_H:
-    case CGBL_INSTRUCTION_RES_7_H:
-        processor.hl.high &= ~(1 << ((processor.instruction.opcode - CGBL_INSTRUCTION_RES_0_H) / 8));
-        break;
-    case CGBL_INSTRUCTION_RES_0_HLI:
-    case CGBL_INSTRUCTION_RES_1_HLI:
-    case CGBL_INSTRUCTION_RES_2_HLI:
-    case CGBL_INSTRUCTION_RES_3_HLI:
-    case CGBL_INSTRUCTION_RES_4_HLI:
-    case CGBL_INSTRUCTION_RES_5_HLI:
-    case CGBL_INSTRUCTION_RES_6_HLI:
-    case CGBL_INSTRUCTION_RES_7_HLI:
-        processor.delay += 8;
-        cgbl_bus_write(processor.hl.word,
-                       cgbl_bus_read(processor.hl.word) & ~(1 << ((processor.instruction.opcode - CGBL_INSTRUCTION_RES_0_HLI) / 8)));
-        break;
-    case CGBL_INSTRUCTION_RES_0_L:
-    case CGBL_INSTRUCTION_RES_1_L:
-    case CGBL_INSTRUCTION_RES_2_L:
-    case CGBL_INSTRUCTION_RES_3_L:
-    case CGBL_INSTRUCTION_RES_4_L:
-    case CGBL_INSTRUCTION_RES_5_L:
-    case CGBL_INSTRUCTION_RES_6_L:
-    case CGBL_INSTRUCTION_RES_7_L:
-        processor.hl.low &= ~(1 << ((processor.instruction.opcode - CGBL_INSTRUCTION_RES_0_L) / 8));
-        break;
-    default:
-        break;
+    for (uint8_t index = 0; context->processor.fuse && (index < block->count); ++index) {
+        for (uint8_t fusion = 0; fusion < CGBL_LENGTH(FUSION); ++fusion) {
+            uint8_t length = 0;
+            while ((length < FUSION[fusion].length) && ((index + length) < block->count) &&
+                   (block->decode[index + length].data[0] == FUSION[fusion].opcode[length])) {
+                ++length;
+            }
+            if (length == FUSION[fusion].length) {
+                block->decode[index].handler = FUSION[fusion].handler;
+                break;
+            }
+        }
     }
-    return CGBL_SUCCESS;
 }
 
-static cgbl_error_e cgbl_processor_instruction_ret(void) {
-    bool taken = false;
-    processor.delay = 8;
-    switch (processor.instruction.opcode) {
-    case CGBL_INSTRUCTION_RET:
-        taken = true;
-        break;
-    case CGBL_INSTRUCTION_RET_C:
-        taken = processor.af.carry;
-        break;
-    case CGBL_INSTRUCTION_RET_NC:
-        taken = !processor.af.carry;
-        break;
-    case CGBL_INSTRUCTION_RET_NZ:
-        taken = !processor.af.zero;
-        break;
-    case CGBL_INSTRUCTION_RET_Z:
-        taken = processor.af.zero;
-        break;
-    default:
-        break;
+static bool cgbl_processor_loop_match(cgbl_context_t *const context) {
+    return (context->processor.loop.af.word == context->processor.af.word) &&
+           (context->processor.loop.bc.word == context->processor.bc.word) &&
+           (context->processor.loop.de.word == context->processor.de.word) &&
+           (context->processor.loop.hl.word == context->processor.hl.word) &&
+           (context->processor.loop.sp.word == context->processor.sp.word) &&
+           (context->processor.loop.enabled == context->processor.interrupt.enabled) &&
+           (context->processor.loop.delay == context->processor.interrupt.delay) &&
+           (context->processor.loop.halt_bug == context->processor.halt_bug);
+}
+
+static bool cgbl_processor_loop(cgbl_context_t *const context) {
+    uint64_t cycle = cgbl_bus_cycle(context), deadline = 0;
+    cgbl_processor_flag_store(context);
+    if (context->processor.loop.valid && cgbl_processor_loop_match(context) && cgbl_bus_watched(context, &deadline)) {
+        uint32_t length = cycle - context->processor.loop.cycle, count = ((deadline + 1) - cycle) / length;
+        if (count) {
+            context->processor.delay = count * length * ((cgbl_bus_speed(context) == CGBL_SPEED_DOUBLE) ? 2 : 1);
+            context->processor.loop.valid = false;
+            return true;
+        }
     }
-    if (taken) {
-        processor.delay += (processor.instruction.opcode == CGBL_INSTRUCTION_RET) ? 8 : 12;
-        processor.pc.low = cgbl_bus_read(processor.sp.word++);
-        processor.pc.high = cgbl_bus_read(processor.sp.word++);
+    context->processor.loop.valid = true;
+    context->processor.loop.cycle = cycle;
+    context->processor.loop.enabled = context->processor.interrupt.enabled;
+    context->processor.loop.halt_bug = context->processor.halt_bug;
+    context->processor.loop.delay = context->processor.interrupt.delay;
+    context->processor.loop.af = context->processor.af;
+    context->processor.loop.bc = context->processor.bc;
+    context->processor.loop.de = context->processor.de;
+    context->processor.loop.hl = context->processor.hl;
+    context->processor.loop.sp = context->processor.sp;
+    cgbl_bus_watch(context);
+    return false;
+}
+
+#ifdef CGBL_PROCESSOR_PROFILE
+static struct {
+    uint16_t address;
+    uint8_t length;
+    uint8_t opcode[CGBL_PROCESSOR_FUSION_LENGTH];
+    struct {
+        uint64_t count;
+        uint8_t length;
+        uint8_t opcode[CGBL_PROCESSOR_FUSION_LENGTH];
+    } entry[CGBL_PROCESSOR_PROFILE_COUNT];
+} PROFILE = {};
+
+static void cgbl_processor_profile(cgbl_context_t *const context, bool prefix) {
+    if (prefix || (context->processor.instruction.address != PROFILE.address)) {
+        PROFILE.length = 0;
     }
-    return CGBL_SUCCESS;
-}
-
-static cgbl_error_e cgbl_processor_instruction_reti(void) {
-    processor.delay = 16;
-    processor.interrupt.delay = 0;
-    processor.interrupt.enabled = true;
-    processor.pc.low = cgbl_bus_read(processor.sp.word++);
-    processor.pc.high = cgbl_bus_read(processor.sp.word++);
-    return CGBL_SUCCESS;
-}
-
-static cgbl_error_e cgbl_processor_instruction_rl(void) {
-    bool carry = processor.af.carry;
-    cgbl_register_t operand = {};
-    processor.delay = 8;
-    switch (processor.instruction.opcode) {
-    case CGBL_INSTRUCTION_RL_A:
-        processor.af.carry = ((processor.af.high & 0x80) == 0x80);
-        processor.af.high = (processor.af.high << 1) | (carry ? 1 : 0);
-        processor.af.zero = !processor.af.high;
-        break;
-    case CGBL_INSTRUCTION_RL_B:
-        processor.af.carry = ((processor.bc.high & 0x80) == 0x80);
-        processor.bc.high = (processor.bc.high << 1) | (carry ? 1 : 0);
-        processor.af.zero = !processor.bc.high;
-        break;
-    case CGBL_INSTRUCTION_RL_C:
-        processor.af.carry = ((processor.bc.low & 0x80) == 0x80);
-        processor.bc.low = (processor.bc.low << 1) | (carry ? 1 : 0);
-        processor.af.zero = !processor.bc.low;
-        break;
-    case CGBL_INSTRUCTION_RL_D:
-        processor.af.carry = ((processor.de.high & 0x80) == 0x80);
-        processor.de.high = (processor.de.high << 1) | (carry ? 1 : 0);
-        processor.af.zero = !processor.de.high;
-        break;
-    case CGBL_INSTRUCTION_RL_E:
-        processor.af.carry = ((processor.de.low & 0x80) == 0x80);
-        processor.de.low = (processor.de.low << 1) | (carry ? 1 : 0);
-        processor.af.zero = !processor.de.low;
-        break;
-    case CGBL_INSTRUCTION_RL_H:
-        processor.af.carry = ((processor.hl.high & 0x80) == 0x80);
-        processor.hl.high = (processor.hl.high << 1) | (carry ? 1 : 0);
-        processor.af.zero = !processor.hl.high;
-        break;
-    case CGBL_INSTRUCTION_RL_HLI:
-        processor.delay += 8;
-        operand.low = cgbl_bus_read(processor.hl.word);
-        processor.af.carry = ((operand.low & 0x80) == 0x80);
-        operand.low = (operand.low << 1) | (carry ? 1 : 0);
-        processor.af.zero = !operand.low;
-        cgbl_bus_write(processor.hl.word, operand.low);
-        break;
-    case CGBL_INSTRUCTION_RL_L:
-        processor.af.carry = ((processor.hl.low & 0x80) == 0x80);
-        processor.hl.low = (processor.hl.low << 1) | (carry ? 1 : 0);
-        processor.af.zero = !processor.hl.low;
-        break;
-    default:
-        break;
+    if (!prefix) {
+        if (PROFILE.length == CGBL_PROCESSOR_FUSION_LENGTH) {
+            memmove(PROFILE.opcode, PROFILE.opcode + 1, --PROFILE.length);
+        }
+        PROFILE.opcode[PROFILE.length++] = context->processor.instruction.opcode;
+        for (uint8_t length = 2; length <= PROFILE.length; ++length) {
+            const uint8_t *opcode = PROFILE.opcode + PROFILE.length - length;
+            uint32_t index = length;
+            for (uint8_t offset = 0; offset < length; ++offset) {
+                index = (index * 31) + opcode[offset];
+            }
+            for (index &= CGBL_PROCESSOR_PROFILE_COUNT - 1;
+                 PROFILE.entry[index].length &&
+                 ((PROFILE.entry[index].length != length) || memcmp(PROFILE.entry[index].opcode, opcode, length));
+                 index = (index + 1) & (CGBL_PROCESSOR_PROFILE_COUNT - 1)) {
+            }
+            PROFILE.entry[index].length = length;
+            memcpy(PROFILE.entry[index].opcode, opcode, length);
+            ++PROFILE.entry[index].count;
+        }
+        if (BRANCH[context->processor.instruction.opcode]) {
+            PROFILE.length = 0;
+        }
     }
-    processor.af.half_carry = false;
-    processor.af.negative = false;
-    return CGBL_SUCCESS;
-}
-
-static cgbl_error_e cgbl_processor_instruction_rla(void) {
-    bool carry = processor.af.carry;
-    processor.delay = 4;
-    processor.af.carry = ((processor.af.high & 0x80) == 0x80);
-    processor.af.high = (processor.af.high << 1) | (carry ? 1 : 0);
-    processor.af.half_carry = false;
-    processor.af.negative = false;
-    processor.af.zero = false;
-    return CGBL_SUCCESS;
-}
-
-static cgbl_error_e cgbl_processor_instruction_rlc(void) {
-    cgbl_register_t operand = {};
-    processor.delay = 8;
-    switch (processor.instruction.opcode) {
-    case CGBL_INSTRUCTION_RLC_A:
-        processor.af.carry = ((processor.af.high & 0x80) == 0x80);
-        processor.af.high = (processor.af.high << 1) | (processor.af.carry ? 1 : 0);
-        processor.af.zero = !processor.af.high;
-        break;
-    case CGBL_INSTRUCTION_RLC_B:
-        processor.af.carry = ((processor.bc.high & 0x80) == 0x80);
-        processor.bc.high = (processor.bc.high << 1) | (processor.af.carry ? 1 : 0);
-        processor.af.zero = !processor.bc.high;
-        break;
-    case CGBL_INSTRUCTION_RLC_C:
-        processor.af.carry = ((processor.bc.low & 0x80) == 0x80);
-        processor.bc.low = (processor.bc.low << 1) | (processor.af.carry ? 1 : 0);
-        processor.af.zero = !processor.bc.low;
-        break;
-    case CGBL_INSTRUCTION_RLC_D:
-        processor.af.carry = ((processor.de.high & 0x80) == 0x80);
-        processor.de.high = (processor.de.high << 1) | (processor.af.carry ? 1 : 0);
-        processor.af.zero = !processor.de.high;
-        break;
-    case CGBL_INSTRUCTION_RLC_E:
-        processor.af.carry = ((processor.de.low & 0x80) == 0x80);
-        processor.de.low = (processor.de.low << 1) | (processor.af.carry ? 1 : 0);
-        processor.af.zero = !processor.de.low;
-        break;
-    case CGBL_INSTRUCTION_RLC_H:
-        processor.af.carry = ((processor.hl.high & 0x80) == 0x80);
-        processor.hl.high = (processor.hl.high << 1) | (processor.af.carry ? 1 : 0);
-        processor.af.zero = !processor.hl.high;
-        break;
-    case CGBL_INSTRUCTION_RLC_HLI:
-        processor.delay += 8;
-        operand.low = cgbl_bus_read(processor.hl.word);
-        processor.af.carry = ((operand.low & 0x80) == 0x80);
-        operand.low = (operand.low << 1) | (processor.af.carry ? 1 : 0);
-        processor.af.zero = !operand.low;
-        cgbl_bus_write(processor.hl.word, operand.low);
-        break;
-    case CGBL_INSTRUCTION_RLC_L:
-        processor.af.carry = ((processor.hl.low & 0x80) == 0x80);
-        processor.hl.low = (processor.hl.low << 1) | (processor.af.carry ? 1 : 0);
-        processor.af.zero = !processor.hl.low;
-        break;
-    default:
-        break;
+    PROFILE.address = context->processor.pc.word;
+}
+
+static void cgbl_processor_profile_dump(void) {
+    for (uint32_t index = 0; index < CGBL_PROCESSOR_PROFILE_COUNT; ++index) {
+        if (PROFILE.entry[index].length) {
+            fprintf(stdout, "%llu", (unsigned long long)PROFILE.entry[index].count);
+            for (uint8_t offset = 0; offset < PROFILE.entry[index].length; ++offset) {
+                fprintf(stdout, " %02X", PROFILE.entry[index].opcode[offset]);
+            }
+            fprintf(stdout, "\n");
+        }
     }
-    processor.af.half_carry = false;
-    processor.af.negative = false;
-    return CGBL_SUCCESS;
-}
-
-static cgbl_error_e cgbl_processor_instruction_rlca(void) {
-    processor.delay = 4;
-    processor.af.carry = ((processor.af.high & 0x80) == 0x80);
-    processor.af.high = (processor.af.high << 1) | (processor.af.carry ? 1 : 0);
-    processor.af.half_carry = false;
-    processor.af.negative = false;
-    processor.af.zero = false;
-    return CGBL_SUCCESS;
-}
-
-static cgbl_error_e cgbl_processor_instruction_rr(void) {
-    bool carry = processor.af.carry;
-    cgbl_register_t operand = {};
-    processor.delay = 8;
-    switch (processor.instruction.opcode) {
-    case CGBL_INSTRUCTION_RR_A:
-        processor.af.carry = ((processor.af.high & 1) == 1);
-        processor.af.high = (processor.af.high >> 1) | (carry ? 0x80 : 0);
-        processor.af.zero = !processor.af.high;
-        break;
-    case CGBL_INSTRUCTION_RR_B:
-        processor.af.carry = ((processor.bc.high & 1) == 1);
-        processor.bc.high = (processor.bc.high >> 1) | (carry ? 0x80 : 0);
-        processor.af.zero = !processor.bc.high;
-        break;
-    case CGBL_INSTRUCTION_RR_C:
-        processor.af.carry = ((processor.bc.low & 1) == 1);
-        processor.bc.low = (processor.bc.low >> 1) | (carry ? 0x80 : 0);
-        processor.af.zero = !processor.bc.low;
-        break;
-    case CGBL_INSTRUCTION_RR_D:
-        processor.af.carry = ((processor.de.high & 1) == 1);
-        processor.de.high = (processor.de.high >> 1) | (carry ? 0x80 : 0);
-        processor.af.zero = !processor.de.high;
-        break;
-    case CGBL_INSTRUCTION_RR_E:
-        processor.af.carry = ((processor.de.low & 1) == 1);
-        processor.de.low = (processor.de.low >> 1) | (carry ? 0x80 : 0);
-        processor.af.zero = !processor.de.low;
-        break;
-    case CGBL_INSTRUCTION_RR_H:
-        processor.af.carry = ((processor.hl.high & 1) == 1);
-        processor.hl.high = (processor.hl.high >> 1) | (carry ? 0x80 : 0);
-        processor.af.zero = !processor.hl.high;
-        break;
-    case CGBL_INSTRUCTION_RR_HLI:
-        processor.delay += 8;
-        operand.low = cgbl_bus_read(processor.hl.word);
-        processor.af.carry = ((operand.low & 1) == 1);
-        operand.low = (operand.low >> 1) | (carry ? 0x80 : 0);
-        processor.af.zero = !operand.low;
-        cgbl_bus_write(processor.hl.word, operand.low);
-        break;
-    case CGBL_INSTRUCTION_RR_L:
-        processor.af.carry = ((processor.hl.low & 1) == 1);
-        processor.hl.low = (processor.hl.low >> 1) | (carry ? 0x80 : 0);
-        processor.af.zero = !processor.hl.low;
-        break;
-    default:
-        break;
+}
+#endif /* CGBL_PROCESSOR_PROFILE */
+
+static const cgbl_decode_t *cgbl_processor_lookup(cgbl_context_t *const context) {
+    const uint8_t *data = NULL;
+    cgbl_block_t *block = context->processor.block.current;
+    uint16_t address = context->processor.pc.word, bank = cgbl_bus_bank(context, address);
+    uint32_t generation = cgbl_processor_generation(context, address, bank);
+    if (block && (context->processor.block.index < block->count) &&
+        ((block->address + block->decode[context->processor.block.index].offset) == address) && (block->bank == bank) &&
+        (block->generation == generation)) {
+        return &block->decode[context->processor.block.index++];
     }
-    processor.af.half_carry = false;
-    processor.af.negative = false;
-    return CGBL_SUCCESS;
-}
-
-static cgbl_error_e cgbl_processor_instruction_rra(void) {
-    bool carry = processor.af.carry;
-    processor.delay = 4;
-    processor.af.carry = ((processor.af.high & 1) == 1);
-    processor.af.high = (processor.af.high >> 1) | (carry ? 0x80 : 0);
-    processor.af.half_carry = false;
-    processor.af.negative = false;
-    processor.af.zero = false;
-    return CGBL_SUCCESS;
-}
-
-static cgbl_error_e cgbl_processor_instruction_rrc(void) {
-    cgbl_register_t operand = {};
-    processor.delay = 8;
-    switch (processor.instruction.opcode) {
-    case CGBL_INSTRUCTION_RRC_A:
-        processor.af.carry = ((processor.af.high & 1) == 1);
-        processor.af.high = (processor.af.high >> 1) | (processor.af.carry ? 0x80 : 0);
-        processor.af.zero = !processor.af.high;
-        break;
-    case CGBL_INSTRUCTION_RRC_B:
-        processor.af.carry = ((processor.bc.high & 1) == 1);
-        processor.bc.high = (processor.bc.high >> 1) | (processor.af.carry ? 0x80 : 0);
-        processor.af.zero = !processor.bc.high;
-        break;
-    case CGBL_INSTRUCTION_RRC_C:
-        processor.af.carry = ((processor.bc.low & 1) == 1);
-        processor.bc.low = (processor.bc.low >> 1) | (processor.af.carry ? 0x80 : 0);
-        processor.af.zero = !processor.bc.low;
-        break;
-    case CGBL_INSTRUCTION_RRC_D:
-        processor.af.carry = ((processor.de.high & 1) == 1);
-        processor.de.high = (processor.de.high >> 1) | (processor.af.carry ? 0x80 : 0);
-        processor.af.zero = !processor.de.high;
-        break;
-    case CGBL_INSTRUCTION_RRC_E:
-        processor.af.carry = ((processor.de.low & 1) == 1);
-        processor.de.low = (processor.de.low >> 1) | (processor.af.carry ? 0x80 : 0);
-        processor.af.zero = !processor.de.low;
-        break;
-    case CGBL_INSTRUCTION_RRC_H:
-        processor.af.carry = ((processor.hl.high & 1) == 1);
-        processor.hl.high = (processor.hl.high >> 1) | (processor.af.carry ? 0x80 : 0);
-        processor.af.zero = !processor.hl.high;
-        break;
-    case CGBL_INSTRUCTION_RRC_HLI:
-        processor.delay += 8;
-        operand.low = cgbl_bus_read(processor.hl.word);
-        processor.af.carry = ((operand.low & 1) == 1);
-        operand.low = (operand.low >> 1) | (processor.af.carry ? 0x80 : 0);
-        processor.af.zero = !operand.low;
-        cgbl_bus_write(processor.hl.word, operand.low);
-        break;
-    case CGBL_INSTRUCTION_RRC_L:
-        processor.af.carry = ((processor.hl.low & 1) == 1);
-        processor.hl.low = (processor.hl.low >> 1) | (processor.af.carry ? 0x80 : 0);
-        processor.af.zero = !processor.hl.low;
-        break;
-    default:
-        break;
+    if (!(data = cgbl_bus_page(context, address)) ||
+        (!context->processor.block.entry &&
+         (cgbl_buffer_allocate((uint8_t **)&context->processor.block.entry,
+                               CGBL_PROCESSOR_BLOCK_COUNT * sizeof(*context->processor.block.entry)) != CGBL_SUCCESS))) {
+        return NULL;
     }
-    processor.af.half_carry = false;
-    processor.af.negative = false;
-    return CGBL_SUCCESS;
-}
-
-static cgbl_error_e cgbl_processor_instruction_rrca(void) {
-    processor.delay = 4;
-    processor.af.carry = ((processor.af.high & 1) == 1);
-    processor.af.high = (processor.af.high >> 1) | (processor.af.carry ? 0x80 : 0);
-    processor.af.half_carry = false;
-    processor.af.negative = false;
-    processor.af.zero = false;
-    return CGBL_SUCCESS;
-}
-
-static cgbl_error_e cgbl_processor_instruction_rst(void) {
-    processor.delay = 16;
-    cgbl_bus_write(--processor.sp.word, processor.pc.high);
-    cgbl_bus_write(--processor.sp.word, processor.pc.low);
-    processor.pc.word = processor.instruction.opcode - CGBL_INSTRUCTION_RST_00;
-    return CGBL_SUCCESS;
-}
-
-static cgbl_error_e cgbl_processor_instruction_sbc(void) {
-    uint16_t carry = 0, sum = 0;
-    cgbl_register_t operand = {};
-    processor.delay = 4;
-    switch (processor.instruction.opcode) {
-    case CGBL_INSTRUCTION_SBC_A:
-        operand.low = processor.af.high;
-        break;
-    case CGBL_INSTRUCTION_SBC_B:
-        operand.low = processor.bc.high;
-        break;
-    case CGBL_INSTRUCTION_SBC_C:
-        operand.low = processor.bc.low;
-        break;
-    case CGBL_INSTRUCTION_SBC_D:
-        operand.low = processor.de.high;
-        break;
-    case CGBL_INSTRUCTION_SBC_E:
-        operand.low = processor.de.low;
-        break;
-    case CGBL_INSTRUCTION_SBC_H:
-        operand.low = processor.hl.high;
-        break;
-    case CGBL_INSTRUCTION_SBC_HLI:
-        processor.delay += 4;
-        operand.low = cgbl_bus_read(processor.hl.word);
-        break;
-    case CGBL_INSTRUCTION_SBC_L:
-        operand.low = processor.hl.low;
-        break;
-    case CGBL_INSTRUCTION_SBC_N:
-        processor.delay += 4;
-        operand.low = cgbl_bus_read(processor.pc.word++);
-        break;
-    default:
-        break;
+    block = &context->processor.block.entry[(address ^ (address >> 10) ^ (bank << 5)) & (CGBL_PROCESSOR_BLOCK_COUNT - 1)];
+    if (!block->count || (block->address != address) || (block->bank != bank) || (block->generation != generation)) {
+        cgbl_processor_decode(context, block, data, bank, generation);
     }
-    sum = processor.af.high - operand.low - processor.af.carry;
-    carry = processor.af.high ^ operand.low ^ processor.af.carry ^ sum;
-    processor.af.carry = ((carry & 0x100) == 0x100);
-    processor.af.half_carry = ((carry & 0x10) == 0x10);
-    processor.af.negative = true;
-    processor.af.zero = !(sum & 0xFF);
-    processor.af.high = sum;
-    return CGBL_SUCCESS;
-}
-
-static cgbl_error_e cgbl_processor_instruction_scf(void) {
-    processor.delay = 4;
-    processor.af.carry = true;
-    processor.af.half_carry = false;
-    processor.af.negative = false;
-    return CGBL_SUCCESS;
-}
-
-static cgbl_error_e cgbl_processor_instruction_set(void) {
-    processor.delay = 8;
-    switch (processor.instruction.opcode) {
-    case CGBL_INSTRUCTION_SET_0_A:
-    case CGBL_INSTRUCTION_SET_1_A:
-    case CGBL_INSTRUCTION_SET_2_A:
-    case CGBL_INSTRUCTION_SET_3_A:
-    case CGBL_INSTRUCTION_SET_4_A:
-    case CGBL_INSTRUCTION_SET_5_A:
-    case CGBL_INSTRUCTION_SET_6_A:
-    case CGBL_INSTRUCTION_SET_7_A:
-        processor.af.high |= (1 << ((processor.instruction.opcode - CGBL_INSTRUCTION_SET_0_A) / 8));
-        break;
-    case CGBL_INSTRUCTION_SET_0_B:
-    case CGBL_INSTRUCTION_SET_1_B:
-    case CGBL_INSTRUCTION_SET_2_B:
-    case CGBL_INSTRUCTION_SET_3_B:
-    case CGBL_INSTRUCTION_SET_4_B:
-    case CGBL_INSTRUCTION_SET_5_B:
-    case CGBL_INSTRUCTION_SET_6_B:
-    case CGBL_INSTRUCTION_SET_7_B:
-        processor.bc.high |= (1 << ((processor.instruction.opcode - CGBL_INSTRUCTION_SET_0_B) / 8));
-        break;
-    case CGBL_INSTRUCTION_SET_0_C:
-    case CGBL_INSTRUCTION_SET_1_C:
-    case CGBL_INSTRUCTION_SET_2_C:
-    case CGBL_INSTRUCTION_SET_3_C:
-    case CGBL_INSTRUCTION_SET_4_C:
-    case CGBL_INSTRUCTION_SET_5_C:
-    case CGBL_INSTRUCTION_SET_6_C:
-    case CGBL_INSTRUCTION_SET_7_C:
-        processor.bc.low |= (1 << ((processor.instruction.opcode - CGBL_INSTRUCTION_SET_0_C) / 8));
-        break;
-    case CGBL_INSTRUCTION_SET_0_D:
-    case CGBL_INSTRUCTION_SET_1_D:
-    case CGBL_INSTRUCTION_SET_2_D:
-    case CGBL_INSTRUCTION_SET_3_D:
-    case CGBL_INSTRUCTION_SET_4_D:
-    case CGBL_INSTRUCTION_SET_5_D:
-    case CGBL_INSTRUCTION_SET_6_D:
-    case CGBL_INSTRUCTION_SET_7_D:
-        processor.de.high |= (1 << ((processor.instruction.opcode - CGBL_INSTRUCTION_SET_0_D) / 8));
-        break;
-    case CGBL_INSTRUCTION_SET_0_E:
-    case CGBL_INSTRUCTION_SET_1_E:
-    case CGBL_INSTRUCTION_SET_2_E:
-    case CGBL_INSTRUCTION_SET_3_E:
-    case CGBL_INSTRUCTION_SET_4_E:
-    case CGBL_INSTRUCTION_SET_5_E:
-    case CGBL_INSTRUCTION_SET_6_E:
-    case CGBL_INSTRUCTION_SET_7_E:
-        processor.de.low |= (1 << ((processor.instruction.opcode - CGBL_INSTRUCTION_SET_0_E) / 8));
-        break;
-    case CGBL_INSTRUCTION_SET_0_H:
-    case CGBL_INSTRUCTION_SET_1_H:
-    case CGBL_INSTRUCTION_SET_2_H:
-    case CGBL_INSTRUCTION_SET_3_H:
-    case CGBL_INSTRUCTION_SET_4_H:
-    case CGBL_INSTRUCTION_SET_5_H:
-    case CGBL_INSTRUCTION_SET_6_H:
-    case CGBL_INSTRUCTION_SET_7_H:
-        processor.hl.high |= (1 << ((processor.instruction.opcode - CGBL_INSTRUCTION_SET_0_H) / 8));
-        break;
-    case CGBL_INSTRUCTION_SET_0_HLI:
-    case CGBL_INSTRUCTION_SET_1_HLI:
-    case CGBL_INSTRUCTION_SET_2_HLI:
-    case CGBL_INSTRUCTION_SET_3_HLI:
-    case CGBL_INSTRUCTION_SET_4_HLI:
-    case CGBL_INSTRUCTION_SET_5_HLI:
-    case CGBL_INSTRUCTION_SET_6_HLI:
-    case CGBL_INSTRUCTION_SET_7_HLI:
-        processor.delay += 8;
-        cgbl_bus_write(processor.hl.word,
-                       cgbl_bus_read(processor.hl.word) | (1 << ((processor.instruction.opcode - CGBL_INSTRUCTION_SET_0_HLI) / 8)));
-        break;
-    case CGBL_INSTRUCTION_SET_0_L:
-    case CGBL_INSTRUCTION_SET_1_L:
-    case CGBL_INSTRUCTION_SET_2_L:
-    case CGBL_INSTRUCTION_SET_3_L:
-    case CGBL_INSTRUCTION_SET_4_L:
-    case CGBL_INSTRUCTION_SET_5_L:
-    case CGBL_INSTRUCTION_SET_6_L:
-    case CGBL_INSTRUCTION_SET_7_L:
-        processor.hl.low |= (1 << ((processor.instruction.opcode - CGBL_INSTRUCTION_SET_0_L) / 8));
-        break;
-    default:
-        break;
+    if (!block->count) {
+        context->processor.block.current = NULL;
+        return NULL;
     }
-    return CGBL_SUCCESS;
+    context->processor.block.current = block;
+    context->processor.block.index = 1;
+    return &block->decode[0];
 }
 
-static cgbl_error_e cgbl_processor_instruction_sla(void) {
-    cgbl_register_t operand = {};
-    processor.delay = 8;
-    switch (processor.instruction.opcode) {
-    case CGBL_INSTRUCTION_SLA_A:
-        processor.af.carry = ((processor.af.high & 0x80) == 0x80);
-        processor.af.high <<= 1;
-        processor.af.zero = !processor.af.high;
-        break;
-    case CGBL_INSTRUCTION_SLA_B:
-        processor.af.carry = ((processor.bc.high & 0x80) == 0x80);
-        processor.bc.high <<= 1;
-        processor.af.zero = !processor.bc.high;
-        break;
-    case CGBL_INSTRUCTION_SLA_C:
-        processor.af.carry = ((processor.bc.low & 0x80) == 0x80);
-        processor.bc.low <<= 1;
-        processor.af.zero = !processor.bc.low;
-        break;
-    case CGBL_INSTRUCTION_SLA_D:
-        processor.af.carry = ((processor.de.high & 0x80) == 0x80);
-        processor.de.high <<= 1;
-        processor.af.zero = !processor.de.high;
-        break;
-    case CGBL_INSTRUCTION_SLA_E:
-        processor.af.carry = ((processor.de.low & 0x80) == 0x80);
-        processor.de.low <<= 1;
-        processor.af.zero = !processor.de.low;
-        break;
-    case CGBL_INSTRUCTION_SLA_H:
-        processor.af.carry = ((processor.hl.high & 0x80) == 0x80);
-        processor.hl.high <<= 1;
-        processor.af.zero = !processor.hl.high;
-        break;
-    case CGBL_INSTRUCTION_SLA_HLI:
-        processor.delay += 8;
-        operand.low = cgbl_bus_read(processor.hl.word);
-        processor.af.carry = ((operand.low & 0x80) == 0x80);
-        operand.low <<= 1;
-        processor.af.zero = !operand.low;
-        cgbl_bus_write(processor.hl.word, operand.low);
-        break;
-    case CGBL_INSTRUCTION_SLA_L:
-        processor.af.carry = ((processor.hl.low & 0x80) == 0x80);
-        processor.hl.low <<= 1;
-        processor.af.zero = !processor.hl.low;
-        break;
-    default:
-        break;
+static cgbl_error_e cgbl_processor_execute(cgbl_context_t *const context, bool loop) {
+    const cgbl_decode_t *decode = NULL;
+    cgbl_error_e result = CGBL_SUCCESS, (*handler)(cgbl_context_t *const context) = NULL;
+    if (loop && (context->processor.pc.word == context->processor.loop.address) && cgbl_processor_loop(context)) {
+        return result;
     }
-    processor.af.half_carry = false;
-    processor.af.negative = false;
-    return CGBL_SUCCESS;
-}
-
-static cgbl_error_e cgbl_processor_instruction_sra(void) {
-    cgbl_register_t operand = {};
-    processor.delay = 8;
-    switch (processor.instruction.opcode) {
-    case CGBL_INSTRUCTION_SRA_A:
-        processor.af.carry = ((processor.af.high & 1) == 1);
-        processor.af.high = (processor.af.high >> 1) | (processor.af.high & 0x80);
-        processor.af.zero = !processor.af.high;
-        break;
-    case CGBL_INSTRUCTION_SRA_B:
-        processor.af.carry = ((processor.bc.high & 1) == 1);
-        processor.bc.high = (processor.bc.high >> 1) | (processor.bc.high & 0x80);
-        processor.af.zero = !processor.bc.high;
-        break;
-    case CGBL_INSTRUCTION_SRA_C:
-        processor.af.carry = ((processor.bc.low & 1) == 1);
-        processor.bc.low = (processor.bc.low >> 1) | (processor.bc.low & 0x80);
-        processor.af.zero = !processor.bc.low;
-        break;
-    case CGBL_INSTRUCTION_SRA_D:
-        processor.af.carry = ((processor.de.high & 1) == 1);
-        processor.de.high = (processor.de.high >> 1) | (processor.de.high & 0x80);
-        processor.af.zero = !processor.de.high;
-        break;
-    case CGBL_INSTRUCTION_SRA_E:
-        processor.af.carry = ((processor.de.low & 1) == 1);
-        processor.de.low = (processor.de.low >> 1) | (processor.de.low & 0x80);
-        processor.af.zero = !processor.de.low;
-        break;
-    case CGBL_INSTRUCTION_SRA_H:
-        processor.af.carry = ((processor.hl.high & 1) == 1);
-        processor.hl.high = (processor.hl.high >> 1) | (processor.hl.high & 0x80);
-        processor.af.zero = !processor.hl.high;
-        break;
-    case CGBL_INSTRUCTION_SRA_HLI:
-        processor.delay += 8;
-        operand.low = cgbl_bus_read(processor.hl.word);
-        processor.af.carry = ((operand.low & 1) == 1);
-        operand.low = (operand.low >> 1) | (operand.low & 0x80);
-        processor.af.zero = !operand.low;
-        cgbl_bus_write(processor.hl.word, operand.low);
-        break;
-    case CGBL_INSTRUCTION_SRA_L:
-        processor.af.carry = ((processor.hl.low & 1) == 1);
-        processor.hl.low = (processor.hl.low >> 1) | (processor.hl.low & 0x80);
-        processor.af.zero = !processor.hl.low;
-        break;
-    default:
-        break;
+    context->processor.instruction.address = context->processor.pc.word;
+    context->processor.instruction.index = 0;
+    if (!context->processor.halt_bug && (decode = cgbl_processor_lookup(context))) {
+        context->processor.instruction.opcode = decode->opcode;
+        context->processor.instruction.data[0] = decode->data[1];
+        context->processor.instruction.data[1] = decode->data[2];
+        context->processor.pc.word += decode->length;
+        handler = decode->handler;
+    } else {
+        bool prefix = false;
+        context->processor.instruction.opcode = cgbl_bus_read(context, context->processor.pc.word++);
+        if (context->processor.halt_bug) {
+            context->processor.halt_bug = false;
+            --context->processor.pc.word;
+        }
+        if ((prefix = (context->processor.instruction.opcode == CGBL_INSTRUCTION_PREFIX))) {
+            context->processor.instruction.opcode = cgbl_bus_read(context, context->processor.pc.word++);
+        } else {
+            for (uint8_t index = 0; index < OPERAND[context->processor.instruction.opcode]; ++index) {
+                context->processor.instruction.data[index] = cgbl_bus_read(context, context->processor.pc.word++);
+            }
+        }
+        handler = INSTRUCTION[prefix][context->processor.instruction.opcode];
     }
-    processor.af.half_carry = false;
-    processor.af.negative = false;
-    return CGBL_SUCCESS;
-}
-
-static cgbl_error_e cgbl_processor_instruction_srl(void) {
-    cgbl_register_t operand = {};
-    processor.delay = 8;
-    switch (processor.instruction.opcode) {
-    case CGBL_INSTRUCTION_SRL_A:
-        processor.af.carry = ((processor.af.high & 1) == 1);
-        processor.af.high >>= 1;
-        processor.af.zero = !processor.af.high;
-        break;
-    case CGBL_INSTRUCTION_SRL_B:
-        processor.af.carry = ((processor.bc.high & 1) == 1);
-        processor.bc.high >>= 1;
-        processor.af.zero = !processor.bc.high;
-        break;
-    case CGBL_INSTRUCTION_SRL_C:
-        processor.af.carry = ((processor.bc.low & 1) == 1);
-        processor.bc.low >>= 1;
-        processor.af.zero = !processor.bc.low;
-        break;
-    case CGBL_INSTRUCTION_SRL_D:
-        processor.af.carry = ((processor.de.high & 1) == 1);
-        processor.de.high >>= 1;
-        processor.af.zero = !processor.de.high;
-        break;
-    case CGBL_INSTRUCTION_SRL_E:
-        processor.af.carry = ((processor.de.low & 1) == 1);
-        processor.de.low >>= 1;
-        processor.af.zero = !processor.de.low;
-        break;
-    case CGBL_INSTRUCTION_SRL_H:
-        processor.af.carry = ((processor.hl.high & 1) == 1);
-        processor.hl.high >>= 1;
-        processor.af.zero = !processor.hl.high;
-        break;
-    case CGBL_INSTRUCTION_SRL_HLI:
-        processor.delay += 8;
-        operand.low = cgbl_bus_read(processor.hl.word);
-        processor.af.carry = ((operand.low & 1) == 1);
-        operand.low >>= 1;
-        processor.af.zero = !operand.low;
-        cgbl_bus_write(processor.hl.word, operand.low);
-        break;
-    case CGBL_INSTRUCTION_SRL_L:
-        processor.af.carry = ((processor.hl.low & 1) == 1);
-        processor.hl.low >>= 1;
-        processor.af.zero = !processor.hl.low;
-        break;
-    default:
-        break;
+#ifdef CGBL_PROCESSOR_PROFILE
+    cgbl_processor_profile(context, handler == INSTRUCTION[1][context->processor.instruction.opcode]);
+#endif /* CGBL_PROCESSOR_PROFILE */
+    result = handler(context);
+    if ((context->processor.pc.word < context->processor.instruction.address) &&
+        ((context->processor.instruction.address - context->processor.pc.word) <= CGBL_PROCESSOR_LOOP_WIDTH) &&
+        (context->processor.pc.word != context->processor.loop.address)) {
+        context->processor.loop.address = context->processor.pc.word;
+        context->processor.loop.valid = false;
     }
-    processor.af.half_carry = false;
-    processor.af.negative = false;
-    return CGBL_SUCCESS;
+    return result;
 }
 
-static cgbl_error_e cgbl_processor_instruction_stop(void) {
-    processor.delay = 4;
-    if (!cgbl_bus_speed_change()) {
-        processor.stopped = true;
-        cgbl_bus_write(CGBL_TIMER_DIVIDER, 0);
-    }
-    return CGBL_SUCCESS;
+static bool cgbl_processor_idle(cgbl_context_t *const context) {
+    return !context->processor.interrupt.delay && (context->processor.halted || context->processor.stopped) &&
+           !(context->processor.interrupt.enable.raw & context->processor.interrupt.flag.raw & 0x1F);
 }
 
-static cgbl_error_e cgbl_processor_instruction_sub(void) {
-    uint16_t carry = 0, sum = 0;
-    cgbl_register_t operand = {};
-    processor.delay = 4;
-    switch (processor.instruction.opcode) {
-    case CGBL_INSTRUCTION_SUB_A:
-        operand.low = processor.af.high;
-        break;
-    case CGBL_INSTRUCTION_SUB_B:
-        operand.low = processor.bc.high;
-        break;
-    case CGBL_INSTRUCTION_SUB_C:
-        operand.low = processor.bc.low;
-        break;
-    case CGBL_INSTRUCTION_SUB_D:
-        operand.low = processor.de.high;
-        break;
-    case CGBL_INSTRUCTION_SUB_E:
-        operand.low = processor.de.low;
-        break;
-    case CGBL_INSTRUCTION_SUB_H:
-        operand.low = processor.hl.high;
-        break;
-    case CGBL_INSTRUCTION_SUB_HLI:
-        processor.delay += 4;
-        operand.low = cgbl_bus_read(processor.hl.word);
-        break;
-    case CGBL_INSTRUCTION_SUB_L:
-        operand.low = processor.hl.low;
-        break;
-    case CGBL_INSTRUCTION_SUB_N:
-        processor.delay += 4;
-        operand.low = cgbl_bus_read(processor.pc.word++);
-        break;
-    default:
-        break;
+static void cgbl_processor_schedule(cgbl_context_t *const context) {
+    uint32_t cycles = UINT32_MAX;
+    if (!cgbl_processor_idle(context)) {
+        cycles = context->processor.delay / ((cgbl_bus_speed(context) == CGBL_SPEED_DOUBLE) ? 2 : 1);
     }
-    sum = processor.af.high - operand.low;
-    carry = processor.af.high ^ operand.low ^ sum;
-    processor.af.carry = ((carry & 0x100) == 0x100);
-    processor.af.half_carry = ((carry & 0x10) == 0x10);
-    processor.af.negative = true;
-    processor.af.zero = !(sum & 0xFF);
-    processor.af.high = sum;
-    return CGBL_SUCCESS;
-}
-
-static cgbl_error_e cgbl_processor_instruction_swap(void) {
-    cgbl_register_t operand = {};
-    processor.delay = 8;
-    switch (processor.instruction.opcode) {
-    case CGBL_INSTRUCTION_SWAP_A:
-        processor.af.high = (processor.af.high << 4) | (processor.af.high >> 4);
-        processor.af.zero = !processor.af.high;
-        break;
-    case CGBL_INSTRUCTION_SWAP_B:
-        processor.bc.high = (processor.bc.high << 4) | (processor.bc.high >> 4);
-        processor.af.zero = !processor.bc.high;
-        break;
-    case CGBL_INSTRUCTION_SWAP_C:
-        processor.bc.low = (processor.bc.low << 4) | (processor.bc.low >> 4);
-        processor.af.zero = !processor.bc.low;
-        break;
-    case CGBL_INSTRUCTION_SWAP_D:
-        processor.de.high = (processor.de.high << 4) | (processor.de.high >> 4);
-        processor.af.zero = !processor.de.high;
-        break;
-    case CGBL_INSTRUCTION_SWAP_E:
-        processor.de.low = (processor.de.low << 4) | (processor.de.low >> 4);
-        processor.af.zero = !processor.de.low;
-        break;
-    case CGBL_INSTRUCTION_SWAP_H:
-        processor.hl.high = (processor.hl.high << 4) | (processor.hl.high >> 4);
-        processor.af.zero = !processor.hl.high;
-        break;
-    case CGBL_INSTRUCTION_SWAP_HLI:
-        processor.delay += 8;
-        operand.low = cgbl_bus_read(processor.hl.word);
-        operand.low = (operand.low << 4) | (operand.low >> 4);
-        cgbl_bus_write(processor.hl.word, operand.low);
-        processor.af.zero = !operand.low;
-        break;
-    case CGBL_INSTRUCTION_SWAP_L:
-        processor.hl.low = (processor.hl.low << 4) | (processor.hl.low >> 4);
-        processor.af.zero = !processor.hl.low;
-        break;
-    default:
-        break;
-    }
-    processor.af.carry = false;
-    processor.af.half_carry = false;
-    processor.af.negative = false;
-    return CGBL_SUCCESS;
+    cgbl_bus_schedule(context, CGBL_EVENT_PROCESSOR, cycles);
 }
 
-static cgbl_error_e cgbl_processor_instruction_xor(void) {
-    processor.delay = 4;
-    switch (processor.instruction.opcode) {
-    case CGBL_INSTRUCTION_XOR_A:
-        processor.af.high = 0;
-        break;
-    case CGBL_INSTRUCTION_XOR_B:
-        processor.af.high ^= processor.bc.high;
-        break;
-    case CGBL_INSTRUCTION_XOR_C:
-        processor.af.high ^= processor.bc.low;
-        break;
-    case CGBL_INSTRUCTION_XOR_D:
-        processor.af.high ^= processor.de.high;
-        break;
-    case CGBL_INSTRUCTION_XOR_E:
-        processor.af.high ^= processor.de.low;
-        break;
-    case CGBL_INSTRUCTION_XOR_H:
-        processor.af.high ^= processor.hl.high;
-        break;
-    case CGBL_INSTRUCTION_XOR_HLI:
-        processor.delay += 4;
-        processor.af.high ^= cgbl_bus_read(processor.hl.word);
-        break;
-    case CGBL_INSTRUCTION_XOR_L:
-        processor.af.high ^= processor.hl.low;
-        break;
-    case CGBL_INSTRUCTION_XOR_N:
-        processor.delay += 4;
-        processor.af.high ^= cgbl_bus_read(processor.pc.word++);
-        break;
-    default:
-        break;
-    }
-    processor.af.carry = false;
-    processor.af.half_carry = false;
-    processor.af.negative = false;
-    processor.af.zero = !processor.af.high;
-    return CGBL_SUCCESS;
-}
-
-static cgbl_error_e cgbl_processor_instruction_xxx(void) {
-    processor.delay = 4;
-    return CGBL_ERROR("Illegal instruction: [%04X] %02X", processor.instruction.address, processor.instruction.opcode);
-}
-
-static cgbl_error_e (*const INSTRUCTION[][CGBL_INSTRUCTION_MAX])(void) = {
-    { cgbl_processor_instruction_nop,    cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,
-      cgbl_processor_instruction_inc_16, cgbl_processor_instruction_inc,    cgbl_processor_instruction_dec,
-      cgbl_processor_instruction_ld,     cgbl_processor_instruction_rlca,   cgbl_processor_instruction_ld,
-      cgbl_processor_instruction_add_hl, cgbl_processor_instruction_ld,     cgbl_processor_instruction_dec_16,
-      cgbl_processor_instruction_inc,    cgbl_processor_instruction_dec,    cgbl_processor_instruction_ld,
-      cgbl_processor_instruction_rrca,   cgbl_processor_instruction_stop,   cgbl_processor_instruction_ld,
-      cgbl_processor_instruction_ld,     cgbl_processor_instruction_inc_16, cgbl_processor_instruction_inc,
-      cgbl_processor_instruction_dec,    cgbl_processor_instruction_ld,     cgbl_processor_instruction_rla,
-      cgbl_processor_instruction_jr,     cgbl_processor_instruction_add_hl, cgbl_processor_instruction_ld,
-      cgbl_processor_instruction_dec_16, cgbl_processor_instruction_inc,    cgbl_processor_instruction_dec,
-      cgbl_processor_instruction_ld,     cgbl_processor_instruction_rra,    cgbl_processor_instruction_jr,
-      cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,     cgbl_processor_instruction_inc_16,
-      cgbl_processor_instruction_inc,    cgbl_processor_instruction_dec,    cgbl_processor_instruction_ld,
-      cgbl_processor_instruction_daa,    cgbl_processor_instruction_jr,     cgbl_processor_instruction_add_hl,
-      cgbl_processor_instruction_ld,     cgbl_processor_instruction_dec_16, cgbl_processor_instruction_inc,
-      cgbl_processor_instruction_dec,    cgbl_processor_instruction_ld,     cgbl_processor_instruction_cpl,
-      cgbl_processor_instruction_jr,     cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,
-      cgbl_processor_instruction_inc_16, cgbl_processor_instruction_inc,    cgbl_processor_instruction_dec,
-      cgbl_processor_instruction_ld,     cgbl_processor_instruction_scf,    cgbl_processor_instruction_jr,
-      cgbl_processor_instruction_add_hl, cgbl_processor_instruction_ld,     cgbl_processor_instruction_dec_16,
-      cgbl_processor_instruction_inc,    cgbl_processor_instruction_dec,    cgbl_processor_instruction_ld,
-      cgbl_processor_instruction_ccf,    cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,
-      cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,
-      cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,
-      cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,
-      cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,
-      cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,
-      cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,
-      cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,
-      cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,
-      cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,
-      cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,
-      cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,
-      cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,
-      cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,
-      cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,
-      cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,
-      cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,
-      cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,
-      cgbl_processor_instruction_ld,     cgbl_processor_instruction_halt,   cgbl_processor_instruction_ld,
-      cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,
-      cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,
-      cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,     cgbl_processor_instruction_add,
-      cgbl_processor_instruction_add,    cgbl_processor_instruction_add,    cgbl_processor_instruction_add,
-      cgbl_processor_instruction_add,    cgbl_processor_instruction_add,    cgbl_processor_instruction_add,
-      cgbl_processor_instruction_add,    cgbl_processor_instruction_adc,    cgbl_processor_instruction_adc,
-      cgbl_processor_instruction_adc,    cgbl_processor_instruction_adc,    cgbl_processor_instruction_adc,
-      cgbl_processor_instruction_adc,    cgbl_processor_instruction_adc,    cgbl_processor_instruction_adc,
-      cgbl_processor_instruction_sub,    cgbl_processor_instruction_sub,    cgbl_processor_instruction_sub,
-      cgbl_processor_instruction_sub,    cgbl_processor_instruction_sub,    cgbl_processor_instruction_sub,
-      cgbl_processor_instruction_sub,    cgbl_processor_instruction_sub,    cgbl_processor_instruction_sbc,
-      cgbl_processor_instruction_sbc,    cgbl_processor_instruction_sbc,    cgbl_processor_instruction_sbc,
-      cgbl_processor_instruction_sbc,    cgbl_processor_instruction_sbc,    cgbl_processor_instruction_sbc,
-      cgbl_processor_instruction_sbc,    cgbl_processor_instruction_and,    cgbl_processor_instruction_and,
-      cgbl_processor_instruction_and,    cgbl_processor_instruction_and,    cgbl_processor_instruction_and,
-      cgbl_processor_instruction_and,    cgbl_processor_instruction_and,    cgbl_processor_instruction_and,
-      cgbl_processor_instruction_xor,    cgbl_processor_instruction_xor,    cgbl_processor_instruction_xor,
-      cgbl_processor_instruction_xor,    cgbl_processor_instruction_xor,    cgbl_processor_instruction_xor,
-      cgbl_processor_instruction_xor,    cgbl_processor_instruction_xor,    cgbl_processor_instruction_or,
-      cgbl_processor_instruction_or,     cgbl_processor_instruction_or,     cgbl_processor_instruction_or,
-      cgbl_processor_instruction_or,     cgbl_processor_instruction_or,     cgbl_processor_instruction_or,
-      cgbl_processor_instruction_or,     cgbl_processor_instruction_cp,     cgbl_processor_instruction_cp,
-      cgbl_processor_instruction_cp,     cgbl_processor_instruction_cp,     cgbl_processor_instruction_cp,
-      cgbl_processor_instruction_cp,     cgbl_processor_instruction_cp,     cgbl_processor_instruction_cp,
-      cgbl_processor_instruction_ret,    cgbl_processor_instruction_pop,    cgbl_processor_instruction_jp,
-      cgbl_processor_instruction_jp,     cgbl_processor_instruction_call,   cgbl_processor_instruction_push,
-      cgbl_processor_instruction_add,    cgbl_processor_instruction_rst,    cgbl_processor_instruction_ret,
-      cgbl_processor_instruction_ret,    cgbl_processor_instruction_jp,     cgbl_processor_instruction_xxx,
-      cgbl_processor_instruction_call,   cgbl_processor_instruction_call,   cgbl_processor_instruction_adc,
-      cgbl_processor_instruction_rst,    cgbl_processor_instruction_ret,    cgbl_processor_instruction_pop,
-      cgbl_processor_instruction_jp,     cgbl_processor_instruction_xxx,    cgbl_processor_instruction_call,
-      cgbl_processor_instruction_push,   cgbl_processor_instruction_sub,    cgbl_processor_instruction_rst,
-      cgbl_processor_instruction_ret,    cgbl_processor_instruction_reti,   cgbl_processor_instruction_jp,
-      cgbl_processor_instruction_xxx,    cgbl_processor_instruction_call,   cgbl_processor_instruction_xxx,
-      cgbl_processor_instruction_sbc,    cgbl_processor_instruction_rst,    cgbl_processor_instruction_ld,
-      cgbl_processor_instruction_pop,    cgbl_processor_instruction_ld,     cgbl_processor_instruction_xxx,
-      cgbl_processor_instruction_xxx,    cgbl_processor_instruction_push,   cgbl_processor_instruction_and,
-      cgbl_processor_instruction_rst,    cgbl_processor_instruction_add_sp, cgbl_processor_instruction_jp_hl,
-      cgbl_processor_instruction_ld,     cgbl_processor_instruction_xxx,    cgbl_processor_instruction_xxx,
-      cgbl_processor_instruction_xxx,    cgbl_processor_instruction_xor,    cgbl_processor_instruction_rst,
-      cgbl_processor_instruction_ld,     cgbl_processor_instruction_pop,    cgbl_processor_instruction_ld,
-      cgbl_processor_instruction_di,     cgbl_processor_instruction_xxx,    cgbl_processor_instruction_push,
-      cgbl_processor_instruction_or,     cgbl_processor_instruction_rst,    cgbl_processor_instruction_ld_hl,
-      cgbl_processor_instruction_ld,     cgbl_processor_instruction_ld,     cgbl_processor_instruction_ei,
-      cgbl_processor_instruction_xxx,    cgbl_processor_instruction_xxx,    cgbl_processor_instruction_cp,
-      cgbl_processor_instruction_rst },
-    { cgbl_processor_instruction_rlc,  cgbl_processor_instruction_rlc,  cgbl_processor_instruction_rlc,  cgbl_processor_instruction_rlc,
-      cgbl_processor_instruction_rlc,  cgbl_processor_instruction_rlc,  cgbl_processor_instruction_rlc,  cgbl_processor_instruction_rlc,
-      cgbl_processor_instruction_rrc,  cgbl_processor_instruction_rrc,  cgbl_processor_instruction_rrc,  cgbl_processor_instruction_rrc,
-      cgbl_processor_instruction_rrc,  cgbl_processor_instruction_rrc,  cgbl_processor_instruction_rrc,  cgbl_processor_instruction_rrc,
-      cgbl_processor_instruction_rl,   cgbl_processor_instruction_rl,   cgbl_processor_instruction_rl,   cgbl_processor_instruction_rl,
-      cgbl_processor_instruction_rl,   cgbl_processor_instruction_rl,   cgbl_processor_instruction_rl,   cgbl_processor_instruction_rl,
-      cgbl_processor_instruction_rr,   cgbl_processor_instruction_rr,   cgbl_processor_instruction_rr,   cgbl_processor_instruction_rr,
-      cgbl_processor_instruction_rr,   cgbl_processor_instruction_rr,   cgbl_processor_instruction_rr,   cgbl_processor_instruction_rr,
-      cgbl_processor_instruction_sla,  cgbl_processor_instruction_sla,  cgbl_processor_instruction_sla,  cgbl_processor_instruction_sla,
-      cgbl_processor_instruction_sla,  cgbl_processor_instruction_sla,  cgbl_processor_instruction_sla,  cgbl_processor_instruction_sla,
-      cgbl_processor_instruction_sra,  cgbl_processor_instruction_sra,  cgbl_processor_instruction_sra,  cgbl_processor_instruction_sra,
-      cgbl_processor_instruction_sra,  cgbl_processor_instruction_sra,  cgbl_processor_instruction_sra,  cgbl_processor_instruction_sra,
-      cgbl_processor_instruction_swap, cgbl_processor_instruction_swap, cgbl_processor_instruction_swap, cgbl_processor_instruction_swap,
-      cgbl_processor_instruction_swap, cgbl_processor_instruction_swap, cgbl_processor_instruction_swap, cgbl_processor_instruction_swap,
-      cgbl_processor_instruction_srl,  cgbl_processor_instruction_srl,  cgbl_processor_instruction_srl,  cgbl_processor_instruction_srl,
-      cgbl_processor_instruction_srl,  cgbl_processor_instruction_srl,  cgbl_processor_instruction_srl,  cgbl_processor_instruction_srl,
-      cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,
-      cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,
-      cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,
-      cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,
-      cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,
-      cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,
-      cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,
-      cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,
-      cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,
-      cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,
-      cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,
-      cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,
-      cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,
-      cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,
-      cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,
-      cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,  cgbl_processor_instruction_bit,
-      cgbl_processor_instruction_res,  cgbl_processor_instruction_res,  cgbl_processor_instruction_res,  cgbl_processor_instruction_res,
-      cgbl_processor_instruction_res,  cgbl_processor_instruction_res,  cgbl_processor_instruction_res,  cgbl_processor_instruction_res,
-      cgbl_processor_instruction_res,  cgbl_processor_instruction_res,  cgbl_processor_instruction_res,  cgbl_processor_instruction_res,
-      cgbl_processor_instruction_res,  cgbl_processor_instruction_res,  cgbl_processor_instruction_res,  cgbl_processor_instruction_res,
-      cgbl_processor_instruction_res,  cgbl_processor_instruction_res,  cgbl_processor_instruction_res,  cgbl_processor_instruction_res,
-      cgbl_processor_instruction_res,  cgbl_processor_instruction_res,  cgbl_processor_instruction_res,  cgbl_processor_instruction_res,
-      cgbl_processor_instruction_res,  cgbl_processor_instruction_res,  cgbl_processor_instruction_res,  cgbl_processor_instruction_res,
-      cgbl_processor_instruction_res,  cgbl_processor_instruction_res,  cgbl_processor_instruction_res,  cgbl_processor_instruction_res,
-      cgbl_processor_instruction_res,  cgbl_processor_instruction_res,  cgbl_processor_instruction_res,  cgbl_processor_instruction_res,
-      cgbl_processor_instruction_res,  cgbl_processor_instruction_res,  cgbl_processor_instruction_res,  cgbl_processor_instruction_res,
-      cgbl_processor_instruction_res,  cgbl_processor_instruction_res,  cgbl_processor_instruction_res,  cgbl_processor_instruction_res,
-      cgbl_processor_instruction_res,  cgbl_processor_instruction_res,  cgbl_processor_instruction_res,  cgbl_processor_instruction_res,
-      cgbl_processor_instruction_res,  cgbl_processor_instruction_res,  cgbl_processor_instruction_res,  cgbl_processor_instruction_res,
-      cgbl_processor_instruction_res,  cgbl_processor_instruction_res,  cgbl_processor_instruction_res,  cgbl_processor_instruction_res,
-      cgbl_processor_instruction_res,  cgbl_processor_instruction_res,  cgbl_processor_instruction_res,  cgbl_processor_instruction_res,
-      cgbl_processor_instruction_res,  cgbl_processor_instruction_res,  cgbl_processor_instruction_res,  cgbl_processor_instruction_res,
-      cgbl_processor_instruction_set,  cgbl_processor_instruction_set,  cgbl_processor_instruction_set,  cgbl_processor_instruction_set,
-      cgbl_processor_instruction_set,  cgbl_processor_instruction_set,  cgbl_processor_instruction_set,  cgbl_processor_instruction_set,
-      cgbl_processor_instruction_set,  cgbl_processor_instruction_set,  cgbl_processor_instruction_set,  cgbl_processor_instruction_set,
-      cgbl_processor_instruction_set,  cgbl_processor_instruction_set,  cgbl_processor_instruction_set,  cgbl_processor_instruction_set,
-      cgbl_processor_instruction_set,  cgbl_processor_instruction_set,  cgbl_processor_instruction_set,  cgbl_processor_instruction_set,
-      cgbl_processor_instruction_set,  cgbl_processor_instruction_set,  cgbl_processor_instruction_set,  cgbl_processor_instruction_set,
-      cgbl_processor_instruction_set,  cgbl_processor_instruction_set,  cgbl_processor_instruction_set,  cgbl_processor_instruction_set,
-      cgbl_processor_instruction_set,  cgbl_processor_instruction_set,  cgbl_processor_instruction_set,  cgbl_processor_instruction_set,
-      cgbl_processor_instruction_set,  cgbl_processor_instruction_set,  cgbl_processor_instruction_set,  cgbl_processor_instruction_set,
-      cgbl_processor_instruction_set,  cgbl_processor_instruction_set,  cgbl_processor_instruction_set,  cgbl_processor_instruction_set,
-      cgbl_processor_instruction_set,  cgbl_processor_instruction_set,  cgbl_processor_instruction_set,  cgbl_processor_instruction_set,
-      cgbl_processor_instruction_set,  cgbl_processor_instruction_set,  cgbl_processor_instruction_set,  cgbl_processor_instruction_set,
-      cgbl_processor_instruction_set,  cgbl_processor_instruction_set,  cgbl_processor_instruction_set,  cgbl_processor_instruction_set,
-      cgbl_processor_instruction_set,  cgbl_processor_instruction_set,  cgbl_processor_instruction_set,  cgbl_processor_instruction_set,
-      cgbl_processor_instruction_set,  cgbl_processor_instruction_set,  cgbl_processor_instruction_set,  cgbl_processor_instruction_set,
-      cgbl_processor_instruction_set,  cgbl_processor_instruction_set,  cgbl_processor_instruction_set,  cgbl_processor_instruction_set }
-};
-
-static cgbl_error_e cgbl_processor_execute(void) {
-    bool prefix = false;
-    processor.instruction.address = processor.pc.word;
-    processor.instruction.opcode = cgbl_bus_read(processor.pc.word++);
-    if (processor.halt_bug) {
-        processor.halt_bug = false;
-        --processor.pc.word;
-    }
-    if ((prefix = (processor.instruction.opcode == CGBL_INSTRUCTION_PREFIX))) {
-        processor.instruction.opcode = cgbl_bus_read(processor.pc.word++);
+static void cgbl_processor_service(cgbl_context_t *const context) {
+    for (cgbl_interrupt_e interrupt = 0; interrupt < CGBL_INTERRUPT_MAX; ++interrupt) {
+        uint8_t mask = 1 << interrupt;
+        if (context->processor.interrupt.enable.raw & context->processor.interrupt.flag.raw & mask) {
+            context->processor.delay = 4;
+            context->processor.interrupt.flag.raw &= ~mask;
+            if (context->processor.halt_bug) {
+                context->processor.halt_bug = false;
+            } else {
+                context->processor.delay += 16;
+                context->processor.interrupt.delay = 0;
+                context->processor.interrupt.enabled = false;
+                cgbl_processor_push(context, context->processor.pc.word);
+                context->processor.pc.word = (8 * interrupt) + 0x40;
+            }
+            break;
+        }
     }
-    return INSTRUCTION[prefix][processor.instruction.opcode]();
 }
 
-static void cgbl_processor_service(void) {
-    for (cgbl_interrupt_e interrupt = 0; interrupt < CGBL_INTERRUPT_MAX; ++interrupt) {
-        uint8_t mask = 1 << interrupt;
-        if (processor.interrupt.enable.raw & processor.interrupt.flag.raw & mask) {
-            processor.delay = 4;
-            processor.interrupt.flag.raw &= ~mask;
-            if (processor.halt_bug) {
-                processor.halt_bug = false;
+static cgbl_error_e cgbl_processor_run(cgbl_context_t *const context, uint32_t cycles, bool loop) {
+    cgbl_error_e result = CGBL_SUCCESS;
+    while (cycles) {
+        uint8_t speed = (cgbl_bus_speed(context) == CGBL_SPEED_DOUBLE) ? 2 : 1;
+        uint32_t idle = context->processor.delay / speed;
+        if (cgbl_processor_idle(context)) {
+            uint64_t count = (uint64_t)cycles * speed;
+            if (count > context->processor.delay) {
+                context->processor.delay = 3 - ((count - context->processor.delay - 1) % 4);
             } else {
-                processor.delay += 16;
-                processor.interrupt.delay = 0;
-                processor.interrupt.enabled = false;
-                cgbl_bus_write(--processor.sp.word, processor.pc.high);
-                cgbl_bus_write(--processor.sp.word, processor.pc.low);
-                processor.pc.word = (8 * interrupt) + 0x40;
+                context->processor.delay -= count;
             }
             break;
         }
+        if (idle >= cycles) {
+            context->processor.delay -= cycles * speed;
+            break;
+        }
+        context->processor.delay -= idle * speed;
+        cycles -= idle + 1;
+        for (uint8_t cycle = 0; cycle < ((cgbl_bus_speed(context) == CGBL_SPEED_DOUBLE) ? 2 : 1); ++cycle) {
+            if (!context->processor.delay) {
+                if (context->processor.interrupt.delay && !--context->processor.interrupt.delay) {
+                    context->processor.interrupt.enabled = true;
+                }
+                if (context->processor.interrupt.enable.raw & context->processor.interrupt.flag.raw & 0x1F) {
+                    context->processor.halted = false;
+                    if (context->processor.interrupt.enabled) {
+                        cgbl_processor_service(context);
+                    } else if (!context->processor.stopped) {
+                        if ((result = cgbl_processor_execute(context, loop)) != CGBL_SUCCESS) {
+                            return result;
+                        }
+                    } else {
+                        context->processor.delay = 4;
+                    }
+                } else if (!context->processor.halted && !context->processor.stopped) {
+                    if ((result = cgbl_processor_execute(context, loop)) != CGBL_SUCCESS) {
+                        return result;
+                    }
+                } else {
+                    context->processor.delay = 4;
+                }
+            }
+            --context->processor.delay;
+        }
+    }
+    cgbl_processor_schedule(context);
+    return result;
+}
+
+bool cgbl_processor_breakpoint(cgbl_context_t *const context, uint16_t breakpoint) {
+    return context->processor.pc.word == breakpoint;
+}
+
+void cgbl_processor_destroy(cgbl_context_t *const context) {
+#ifdef CGBL_PROCESSOR_PROFILE
+    cgbl_processor_profile_dump();
+#endif /* CGBL_PROCESSOR_PROFILE */
+    if (context->processor.block.entry) {
+        cgbl_buffer_free((uint8_t *)context->processor.block.entry);
+        context->processor.block.entry = NULL;
     }
 }
 
-bool cgbl_processor_halted(void) {
-    return processor.halted;
+bool cgbl_processor_halted(cgbl_context_t *const context) {
+    return context->processor.halted;
 }
 
-void cgbl_processor_interrupt(cgbl_interrupt_e interrupt) {
-    cgbl_processor_write(CGBL_PROCESSOR_INTERRUPT_FLAG, cgbl_processor_read(CGBL_PROCESSOR_INTERRUPT_FLAG) | (1 << interrupt));
+void cgbl_processor_interrupt(cgbl_context_t *const context, cgbl_interrupt_e interrupt) {
+    cgbl_processor_write(context, CGBL_PROCESSOR_INTERRUPT_FLAG,
+                         cgbl_processor_read(context, CGBL_PROCESSOR_INTERRUPT_FLAG) | (1 << interrupt));
 }
 
-cgbl_error_e cgbl_processor_register_read(cgbl_register_e reg, cgbl_register_t *const data) {
+cgbl_error_e cgbl_processor_register_read(cgbl_context_t *const context, cgbl_register_e reg, cgbl_register_t *const data) {
     cgbl_error_e result = CGBL_SUCCESS;
     switch (reg) {
     case CGBL_REGISTER_A:
-        data->low = processor.af.high;
+        data->low = context->processor.af.high;
         break;
     case CGBL_REGISTER_AF:
-        data->word = processor.af.word;
+        cgbl_processor_flag_store(context);
+        data->word = context->processor.af.word;
         break;
     case CGBL_REGISTER_B:
-        data->low = processor.bc.high;
+        data->low = context->processor.bc.high;
         break;
     case CGBL_REGISTER_BC:
-        data->word = processor.bc.word;
+        data->word = context->processor.bc.word;
         break;
     case CGBL_REGISTER_C:
-        data->low = processor.bc.low;
+        data->low = context->processor.bc.low;
         break;
     case CGBL_REGISTER_D:
-        data->low = processor.de.high;
+        data->low = context->processor.de.high;
         break;
     case CGBL_REGISTER_DE:
-        data->word = processor.de.word;
+        data->word = context->processor.de.word;
         break;
     case CGBL_REGISTER_E:
-        data->low = processor.de.low;
+        data->low = context->processor.de.low;
         break;
     case CGBL_REGISTER_F:
-        data->low = processor.af.low;
+        cgbl_processor_flag_store(context);
+        data->low = context->processor.af.low;
         break;
     case CGBL_REGISTER_H:
-        data->low = processor.hl.high;
+        data->low = context->processor.hl.high;
         break;
     case CGBL_REGISTER_HL:
-        data->word = processor.hl.word;
+        data->word = context->processor.hl.word;
         break;
     case CGBL_REGISTER_L:
-        data->low = processor.hl.low;
+        data->low = context->processor.hl.low;
         break;
     case CGBL_REGISTER_PC:
-        data->word = processor.pc.word;
+        data->word = context->processor.pc.word;
         break;
     case CGBL_REGISTER_SP:
-        data->word = processor.sp.word;
+        data->word = context->processor.sp.word;
         break;
     default:
         result = CGBL_ERROR("Invalid register: %u", reg);
@@ -2181,50 +915,52 @@ cgbl_error_e cgbl_processor_register_read(cgbl_register_e reg, cgbl_register_t *
     return result;
 }
 
-cgbl_error_e cgbl_processor_register_write(cgbl_register_e reg, const cgbl_register_t *const data) {
+cgbl_error_e cgbl_processor_register_write(cgbl_context_t *const context, cgbl_register_e reg, const cgbl_register_t *const data) {
     cgbl_error_e result = CGBL_SUCCESS;
     switch (reg) {
     case CGBL_REGISTER_A:
-        processor.af.high = data->low;
+        context->processor.af.high = data->low;
         break;
     case CGBL_REGISTER_AF:
-        processor.af.word = data->word & 0xF0;
+        context->processor.af.word = data->word & 0xF0;
+        cgbl_processor_flag_load(context);
         break;
     case CGBL_REGISTER_B:
-        processor.bc.high = data->low;
+        context->processor.bc.high = data->low;
         break;
     case CGBL_REGISTER_BC:
-        processor.bc.word = data->word;
+        context->processor.bc.word = data->word;
         break;
     case CGBL_REGISTER_C:
-        processor.bc.low = data->low;
+        context->processor.bc.low = data->low;
         break;
     case CGBL_REGISTER_D:
-        processor.de.high = data->low;
+        context->processor.de.high = data->low;
         break;
     case CGBL_REGISTER_DE:
-        processor.de.word = data->word;
+        context->processor.de.word = data->word;
         break;
     case CGBL_REGISTER_E:
-        processor.de.low = data->low;
+        context->processor.de.low = data->low;
         break;
     case CGBL_REGISTER_F:
-        processor.af.low = data->low & 0xF0;
+        context->processor.af.low = data->low & 0xF0;
+        cgbl_processor_flag_load(context);
         break;
     case CGBL_REGISTER_H:
-        processor.hl.high = data->low;
+        context->processor.hl.high = data->low;
         break;
     case CGBL_REGISTER_HL:
-        processor.hl.word = data->word;
+        context->processor.hl.word = data->word;
         break;
     case CGBL_REGISTER_L:
-        processor.hl.low = data->low;
+        context->processor.hl.low = data->low;
         break;
     case CGBL_REGISTER_PC:
-        processor.pc.word = data->word;
+        context->processor.pc.word = data->word;
         break;
     case CGBL_REGISTER_SP:
-        processor.sp.word = data->word;
+        context->processor.sp.word = data->word;
         break;
     default:
         result = CGBL_ERROR("Invalid register: %u", reg);
@@ -2233,14 +969,14 @@ cgbl_error_e cgbl_processor_register_write(cgbl_register_e reg, const cgbl_regis
     return result;
 }
 
-uint8_t cgbl_processor_read(uint16_t address) {
+uint8_t cgbl_processor_read(cgbl_context_t *const context, uint16_t address) {
     uint8_t result = 0xFF;
     switch (address) {
     case CGBL_PROCESSOR_INTERRUPT_ENABLE:
-        result = processor.interrupt.enable.raw;
+        result = context->processor.interrupt.enable.raw;
         break;
     case CGBL_PROCESSOR_INTERRUPT_FLAG:
-        result = processor.interrupt.flag.raw;
+        result = context->processor.interrupt.flag.raw;
         break;
     default:
         break;
@@ -2248,67 +984,53 @@ uint8_t cgbl_processor_read(uint16_t address) {
     return result;
 }
 
-void cgbl_processor_reset(void) {
-    memset(&processor, 0, sizeof(processor));
-    processor.interrupt.flag.raw = 0xE0;
+void cgbl_processor_reset(cgbl_context_t *const context) {
+    cgbl_block_t *entry = context->processor.block.entry;
+    memset(&context->processor, 0, sizeof(context->processor));
+    if ((context->processor.block.entry = entry)) {
+        memset(entry, 0, CGBL_PROCESSOR_BLOCK_COUNT * sizeof(*entry));
+    }
+#ifdef CGBL_PROCESSOR_PROFILE
+    context->processor.fuse = false;
+#else
+    context->processor.fuse = !context->option.debug;
+#endif /* CGBL_PROCESSOR_PROFILE */
+    cgbl_processor_flag_load(context);
+    context->processor.interrupt.flag.raw = 0xE0;
 }
 
-cgbl_error_e cgbl_processor_step(void) {
-    cgbl_error_e result = CGBL_SUCCESS;
-    for (uint8_t cycle = 0; cycle < ((cgbl_bus_speed() == CGBL_SPEED_DOUBLE) ? 2 : 1); ++cycle) {
-        if (!processor.delay) {
-            if (processor.interrupt.delay && !--processor.interrupt.delay) {
-                processor.interrupt.enabled = true;
-            }
-            if (processor.interrupt.enable.raw & processor.interrupt.flag.raw & 0x1F) {
-                processor.halted = false;
-                if (processor.interrupt.enabled) {
-                    cgbl_processor_service();
-                } else if (!processor.stopped) {
-                    if ((result = cgbl_processor_execute()) != CGBL_SUCCESS) {
-                        return result;
-                    }
-                } else {
-                    processor.delay = 4;
-                }
-            } else if (!processor.halted && !processor.stopped) {
-                if ((result = cgbl_processor_execute()) != CGBL_SUCCESS) {
-                    return result;
-                }
-            } else {
-                processor.delay = 4;
-            }
-        }
-        --processor.delay;
-    }
-    return result;
+cgbl_error_e cgbl_processor_step(cgbl_context_t *const context, uint32_t cycles) {
+    return cgbl_processor_run(context, cycles, true);
 }
 
-cgbl_error_e cgbl_processor_step_breakpoint(uint16_t breakpoint) {
+cgbl_error_e cgbl_processor_step_breakpoint(cgbl_context_t *const context, uint16_t breakpoint) {
     cgbl_error_e result = CGBL_SUCCESS;
-    if (processor.pc.word == breakpoint) {
+    if (cgbl_processor_breakpoint(context, breakpoint)) {
         return CGBL_BREAKPOINT;
     }
-    if (((result = cgbl_processor_step()) == CGBL_SUCCESS) && !processor.delay) {
+    if (((result = cgbl_processor_run(context, 1, false)) == CGBL_SUCCESS) && !context->processor.delay) {
         result = CGBL_COMPLETE;
     }
     return result;
 }
 
-bool cgbl_processor_stopped(void) {
-    return processor.stopped;
+bool cgbl_processor_stopped(cgbl_context_t *const context) {
+    return context->processor.stopped;
 }
 
-void cgbl_processor_write(uint16_t address, uint8_t data) {
+void cgbl_processor_write(cgbl_context_t *const context, uint16_t address, uint8_t data) {
     switch (address) {
     case CGBL_PROCESSOR_INTERRUPT_ENABLE:
-        processor.interrupt.enable.raw = data;
+        context->processor.interrupt.enable.raw = data;
         break;
     case CGBL_PROCESSOR_INTERRUPT_FLAG:
-        processor.interrupt.flag.raw = data | 0xE0;
-        if (processor.interrupt.flag.input) {
-            processor.stopped = false;
+        context->processor.interrupt.flag.raw = data | 0xE0;
+        if (context->processor.interrupt.flag.input && context->processor.stopped) {
+            cgbl_bus_sync(context, CGBL_EVENT_TIMER);
+            context->processor.stopped = false;
+            cgbl_bus_sync(context, CGBL_EVENT_TIMER);
         }
+        cgbl_processor_schedule(context);
         break;
     default:
         break;
@@ -8,486 +8,547 @@
 
 #include "bus.h"
 
+#define CGBL_PROCESSOR_BLOCK_COUNT 1024
+#define CGBL_PROCESSOR_BLOCK_LENGTH 16
+#define CGBL_PROCESSOR_FUSION_LENGTH 4
 #define CGBL_PROCESSOR_INTERRUPT_ENABLE 0xFFFF
 #define CGBL_PROCESSOR_INTERRUPT_FLAG 0xFF0F
+#define CGBL_PROCESSOR_LOOP_WIDTH 16
+#define CGBL_PROCESSOR_PROFILE_COUNT (1 << 20)
+
+/*
+ * Generated from the opcode-sequence profile in docs/fusion.txt, which also describes how to regenerate it.
+ * Each row is the fused handler index, its mnemonic and the opcodes it matches in order.
+ */
+#define CGBL_PROCESSOR_FUSION(_FUSION_)                                                                                                    \
+    _FUSION_(0, "ld a,(hl+); ld (c),a; dec b; jr nz", 0x2A, 0xE2, 0x05, 0x20)                                                              \
+    _FUSION_(1, "rlca; rlca; rlca; and n", 0x07, 0x07, 0x07, 0xE6)                                                                         \
+    _FUSION_(2, "ld a,(hl); and n; or c; ld (hl+),a", 0x7E, 0xE6, 0xB1, 0x22)                                                              \
+    _FUSION_(3, "cp n; jr z", 0xFE, 0x28)                                                                                                  \
+    _FUSION_(4, "rlca; rlca; or e; ld (hl+),a", 0x07, 0x07, 0xB3, 0x22)                                                                    \
+    _FUSION_(5, "rrca; rrca", 0x0F, 0x0F)                                                                                                  \
+    _FUSION_(6, "ld b,a; and n; or d; ld (hl+),a", 0x47, 0xE6, 0xB2, 0x22)                                                                 \
+    _FUSION_(7, "dec c; jr nz", 0x0D, 0x20)                                                                                                \
+    _FUSION_(8, "ld a,b; and n; ld e,a", 0x78, 0xE6, 0x5F)                                                                                 \
+    _FUSION_(9, "dec d; jr nz", 0x15, 0x20)
+
+#define CGBL_PROCESSOR_INSTRUCTION(_INSTRUCTION_, _BRANCH_)                                                                                \
+    _INSTRUCTION_(0x00, 4, "nop", NONE, NOP)                                                                                               \
+    _INSTRUCTION_(0x01, 12, "ld bc,$%04X", WORD, LD_16, BC)                                                                                \
+    _INSTRUCTION_(0x02, 8, "ld (bc),a", NONE, LD, BCI, A)                                                                                  \
+    _INSTRUCTION_(0x03, 8, "inc bc", NONE, INC_16, BC)                                                                                     \
+    _INSTRUCTION_(0x04, 4, "inc b", NONE, INC, B)                                                                                          \
+    _INSTRUCTION_(0x05, 4, "dec b", NONE, DEC, B)                                                                                          \
+    _INSTRUCTION_(0x06, 8, "ld b,$%02X", BYTE, LD, B, N)                                                                                   \
+    _INSTRUCTION_(0x07, 4, "rlca", NONE, RLCA)                                                                                             \
+    _INSTRUCTION_(0x08, 20, "ld ($%04X),sp", WORD, LD_NNI_SP)                                                                              \
+    _INSTRUCTION_(0x09, 8, "add hl,bc", NONE, ADD_HL, BC)                                                                                  \
+    _INSTRUCTION_(0x0A, 8, "ld a,(bc)", NONE, LD, A, BCI)                                                                                  \
+    _INSTRUCTION_(0x0B, 8, "dec bc", NONE, DEC_16, BC)                                                                                     \
+    _INSTRUCTION_(0x0C, 4, "inc c", NONE, INC, C)                                                                                          \
+    _INSTRUCTION_(0x0D, 4, "dec c", NONE, DEC, C)                                                                                          \
+    _INSTRUCTION_(0x0E, 8, "ld c,$%02X", BYTE, LD, C, N)                                                                                   \
+    _INSTRUCTION_(0x0F, 4, "rrca", NONE, RRCA)                                                                                             \
+    _BRANCH_(0x10, 4, "stop", NONE, STOP)                                                                                                  \
+    _INSTRUCTION_(0x11, 12, "ld de,$%04X", WORD, LD_16, DE)                                                                                \
+    _INSTRUCTION_(0x12, 8, "ld (de),a", NONE, LD, DEI, A)                                                                                  \
+    _INSTRUCTION_(0x13, 8, "inc de", NONE, INC_16, DE)                                                                                     \
+    _INSTRUCTION_(0x14, 4, "inc d", NONE, INC, D)                                                                                          \
+    _INSTRUCTION_(0x15, 4, "dec d", NONE, DEC, D)                                                                                          \
+    _INSTRUCTION_(0x16, 8, "ld d,$%02X", BYTE, LD, D, N)                                                                                   \
+    _INSTRUCTION_(0x17, 4, "rla", NONE, RLA)                                                                                               \
+    _BRANCH_(0x18, 8, "jr $%02X", BYTE, JR, ALWAYS, 4)                                                                                     \
+    _INSTRUCTION_(0x19, 8, "add hl,de", NONE, ADD_HL, DE)                                                                                  \
+    _INSTRUCTION_(0x1A, 8, "ld a,(de)", NONE, LD, A, DEI)                                                                                  \
+    _INSTRUCTION_(0x1B, 8, "dec de", NONE, DEC_16, DE)                                                                                     \
+    _INSTRUCTION_(0x1C, 4, "inc e", NONE, INC, E)                                                                                          \
+    _INSTRUCTION_(0x1D, 4, "dec e", NONE, DEC, E)                                                                                          \
+    _INSTRUCTION_(0x1E, 8, "ld e,$%02X", BYTE, LD, E, N)                                                                                   \
+    _INSTRUCTION_(0x1F, 4, "rra", NONE, RRA)                                                                                               \
+    _BRANCH_(0x20, 8, "jr nz,$%02X", BYTE, JR, NZ, 4)                                                                                      \
+    _INSTRUCTION_(0x21, 12, "ld hl,$%04X", WORD, LD_16, HL)                                                                                \
+    _INSTRUCTION_(0x22, 8, "ldi (hl),a", NONE, LD, HLII, A)                                                                                \
+    _INSTRUCTION_(0x23, 8, "inc hl", NONE, INC_16, HL)                                                                                     \
+    _INSTRUCTION_(0x24, 4, "inc h", NONE, INC, H)                                                                                          \
+    _INSTRUCTION_(0x25, 4, "dec h", NONE, DEC, H)                                                                                          \
+    _INSTRUCTION_(0x26, 8, "ld h,$%02X", BYTE, LD, H, N)                                                                                   \
+    _INSTRUCTION_(0x27, 4, "daa", NONE, DAA)                                                                                               \
+    _BRANCH_(0x28, 8, "jr z,$%02X", BYTE, JR, Z, 4)                                                                                        \
+    _INSTRUCTION_(0x29, 8, "add hl,hl", NONE, ADD_HL, HL)                                                                                  \
+    _INSTRUCTION_(0x2A, 8, "ldi a,(hl)", NONE, LD, A, HLII)                                                                                \
+    _INSTRUCTION_(0x2B, 8, "dec hl", NONE, DEC_16, HL)                                                                                     \
+    _INSTRUCTION_(0x2C, 4, "inc l", NONE, INC, L)                                                                                          \
+    _INSTRUCTION_(0x2D, 4, "dec l", NONE, DEC, L)                                                                                          \
+    _INSTRUCTION_(0x2E, 8, "ld l,$%02X", BYTE, LD, L, N)                                                                                   \
+    _INSTRUCTION_(0x2F, 4, "cpl", NONE, CPL)                                                                                               \
+    _BRANCH_(0x30, 8, "jr nc,$%02X", BYTE, JR, NC, 4)                                                                                      \
+    _INSTRUCTION_(0x31, 12, "ld sp,$%04X", WORD, LD_16, SP)                                                                                \
+    _INSTRUCTION_(0x32, 8, "ldd (hl),a", NONE, LD, HLID, A)                                                                                \
+    _INSTRUCTION_(0x33, 8, "inc sp", NONE, INC_16, SP)                                                                                     \
+    _INSTRUCTION_(0x34, 12, "inc (hl)", NONE, INC, HLI)                                                                                    \
+    _INSTRUCTION_(0x35, 12, "dec (hl)", NONE, DEC, HLI)                                                                                    \
+    _INSTRUCTION_(0x36, 12, "ld (hl),$%02X", BYTE, LD, HLI, N)                                                                             \
+    _INSTRUCTION_(0x37, 4, "scf", NONE, SCF)                                                                                               \
+    _BRANCH_(0x38, 8, "jr c,$%02X", BYTE, JR, C, 4)                                                                                        \
+    _INSTRUCTION_(0x39, 8, "add hl,sp", NONE, ADD_HL, SP)                                                                                  \
+    _INSTRUCTION_(0x3A, 8, "ldd a,(hl)", NONE, LD, A, HLID)                                                                                \
+    _INSTRUCTION_(0x3B, 8, "dec sp", NONE, DEC_16, SP)                                                                                     \
+    _INSTRUCTION_(0x3C, 4, "inc a", NONE, INC, A)                                                                                          \
+    _INSTRUCTION_(0x3D, 4, "dec a", NONE, DEC, A)                                                                                          \
+    _INSTRUCTION_(0x3E, 8, "ld a,$%02X", BYTE, LD, A, N)                                                                                   \
+    _INSTRUCTION_(0x3F, 4, "ccf", NONE, CCF)                                                                                               \
+    _INSTRUCTION_(0x40, 4, "ld b,b", NONE, LD, B, B)                                                                                       \
+    _INSTRUCTION_(0x41, 4, "ld b,c", NONE, LD, B, C)                                                                                       \
+    _INSTRUCTION_(0x42, 4, "ld b,d", NONE, LD, B, D)                                                                                       \
+    _INSTRUCTION_(0x43, 4, "ld b,e", NONE, LD, B, E)                                                                                       \
+    _INSTRUCTION_(0x44, 4, "ld b,h", NONE, LD, B, H)                                                                                       \
+    _INSTRUCTION_(0x45, 4, "ld b,l", NONE, LD, B, L)                                                                                       \
+    _INSTRUCTION_(0x46, 8, "ld b,(hl)", NONE, LD, B, HLI)                                                                                  \
+    _INSTRUCTION_(0x47, 4, "ld b,a", NONE, LD, B, A)                                                                                       \
+    _INSTRUCTION_(0x48, 4, "ld c,b", NONE, LD, C, B)                                                                                       \
+    _INSTRUCTION_(0x49, 4, "ld c,c", NONE, LD, C, C)                                                                                       \
+    _INSTRUCTION_(0x4A, 4, "ld c,d", NONE, LD, C, D)                                                                                       \
+    _INSTRUCTION_(0x4B, 4, "ld c,e", NONE, LD, C, E)                                                                                       \
+    _INSTRUCTION_(0x4C, 4, "ld c,h", NONE, LD, C, H)                                                                                       \
+    _INSTRUCTION_(0x4D, 4, "ld c,l", NONE, LD, C, L)                                                                                       \
+    _INSTRUCTION_(0x4E, 8, "ld c,(hl)", NONE, LD, C, HLI)                                                                                  \
+    _INSTRUCTION_(0x4F, 4, "ld c,a", NONE, LD, C, A)                                                                                       \
+    _INSTRUCTION_(0x50, 4, "ld d,b", NONE, LD, D, B)                                                                                       \
+    _INSTRUCTION_(0x51, 4, "ld d,c", NONE, LD, D, C)                                                                                       \
+    _INSTRUCTION_(0x52, 4, "ld d,d", NONE, LD, D, D)                                                                                       \
+    _INSTRUCTION_(0x53, 4, "ld d,e", NONE, LD, D, E)                                                                                       \
+    _INSTRUCTION_(0x54, 4, "ld d,h", NONE, LD, D, H)                                                                                       \
+    _INSTRUCTION_(0x55, 4, "ld d,l", NONE, LD, D, L)                                                                                       \
+    _INSTRUCTION_(0x56, 8, "ld d,(hl)", NONE, LD, D, HLI)                                                                                  \
+    _INSTRUCTION_(0x57, 4, "ld d,a", NONE, LD, D, A)                                                                                       \
+    _INSTRUCTION_(0x58, 4, "ld e,b", NONE, LD, E, B)                                                                                       \
+    _INSTRUCTION_(0x59, 4, "ld e,c", NONE, LD, E, C)                                                                                       \
+    _INSTRUCTION_(0x5A, 4, "ld e,d", NONE, LD, E, D)                                                                                       \
+    _INSTRUCTION_(0x5B, 4, "ld e,e", NONE, LD, E, E)                                                                                       \
+    _INSTRUCTION_(0x5C, 4, "ld e,h", NONE, LD, E, H)                                                                                       \
+    _INSTRUCTION_(0x5D, 4, "ld e,l", NONE, LD, E, L)                                                                                       \
+    _INSTRUCTION_(0x5E, 8, "ld e,(hl)", NONE, LD, E, HLI)                                                                                  \
+    _INSTRUCTION_(0x5F, 4, "ld e,a", NONE, LD, E, A)                                                                                       \
+    _INSTRUCTION_(0x60, 4, "ld h,b", NONE, LD, H, B)                                                                                       \
+    _INSTRUCTION_(0x61, 4, "ld h,c", NONE, LD, H, C)                                                                                       \
+    _INSTRUCTION_(0x62, 4, "ld h,d", NONE, LD, H, D)                                                                                       \
+    _INSTRUCTION_(0x63, 4, "ld h,e", NONE, LD, H, E)                                                                                       \
+    _INSTRUCTION_(0x64, 4, "ld h,h", NONE, LD, H, H)                                                                                       \
+    _INSTRUCTION_(0x65, 4, "ld h,l", NONE, LD, H, L)                                                                                       \
+    _INSTRUCTION_(0x66, 8, "ld h,(hl)", NONE, LD, H, HLI)                                                                                  \
+    _INSTRUCTION_(0x67, 4, "ld h,a", NONE, LD, H, A)                                                                                       \
+    _INSTRUCTION_(0x68, 4, "ld l,b", NONE, LD, L, B)                                                                                       \
+    _INSTRUCTION_(0x69, 4, "ld l,c", NONE, LD, L, C)                                                                                       \
+    _INSTRUCTION_(0x6A, 4, "ld l,d", NONE, LD, L, D)                                                                                       \
+    _INSTRUCTION_(0x6B, 4, "ld l,e", NONE, LD, L, E)                                                                                       \
+    _INSTRUCTION_(0x6C, 4, "ld l,h", NONE, LD, L, H)                                                                                       \
+    _INSTRUCTION_(0x6D, 4, "ld l,l", NONE, LD, L, L)                                                                                       \
+    _INSTRUCTION_(0x6E, 8, "ld l,(hl)", NONE, LD, L, HLI)                                                                                  \
+    _INSTRUCTION_(0x6F, 4, "ld l,a", NONE, LD, L, A)                                                                                       \
+    _INSTRUCTION_(0x70, 8, "ld (hl),b", NONE, LD, HLI, B)                                                                                  \
+    _INSTRUCTION_(0x71, 8, "ld (hl),c", NONE, LD, HLI, C)                                                                                  \
+    _INSTRUCTION_(0x72, 8, "ld (hl),d", NONE, LD, HLI, D)                                                                                  \
+    _INSTRUCTION_(0x73, 8, "ld (hl),e", NONE, LD, HLI, E)                                                                                  \
+    _INSTRUCTION_(0x74, 8, "ld (hl),h", NONE, LD, HLI, H)                                                                                  \
+    _INSTRUCTION_(0x75, 8, "ld (hl),l", NONE, LD, HLI, L)                                                                                  \
+    _BRANCH_(0x76, 4, "halt", NONE, HALT)                                                                                                  \
+    _INSTRUCTION_(0x77, 8, "ld (hl),a", NONE, LD, HLI, A)                                                                                  \
+    _INSTRUCTION_(0x78, 4, "ld a,b", NONE, LD, A, B)                                                                                       \
+    _INSTRUCTION_(0x79, 4, "ld a,c", NONE, LD, A, C)                                                                                       \
+    _INSTRUCTION_(0x7A, 4, "ld a,d", NONE, LD, A, D)                                                                                       \
+    _INSTRUCTION_(0x7B, 4, "ld a,e", NONE, LD, A, E)                                                                                       \
+    _INSTRUCTION_(0x7C, 4, "ld a,h", NONE, LD, A, H)                                                                                       \
+    _INSTRUCTION_(0x7D, 4, "ld a,l", NONE, LD, A, L)                                                                                       \
+    _INSTRUCTION_(0x7E, 8, "ld a,(hl)", NONE, LD, A, HLI)                                                                                  \
+    _INSTRUCTION_(0x7F, 4, "ld a,a", NONE, LD, A, A)                                                                                       \
+    _INSTRUCTION_(0x80, 4, "add a,b", NONE, ADD, B)                                                                                        \
+    _INSTRUCTION_(0x81, 4, "add a,c", NONE, ADD, C)                                                                                        \
+    _INSTRUCTION_(0x82, 4, "add a,d", NONE, ADD, D)                                                                                        \
+    _INSTRUCTION_(0x83, 4, "add a,e", NONE, ADD, E)                                                                                        \
+    _INSTRUCTION_(0x84, 4, "add a,h", NONE, ADD, H)                                                                                        \
+    _INSTRUCTION_(0x85, 4, "add a,l", NONE, ADD, L)                                                                                        \
+    _INSTRUCTION_(0x86, 8, "add a,(hl)", NONE, ADD, HLI)                                                                                   \
+    _INSTRUCTION_(0x87, 4, "add a,a", NONE, ADD, A)                                                                                        \
+    _INSTRUCTION_(0x88, 4, "adc a,b", NONE, ADC, B)                                                                                        \
+    _INSTRUCTION_(0x89, 4, "adc a,c", NONE, ADC, C)                                                                                        \
+    _INSTRUCTION_(0x8A, 4, "adc a,d", NONE, ADC, D)                                                                                        \
+    _INSTRUCTION_(0x8B, 4, "adc a,e", NONE, ADC, E)                                                                                        \
+    _INSTRUCTION_(0x8C, 4, "adc a,h", NONE, ADC, H)                                                                                        \
+    _INSTRUCTION_(0x8D, 4, "adc a,l", NONE, ADC, L)                                                                                        \
+    _INSTRUCTION_(0x8E, 8, "adc a,(hl)", NONE, ADC, HLI)                                                                                   \
+    _INSTRUCTION_(0x8F, 4, "adc a,a", NONE, ADC, A)                                                                                        \
+    _INSTRUCTION_(0x90, 4, "sub a,b", NONE, SUB, B)                                                                                        \
+    _INSTRUCTION_(0x91, 4, "sub a,c", NONE, SUB, C)                                                                                        \
+    _INSTRUCTION_(0x92, 4, "sub a,d", NONE, SUB, D)                                                                                        \
+    _INSTRUCTION_(0x93, 4, "sub a,e", NONE, SUB, E)                                                                                        \
+    _INSTRUCTION_(0x94, 4, "sub a,h", NONE, SUB, H)                                                                                        \
+    _INSTRUCTION_(0x95, 4, "sub a,l", NONE, SUB, L)                                                                                        \
+    _INSTRUCTION_(0x96, 8, "sub a,(hl)", NONE, SUB, HLI)                                                                                   \
+    _INSTRUCTION_(0x97, 4, "sub a,a", NONE, SUB, A)                                                                                        \
+    _INSTRUCTION_(0x98, 4, "sbc a,b", NONE, SBC, B)                                                                                        \
+    _INSTRUCTION_(0x99, 4, "sbc a,c", NONE, SBC, C)                                                                                        \
+    _INSTRUCTION_(0x9A, 4, "sbc a,d", NONE, SBC, D)                                                                                        \
+    _INSTRUCTION_(0x9B, 4, "sbc a,e", NONE, SBC, E)                                                                                        \
+    _INSTRUCTION_(0x9C, 4, "sbc a,h", NONE, SBC, H)                                                                                        \
+    _INSTRUCTION_(0x9D, 4, "sbc a,l", NONE, SBC, L)                                                                                        \
+    _INSTRUCTION_(0x9E, 8, "sbc a,(hl)", NONE, SBC, HLI)                                                                                   \
+    _INSTRUCTION_(0x9F, 4, "sbc a,a", NONE, SBC, A)                                                                                        \
+    _INSTRUCTION_(0xA0, 4, "and a,b", NONE, AND, B)                                                                                        \
+    _INSTRUCTION_(0xA1, 4, "and a,c", NONE, AND, C)                                                                                        \
+    _INSTRUCTION_(0xA2, 4, "and a,d", NONE, AND, D)                                                                                        \
+    _INSTRUCTION_(0xA3, 4, "and a,e", NONE, AND, E)                                                                                        \
+    _INSTRUCTION_(0xA4, 4, "and a,h", NONE, AND, H)                                                                                        \
+    _INSTRUCTION_(0xA5, 4, "and a,l", NONE, AND, L)                                                                                        \
+    _INSTRUCTION_(0xA6, 8, "and a,(hl)", NONE, AND, HLI)                                                                                   \
+    _INSTRUCTION_(0xA7, 4, "and a,a", NONE, AND, A)                                                                                        \
+    _INSTRUCTION_(0xA8, 4, "xor a,b", NONE, XOR, B)                                                                                        \
+    _INSTRUCTION_(0xA9, 4, "xor a,c", NONE, XOR, C)                                                                                        \
+    _INSTRUCTION_(0xAA, 4, "xor a,d", NONE, XOR, D)                                                                                        \
+    _INSTRUCTION_(0xAB, 4, "xor a,e", NONE, XOR, E)                                                                                        \
+    _INSTRUCTION_(0xAC, 4, "xor a,h", NONE, XOR, H)                                                                                        \
+    _INSTRUCTION_(0xAD, 4, "xor a,l", NONE, XOR, L)                                                                                        \
+    _INSTRUCTION_(0xAE, 8, "xor a,(hl)", NONE, XOR, HLI)                                                                                   \
+    _INSTRUCTION_(0xAF, 4, "xor a,a", NONE, XOR, A)                                                                                        \
+    _INSTRUCTION_(0xB0, 4, "or a,b", NONE, OR, B)                                                                                          \
+    _INSTRUCTION_(0xB1, 4, "or a,c", NONE, OR, C)                                                                                          \
+    _INSTRUCTION_(0xB2, 4, "or a,d", NONE, OR, D)                                                                                          \
+    _INSTRUCTION_(0xB3, 4, "or a,e", NONE, OR, E)                                                                                          \
+    _INSTRUCTION_(0xB4, 4, "or a,h", NONE, OR, H)                                                                                          \
+    _INSTRUCTION_(0xB5, 4, "or a,l", NONE, OR, L)                                                                                          \
+    _INSTRUCTION_(0xB6, 8, "or a,(hl)", NONE, OR, HLI)                                                                                     \
+    _INSTRUCTION_(0xB7, 4, "or a,a", NONE, OR, A)                                                                                          \
+    _INSTRUCTION_(0xB8, 4, "cp a,b", NONE, CP, B)                                                                                          \
+    _INSTRUCTION_(0xB9, 4, "cp a,c", NONE, CP, C)                                                                                          \
+    _INSTRUCTION_(0xBA, 4, "cp a,d", NONE, CP, D)                                                                                          \
+    _INSTRUCTION_(0xBB, 4, "cp a,e", NONE, CP, E)                                                                                          \
+    _INSTRUCTION_(0xBC, 4, "cp a,h", NONE, CP, H)                                                                                          \
+    _INSTRUCTION_(0xBD, 4, "cp a,l", NONE, CP, L)                                                                                          \
+    _INSTRUCTION_(0xBE, 8, "cp a,(hl)", NONE, CP, HLI)                                                                                     \
+    _INSTRUCTION_(0xBF, 4, "cp a,a", NONE, CP, A)                                                                                          \
+    _BRANCH_(0xC0, 8, "ret nz", NONE, RET, NZ, 12)                                                                                         \
+    _INSTRUCTION_(0xC1, 12, "pop bc", NONE, POP, BC)                                                                                       \
+    _BRANCH_(0xC2, 12, "jp nz,$%04X", WORD, JP, NZ, 4)                                                                                     \
+    _BRANCH_(0xC3, 12, "jp $%04X", WORD, JP, ALWAYS, 4)                                                                                    \
+    _BRANCH_(0xC4, 12, "call nz,$%04X", WORD, CALL, NZ, 12)                                                                                \
+    _INSTRUCTION_(0xC5, 16, "push bc", NONE, PUSH, BC)                                                                                     \
+    _INSTRUCTION_(0xC6, 8, "add a,$%02X", BYTE, ADD, N)                                                                                    \
+    _BRANCH_(0xC7, 16, "rst $00", NONE, RST, 0x00)                                                                                         \
+    _BRANCH_(0xC8, 8, "ret z", NONE, RET, Z, 12)                                                                                           \
+    _BRANCH_(0xC9, 8, "ret", NONE, RET, ALWAYS, 8)                                                                                         \
+    _BRANCH_(0xCA, 12, "jp z,$%04X", WORD, JP, Z, 4)                                                                                       \
+    _BRANCH_(0xCB, 4, "???", NONE, XXX)                                                                                                    \
+    _BRANCH_(0xCC, 12, "call z,$%04X", WORD, CALL, Z, 12)                                                                                  \
+    _BRANCH_(0xCD, 12, "call $%04X", WORD, CALL, ALWAYS, 12)                                                                               \
+    _INSTRUCTION_(0xCE, 8, "adc a,$%02X", BYTE, ADC, N)                                                                                    \
+    _BRANCH_(0xCF, 16, "rst $08", NONE, RST, 0x08)                                                                                         \
+    _BRANCH_(0xD0, 8, "ret nc", NONE, RET, NC, 12)                                                                                         \
+    _INSTRUCTION_(0xD1, 12, "pop de", NONE, POP, DE)                                                                                       \
+    _BRANCH_(0xD2, 12, "jp nc,$%04X", WORD, JP, NC, 4)                                                                                     \
+    _BRANCH_(0xD3, 4, "???", NONE, XXX)                                                                                                    \
+    _BRANCH_(0xD4, 12, "call nc,$%04X", WORD, CALL, NC, 12)                                                                                \
+    _INSTRUCTION_(0xD5, 16, "push de", NONE, PUSH, DE)                                                                                     \
+    _INSTRUCTION_(0xD6, 8, "sub a,$%02X", BYTE, SUB, N)                                                                                    \
+    _BRANCH_(0xD7, 16, "rst $10", NONE, RST, 0x10)                                                                                         \
+    _BRANCH_(0xD8, 8, "ret c", NONE, RET, C, 12)                                                                                           \
+    _BRANCH_(0xD9, 16, "reti", NONE, RETI)                                                                                                 \
+    _BRANCH_(0xDA, 12, "jp c,$%04X", WORD, JP, C, 4)                                                                                       \
+    _BRANCH_(0xDB, 4, "???", NONE, XXX)                                                                                                    \
+    _BRANCH_(0xDC, 12, "call c,$%04X", WORD, CALL, C, 12)                                                                                  \
+    _BRANCH_(0xDD, 4, "???", NONE, XXX)                                                                                                    \
+    _INSTRUCTION_(0xDE, 8, "sbc a,$%02X", BYTE, SBC, N)                                                                                    \
+    _BRANCH_(0xDF, 16, "rst $18", NONE, RST, 0x18)                                                                                         \
+    _INSTRUCTION_(0xE0, 12, "ld ($FF00+$%02X),a", BYTE, LD, FF00_NI, A)                                                                    \
+    _INSTRUCTION_(0xE1, 12, "pop hl", NONE, POP, HL)                                                                                       \
+    _INSTRUCTION_(0xE2, 8, "ld ($FF00+c),a", NONE, LD, FF00_CI, A)                                                                         \
+    _BRANCH_(0xE3, 4, "???", NONE, XXX)                                                                                                    \
+    _BRANCH_(0xE4, 4, "???", NONE, XXX)                                                                                                    \
+    _INSTRUCTION_(0xE5, 16, "push hl", NONE, PUSH, HL)                                                                                     \
+    _INSTRUCTION_(0xE6, 8, "and a,$%02X", BYTE, AND, N)                                                                                    \
+    _BRANCH_(0xE7, 16, "rst $20", NONE, RST, 0x20)                                                                                         \
+    _INSTRUCTION_(0xE8, 16, "add sp,$%02X", BYTE, ADD_SP, SP)                                                                              \
+    _BRANCH_(0xE9, 4, "jp hl", NONE, JP_HL)                                                                                                \
+    _INSTRUCTION_(0xEA, 16, "ld ($%04X),a", WORD, LD, NNI, A)                                                                              \
+    _BRANCH_(0xEB, 4, "???", NONE, XXX)                                                                                                    \
+    _BRANCH_(0xEC, 4, "???", NONE, XXX)                                                                                                    \
+    _BRANCH_(0xED, 4, "???", NONE, XXX)                                                                                                    \
+    _INSTRUCTION_(0xEE, 8, "xor a,$%02X", BYTE, XOR, N)                                                                                    \
+    _BRANCH_(0xEF, 16, "rst $28", NONE, RST, 0x28)                                                                                         \
+    _INSTRUCTION_(0xF0, 12, "ld a,($FF00+$%02X)", BYTE, LD, A, FF00_NI)                                                                    \
+    _INSTRUCTION_(0xF1, 12, "pop af", NONE, POP_AF)                                                                                        \
+    _INSTRUCTION_(0xF2, 8, "ld a,($FF00+c)", NONE, LD, A, FF00_CI)                                                                         \
+    _INSTRUCTION_(0xF3, 4, "di", NONE, DI)                                                                                                 \
+    _BRANCH_(0xF4, 4, "???", NONE, XXX)                                                                                                    \
+    _INSTRUCTION_(0xF5, 16, "push af", NONE, PUSH_AF)                                                                                      \
+    _INSTRUCTION_(0xF6, 8, "or a,$%02X", BYTE, OR, N)                                                                                      \
+    _BRANCH_(0xF7, 16, "rst $30", NONE, RST, 0x30)                                                                                         \
+    _INSTRUCTION_(0xF8, 12, "ld hl,sp+$%02X", BYTE, ADD_SP, HL)                                                                            \
+    _INSTRUCTION_(0xF9, 8, "ld sp,hl", NONE, LD_SP_HL)                                                                                     \
+    _INSTRUCTION_(0xFA, 16, "ld a,($%04X)", WORD, LD, A, NNI)                                                                              \
+    _INSTRUCTION_(0xFB, 4, "ei", NONE, EI)                                                                                                 \
+    _BRANCH_(0xFC, 4, "???", NONE, XXX)                                                                                                    \
+    _BRANCH_(0xFD, 4, "???", NONE, XXX)                                                                                                    \
+    _INSTRUCTION_(0xFE, 8, "cp a,$%02X", BYTE, CP, N)                                                                                      \
+    _BRANCH_(0xFF, 16, "rst $38", NONE, RST, 0x38)
+
+#define CGBL_PROCESSOR_INSTRUCTION_PREFIX(_INSTRUCTION_)                                                                                   \
+    _INSTRUCTION_(0x00, 8, "rlc b", NONE, RLC, B)                                                                                          \
+    _INSTRUCTION_(0x01, 8, "rlc c", NONE, RLC, C)                                                                                          \
+    _INSTRUCTION_(0x02, 8, "rlc d", NONE, RLC, D)                                                                                          \
+    _INSTRUCTION_(0x03, 8, "rlc e", NONE, RLC, E)                                                                                          \
+    _INSTRUCTION_(0x04, 8, "rlc h", NONE, RLC, H)                                                                                          \
+    _INSTRUCTION_(0x05, 8, "rlc l", NONE, RLC, L)                                                                                          \
+    _INSTRUCTION_(0x06, 16, "rlc (hl)", NONE, RLC, HLI)                                                                                    \
+    _INSTRUCTION_(0x07, 8, "rlc a", NONE, RLC, A)                                                                                          \
+    _INSTRUCTION_(0x08, 8, "rrc b", NONE, RRC, B)                                                                                          \
+    _INSTRUCTION_(0x09, 8, "rrc c", NONE, RRC, C)                                                                                          \
+    _INSTRUCTION_(0x0A, 8, "rrc d", NONE, RRC, D)                                                                                          \
+    _INSTRUCTION_(0x0B, 8, "rrc e", NONE, RRC, E)                                                                                          \
+    _INSTRUCTION_(0x0C, 8, "rrc h", NONE, RRC, H)                                                                                          \
+    _INSTRUCTION_(0x0D, 8, "rrc l", NONE, RRC, L)                                                                                          \
+    _INSTRUCTION_(0x0E, 16, "rrc (hl)", NONE, RRC, HLI)                                                                                    \
+    _INSTRUCTION_(0x0F, 8, "rrc a", NONE, RRC, A)                                                                                          \
+    _INSTRUCTION_(0x10, 8, "rl b", NONE, RL, B)                                                                                            \
+    _INSTRUCTION_(0x11, 8, "rl c", NONE, RL, C)                                                                                            \
+    _INSTRUCTION_(0x12, 8, "rl d", NONE, RL, D)                                                                                            \
+    _INSTRUCTION_(0x13, 8, "rl e", NONE, RL, E)                                                                                            \
+    _INSTRUCTION_(0x14, 8, "rl h", NONE, RL, H)                                                                                            \
+    _INSTRUCTION_(0x15, 8, "rl l", NONE, RL, L)                                                                                            \
+    _INSTRUCTION_(0x16, 16, "rl (hl)", NONE, RL, HLI)                                                                                      \
+    _INSTRUCTION_(0x17, 8, "rl a", NONE, RL, A)                                                                                            \
+    _INSTRUCTION_(0x18, 8, "rr b", NONE, RR, B)                                                                                            \
+    _INSTRUCTION_(0x19, 8, "rr c", NONE, RR, C)                                                                                            \
+    _INSTRUCTION_(0x1A, 8, "rr d", NONE, RR, D)                                                                                            \
+    _INSTRUCTION_(0x1B, 8, "rr e", NONE, RR, E)                                                                                            \
+    _INSTRUCTION_(0x1C, 8, "rr h", NONE, RR, H)                                                                                            \
+    _INSTRUCTION_(0x1D, 8, "rr l", NONE, RR, L)                                                                                            \
+    _INSTRUCTION_(0x1E, 16, "rr (hl)", NONE, RR, HLI)                                                                                      \
+    _INSTRUCTION_(0x1F, 8, "rr a", NONE, RR, A)                                                                                            \
+    _INSTRUCTION_(0x20, 8, "sla b", NONE, SLA, B)                                                                                          \
+    _INSTRUCTION_(0x21, 8, "sla c", NONE, SLA, C)                                                                                          \
+    _INSTRUCTION_(0x22, 8, "sla d", NONE, SLA, D)                                                                                          \
+    _INSTRUCTION_(0x23, 8, "sla e", NONE, SLA, E)                                                                                          \
+    _INSTRUCTION_(0x24, 8, "sla h", NONE, SLA, H)                                                                                          \
+    _INSTRUCTION_(0x25, 8, "sla l", NONE, SLA, L)                                                                                          \
+    _INSTRUCTION_(0x26, 16, "sla (hl)", NONE, SLA, HLI)                                                                                    \
+    _INSTRUCTION_(0x27, 8, "sla a", NONE, SLA, A)                                                                                          \
+    _INSTRUCTION_(0x28, 8, "sra b", NONE, SRA, B)                                                                                          \
+    _INSTRUCTION_(0x29, 8, "sra c", NONE, SRA, C)                                                                                          \
+    _INSTRUCTION_(0x2A, 8, "sra d", NONE, SRA, D)                                                                                          \
+    _INSTRUCTION_(0x2B, 8, "sra e", NONE, SRA, E)                                                                                          \
+    _INSTRUCTION_(0x2C, 8, "sra h", NONE, SRA, H)                                                                                          \
+    _INSTRUCTION_(0x2D, 8, "sra l", NONE, SRA, L)                                                                                          \
+    _INSTRUCTION_(0x2E, 16, "sra (hl)", NONE, SRA, HLI)                                                                                    \
+    _INSTRUCTION_(0x2F, 8, "sra a", NONE, SRA, A)                                                                                          \
+    _INSTRUCTION_(0x30, 8, "swap b", NONE, SWAP, B)                                                                                        \
+    _INSTRUCTION_(0x31, 8, "swap c", NONE, SWAP, C)                                                                                        \
+    _INSTRUCTION_(0x32, 8, "swap d", NONE, SWAP, D)                                                                                        \
+    _INSTRUCTION_(0x33, 8, "swap e", NONE, SWAP, E)                                                                                        \
+    _INSTRUCTION_(0x34, 8, "swap h", NONE, SWAP, H)                                                                                        \
+    _INSTRUCTION_(0x35, 8, "swap l", NONE, SWAP, L)                                                                                        \
+    _INSTRUCTION_(0x36, 16, "swap (hl)", NONE, SWAP, HLI)                                                                                  \
+    _INSTRUCTION_(0x37, 8, "swap a", NONE, SWAP, A)                                                                                        \
+    _INSTRUCTION_(0x38, 8, "srl b", NONE, SRL, B)                                                                                          \
+    _INSTRUCTION_(0x39, 8, "srl c", NONE, SRL, C)                                                                                          \
+    _INSTRUCTION_(0x3A, 8, "srl d", NONE, SRL, D)                                                                                          \
+    _INSTRUCTION_(0x3B, 8, "srl e", NONE, SRL, E)                                                                                          \
+    _INSTRUCTION_(0x3C, 8, "srl h", NONE, SRL, H)                                                                                          \
+    _INSTRUCTION_(0x3D, 8, "srl l", NONE, SRL, L)                                                                                          \
+    _INSTRUCTION_(0x3E, 16, "srl (hl)", NONE, SRL, HLI)                                                                                    \
+    _INSTRUCTION_(0x3F, 8, "srl a", NONE, SRL, A)                                                                                          \
+    _INSTRUCTION_(0x40, 8, "bit 0,b", NONE, BIT, 0, B)                                                                                     \
+    _INSTRUCTION_(0x41, 8, "bit 0,c", NONE, BIT, 0, C)                                                                                     \
+    _INSTRUCTION_(0x42, 8, "bit 0,d", NONE, BIT, 0, D)                                                                                     \
+    _INSTRUCTION_(0x43, 8, "bit 0,e", NONE, BIT, 0, E)                                                                                     \
+    _INSTRUCTION_(0x44, 8, "bit 0,h", NONE, BIT, 0, H)                                                                                     \
+    _INSTRUCTION_(0x45, 8, "bit 0,l", NONE, BIT, 0, L)                                                                                     \
+    _INSTRUCTION_(0x46, 12, "bit 0,(hl)", NONE, BIT, 0, HLI)                                                                               \
+    _INSTRUCTION_(0x47, 8, "bit 0,a", NONE, BIT, 0, A)                                                                                     \
+    _INSTRUCTION_(0x48, 8, "bit 1,b", NONE, BIT, 1, B)                                                                                     \
+    _INSTRUCTION_(0x49, 8, "bit 1,c", NONE, BIT, 1, C)                                                                                     \
+    _INSTRUCTION_(0x4A, 8, "bit 1,d", NONE, BIT, 1, D)                                                                                     \
+    _INSTRUCTION_(0x4B, 8, "bit 1,e", NONE, BIT, 1, E)                                                                                     \
+    _INSTRUCTION_(0x4C, 8, "bit 1,h", NONE, BIT, 1, H)                                                                                     \
+    _INSTRUCTION_(0x4D, 8, "bit 1,l", NONE, BIT, 1, L)                                                                                     \
+    _INSTRUCTION_(0x4E, 12, "bit 1,(hl)", NONE, BIT, 1, HLI)                                                                               \
+    _INSTRUCTION_(0x4F, 8, "bit 1,a", NONE, BIT, 1, A)                                                                                     \
+    _INSTRUCTION_(0x50, 8, "bit 2,b", NONE, BIT, 2, B)                                                                                     \
+    _INSTRUCTION_(0x51, 8, "bit 2,c", NONE, BIT, 2, C)                                                                                     \
+    _INSTRUCTION_(0x52, 8, "bit 2,d", NONE, BIT, 2, D)                                                                                     \
+    _INSTRUCTION_(0x53, 8, "bit 2,e", NONE, BIT, 2, E)                                                                                     \
+    _INSTRUCTION_(0x54, 8, "bit 2,h", NONE, BIT, 2, H)                                                                                     \
+    _INSTRUCTION_(0x55, 8, "bit 2,l", NONE, BIT, 2, L)                                                                                     \
+    _INSTRUCTION_(0x56, 12, "bit 2,(hl)", NONE, BIT, 2, HLI)                                                                               \
+    _INSTRUCTION_(0x57, 8, "bit 2,a", NONE, BIT, 2, A)                                                                                     \
+    _INSTRUCTION_(0x58, 8, "bit 3,b", NONE, BIT, 3, B)                                                                                     \
+    _INSTRUCTION_(0x59, 8, "bit 3,c", NONE, BIT, 3, C)                                                                                     \
+    _INSTRUCTION_(0x5A, 8, "bit 3,d", NONE, BIT, 3, D)                                                                                     \
+    _INSTRUCTION_(0x5B, 8, "bit 3,e", NONE, BIT, 3, E)                                                                                     \
+    _INSTRUCTION_(0x5C, 8, "bit 3,h", NONE, BIT, 3, H)                                                                                     \
+    _INSTRUCTION_(0x5D, 8, "bit 3,l", NONE, BIT, 3, L)                                                                                     \
+    _INSTRUCTION_(0x5E, 12, "bit 3,(hl)", NONE, BIT, 3, HLI)                                                                               \
+    _INSTRUCTION_(0x5F, 8, "bit 3,a", NONE, BIT, 3, A)                                                                                     \
+    _INSTRUCTION_(0x60, 8, "bit 4,b", NONE, BIT, 4, B)                                                                                     \
+    _INSTRUCTION_(0x61, 8, "bit 4,c", NONE, BIT, 4, C)                                                                                     \
+    _INSTRUCTION_(0x62, 8, "bit 4,d", NONE, BIT, 4, D)                                                                                     \
+    _INSTRUCTION_(0x63, 8, "bit 4,e", NONE, BIT, 4, E)                                                                                     \
+    _INSTRUCTION_(0x64, 8, "bit 4,h", NONE, BIT, 4, H)                                                                                     \
+    _INSTRUCTION_(0x65, 8, "bit 4,l", NONE, BIT, 4, L)                                                                                     \
+    _INSTRUCTION_(0x66, 12, "bit 4,(hl)", NONE, BIT, 4, HLI)                                                                               \
+    _INSTRUCTION_(0x67, 8, "bit 4,a", NONE, BIT, 4, A)                                                                                     \
+    _INSTRUCTION_(0x68, 8, "bit 5,b", NONE, BIT, 5, B)                                                                                     \
+    _INSTRUCTION_(0x69, 8, "bit 5,c", NONE, BIT, 5, C)                                                                                     \
+    _INSTRUCTION_(0x6A, 8, "bit 5,d", NONE, BIT, 5, D)                                                                                     \
+    _INSTRUCTION_(0x6B, 8, "bit 5,e", NONE, BIT, 5, E)                                                                                     \
+    _INSTRUCTION_(0x6C, 8, "bit 5,h", NONE, BIT, 5, H)                                                                                     \
+    _INSTRUCTION_(0x6D, 8, "bit 5,l", NONE, BIT, 5, L)                                                                                     \
+    _INSTRUCTION_(0x6E, 12, "bit 5,(hl)", NONE, BIT, 5, HLI)                                                                               \
+    _INSTRUCTION_(0x6F, 8, "bit 5,a", NONE, BIT, 5, A)                                                                                     \
+    _INSTRUCTION_(0x70, 8, "bit 6,b", NONE, BIT, 6, B)                                                                                     \
+    _INSTRUCTION_(0x71, 8, "bit 6,c", NONE, BIT, 6, C)                                                                                     \
+    _INSTRUCTION_(0x72, 8, "bit 6,d", NONE, BIT, 6, D)                                                                                     \
+    _INSTRUCTION_(0x73, 8, "bit 6,e", NONE, BIT, 6, E)                                                                                     \
+    _INSTRUCTION_(0x74, 8, "bit 6,h", NONE, BIT, 6, H)                                                                                     \
+    _INSTRUCTION_(0x75, 8, "bit 6,l", NONE, BIT, 6, L)                                                                                     \
+    _INSTRUCTION_(0x76, 12, "bit 6,(hl)", NONE, BIT, 6, HLI)                                                                               \
+    _INSTRUCTION_(0x77, 8, "bit 6,a", NONE, BIT, 6, A)                                                                                     \
+    _INSTRUCTION_(0x78, 8, "bit 7,b", NONE, BIT, 7, B)                                                                                     \
+    _INSTRUCTION_(0x79, 8, "bit 7,c", NONE, BIT, 7, C)                                                                                     \
+    _INSTRUCTION_(0x7A, 8, "bit 7,d", NONE, BIT, 7, D)                                                                                     \
+    _INSTRUCTION_(0x7B, 8, "bit 7,e", NONE, BIT, 7, E)                                                                                     \
+    _INSTRUCTION_(0x7C, 8, "bit 7,h", NONE, BIT, 7, H)                                                                                     \
+    _INSTRUCTION_(0x7D, 8, "bit 7,l", NONE, BIT, 7, L)                                                                                     \
+    _INSTRUCTION_(0x7E, 12, "bit 7,(hl)", NONE, BIT, 7, HLI)                                                                               \
+    _INSTRUCTION_(0x7F, 8, "bit 7,a", NONE, BIT, 7, A)                                                                                     \
+    _INSTRUCTION_(0x80, 8, "res 0,b", NONE, RES, 0, B)                                                                                     \
+    _INSTRUCTION_(0x81, 8, "res 0,c", NONE, RES, 0, C)                                                                                     \
+    _INSTRUCTION_(0x82, 8, "res 0,d", NONE, RES, 0, D)                                                                                     \
+    _INSTRUCTION_(0x83, 8, "res 0,e", NONE, RES, 0, E)                                                                                     \
+    _INSTRUCTION_(0x84, 8, "res 0,h", NONE, RES, 0, H)                                                                                     \
+    _INSTRUCTION_(0x85, 8, "res 0,l", NONE, RES, 0, L)                                                                                     \
+    _INSTRUCTION_(0x86, 16, "res 0,(hl)", NONE, RES, 0, HLI)                                                                               \
+    _INSTRUCTION_(0x87, 8, "res 0,a", NONE, RES, 0, A)                                                                                     \
+    _INSTRUCTION_(0x88, 8, "res 1,b", NONE, RES, 1, B)                                                                                     \
+    _INSTRUCTION_(0x89, 8, "res 1,c", NONE, RES, 1, C)                                                                                     \
+    _INSTRUCTION_(0x8A, 8, "res 1,d", NONE, RES, 1, D)                                                                                     \
+    _INSTRUCTION_(0x8B, 8, "res 1,e", NONE, RES, 1, E)                                                                                     \
+    _INSTRUCTION_(0x8C, 8, "res 1,h", NONE, RES, 1, H)                                                                                     \
+    _INSTRUCTION_(0x8D, 8, "res 1,l", NONE, RES, 1, L)                                                                                     \
+    _INSTRUCTION_(0x8E, 16, "res 1,(hl)", NONE, RES, 1, HLI)                                                                               \
+    _INSTRUCTION_(0x8F, 8, "res 1,a", NONE, RES, 1, A)                                                                                     \
+    _INSTRUCTION_(0x90, 8, "res 2,b", NONE, RES, 2, B)                                                                                     \
+    _INSTRUCTION_(0x91, 8, "res 2,c", NONE, RES, 2, C)                                                                                     \
+    _INSTRUCTION_(0x92, 8, "res 2,d", NONE, RES, 2, D)                                                                                     \
+    _INSTRUCTION_(0x93, 8, "res 2,e", NONE, RES, 2, E)                                                                                     \
+    _INSTRUCTION_(0x94, 8, "res 2,h", NONE, RES, 2, H)                                                                                     \
+    _INSTRUCTION_(0x95, 8, "res 2,l", NONE, RES, 2, L)                                                                                     \
+    _INSTRUCTION_(0x96, 16, "res 2,(hl)", NONE, RES, 2, HLI)                                                                               \
+    _INSTRUCTION_(0x97, 8, "res 2,a", NONE, RES, 2, A)                                                                                     \
+    _INSTRUCTION_(0x98, 8, "res 3,b", NONE, RES, 3, B)                                                                                     \
+    _INSTRUCTION_(0x99, 8, "res 3,c", NONE, RES, 3, C)                                                                                     \
+    _INSTRUCTION_(0x9A, 8, "res 3,d", NONE, RES, 3, D)                                                                                     \
+    _INSTRUCTION_(0x9B, 8, "res 3,e", NONE, RES, 3, E)                                                                                     \
+    _INSTRUCTION_(0x9C, 8, "res 3,h", NONE, RES, 3, H)                                                                                     \
+    _INSTRUCTION_(0x9D, 8, "res 3,l", NONE, RES, 3, L)                                                                                     \
+    _INSTRUCTION_(0x9E, 16, "res 3,(hl)", NONE, RES, 3, HLI)                                                                               \
+    _INSTRUCTION_(0x9F, 8, "res 3,a", NONE, RES, 3, A)                                                                                     \
+    _INSTRUCTION_(0xA0, 8, "res 4,b", NONE, RES, 4, B)                                                                                     \
+    _INSTRUCTION_(0xA1, 8, "res 4,c", NONE, RES, 4, C)                                                                                     \
+    _INSTRUCTION_(0xA2, 8, "res 4,d", NONE, RES, 4, D)                                                                                     \
+    _INSTRUCTION_(0xA3, 8, "res 4,e", NONE, RES, 4, E)                                                                                     \
+    _INSTRUCTION_(0xA4, 8, "res 4,h", NONE, RES, 4, H)                                                                                     \
+    _INSTRUCTION_(0xA5, 8, "res 4,l", NONE, RES, 4, L)                                                                                     \
+    _INSTRUCTION_(0xA6, 16, "res 4,(hl)", NONE, RES, 4, HLI)                                                                               \
+    _INSTRUCTION_(0xA7, 8, "res 4,a", NONE, RES, 4, A)                                                                                     \
+    _INSTRUCTION_(0xA8, 8, "res 5,b", NONE, RES, 5, B)                                                                                     \
+    _INSTRUCTION_(0xA9, 8, "res 5,c", NONE, RES, 5, C)                                                                                     \
+    _INSTRUCTION_(0xAA, 8, "res 5,d", NONE, RES, 5, D)                                                                                     \
+    _INSTRUCTION_(0xAB, 8, "res 5,e", NONE, RES, 5, E)                                                                                     \
+    _INSTRUCTION_(0xAC, 8, "res 5,h", NONE, RES, 5, H)                                                                                     \
+    _INSTRUCTION_(0xAD, 8, "res 5,l", NONE, RES, 5, L)                                                                                     \
+    _INSTRUCTION_(0xAE, 16, "res 5,(hl)", NONE, RES, 5, HLI)                                                                               \
+    _INSTRUCTION_(0xAF, 8, "res 5,a", NONE, RES, 5, A)                                                                                     \
+    _INSTRUCTION_(0xB0, 8, "res 6,b", NONE, RES, 6, B)                                                                                     \
+    _INSTRUCTION_(0xB1, 8, "res 6,c", NONE, RES, 6, C)                                                                                     \
+    _INSTRUCTION_(0xB2, 8, "res 6,d", NONE, RES, 6, D)                                                                                     \
+    _INSTRUCTION_(0xB3, 8, "res 6,e", NONE, RES, 6, E)                                                                                     \
+    _INSTRUCTION_(0xB4, 8, "res 6,h", NONE, RES, 6, H)                                                                                     \
+    _INSTRUCTION_(0xB5, 8, "res 6,l", NONE, RES, 6, L)                                                                                     \
+    _INSTRUCTION_(0xB6, 16, "res 6,(hl)", NONE, RES, 6, HLI)                                                                               \
+    _INSTRUCTION_(0xB7, 8, "res 6,a", NONE, RES, 6, A)                                                                                     \
+    _INSTRUCTION_(0xB8, 8, "res 7,b", NONE, RES, 7, B)                                                                                     \
+    _INSTRUCTION_(0xB9, 8, "res 7,c", NONE, RES, 7, C)                                                                                     \
+    _INSTRUCTION_(0xBA, 8, "res 7,d", NONE, RES, 7, D)                                                                                     \
+    _INSTRUCTION_(0xBB, 8, "res 7,e", NONE, RES, 7, E)                                                                                     \
+    _INSTRUCTION_(0xBC, 8, "res 7,h", NONE, RES, 7, H)                                                                                     \
+    _INSTRUCTION_(0xBD, 8, "res 7,l", NONE, RES, 7, L)                                                                                     \
+    _INSTRUCTION_(0xBE, 16, "res 7,(hl)", NONE, RES, 7, HLI)                                                                               \
+    _INSTRUCTION_(0xBF, 8, "res 7,a", NONE, RES, 7, A)                                                                                     \
+    _INSTRUCTION_(0xC0, 8, "set 0,b", NONE, SET, 0, B)                                                                                     \
+    _INSTRUCTION_(0xC1, 8, "set 0,c", NONE, SET, 0, C)                                                                                     \
+    _INSTRUCTION_(0xC2, 8, "set 0,d", NONE, SET, 0, D)                                                                                     \
+    _INSTRUCTION_(0xC3, 8, "set 0,e", NONE, SET, 0, E)                                                                                     \
+    _INSTRUCTION_(0xC4, 8, "set 0,h", NONE, SET, 0, H)                                                                                     \
+    _INSTRUCTION_(0xC5, 8, "set 0,l", NONE, SET, 0, L)                                                                                     \
+    _INSTRUCTION_(0xC6, 16, "set 0,(hl)", NONE, SET, 0, HLI)                                                                               \
+    _INSTRUCTION_(0xC7, 8, "set 0,a", NONE, SET, 0, A)                                                                                     \
+    _INSTRUCTION_(0xC8, 8, "set 1,b", NONE, SET, 1, B)                                                                                     \
+    _INSTRUCTION_(0xC9, 8, "set 1,c", NONE, SET, 1, C)                                                                                     \
+    _INSTRUCTION_(0xCA, 8, "set 1,d", NONE, SET, 1, D)                                                                                     \
+    _INSTRUCTION_(0xCB, 8, "set 1,e", NONE, SET, 1, E)                                                                                     \
+    _INSTRUCTION_(0xCC, 8, "set 1,h", NONE, SET, 1, H)                                                                                     \
+    _INSTRUCTION_(0xCD, 8, "set 1,l", NONE, SET, 1, L)                                                                                     \
+    _INSTRUCTION_(0xCE, 16, "set 1,(hl)", NONE, SET, 1, HLI)                                                                               \
+    _INSTRUCTION_(0xCF, 8, "set 1,a", NONE, SET, 1, A)                                                                                     \
+    _INSTRUCTION_(0xD0, 8, "set 2,b", NONE, SET, 2, B)                                                                                     \
+    _INSTRUCTION_(0xD1, 8, "set 2,c", NONE, SET, 2, C)                                                                                     \
+    _INSTRUCTION_(0xD2, 8, "set 2,d", NONE, SET, 2, D)                                                                                     \
+    _INSTRUCTION_(0xD3, 8, "set 2,e", NONE, SET, 2, E)                                                                                     \
+    _INSTRUCTION_(0xD4, 8, "set 2,h", NONE, SET, 2, H)                                                                                     \
+    _INSTRUCTION_(0xD5, 8, "set 2,l", NONE, SET, 2, L)                                                                                     \
+    _INSTRUCTION_(0xD6, 16, "set 2,(hl)", NONE, SET, 2, HLI)                                                                               \
+    _INSTRUCTION_(0xD7, 8, "set 2,a", NONE, SET, 2, A)                                                                                     \
+    _INSTRUCTION_(0xD8, 8, "set 3,b", NONE, SET, 3, B)                                                                                     \
+    _INSTRUCTION_(0xD9, 8, "set 3,c", NONE, SET, 3, C)                                                                                     \
+    _INSTRUCTION_(0xDA, 8, "set 3,d", NONE, SET, 3, D)                                                                                     \
+    _INSTRUCTION_(0xDB, 8, "set 3,e", NONE, SET, 3, E)                                                                                     \
+    _INSTRUCTION_(0xDC, 8, "set 3,h", NONE, SET, 3, H)                                                                                     \
+    _INSTRUCTION_(0xDD, 8, "set 3,l", NONE, SET, 3, L)                                                                                     \
+    _INSTRUCTION_(0xDE, 16, "set 3,(hl)", NONE, SET, 3, HLI)                                                                               \
+    _INSTRUCTION_(0xDF, 8, "set 3,a", NONE, SET, 3, A)                                                                                     \
+    _INSTRUCTION_(0xE0, 8, "set 4,b", NONE, SET, 4, B)                                                                                     \
+    _INSTRUCTION_(0xE1, 8, "set 4,c", NONE, SET, 4, C)                                                                                     \
+    _INSTRUCTION_(0xE2, 8, "set 4,d", NONE, SET, 4, D)                                                                                     \
+    _INSTRUCTION_(0xE3, 8, "set 4,e", NONE, SET, 4, E)                                                                                     \
+    _INSTRUCTION_(0xE4, 8, "set 4,h", NONE, SET, 4, H)                                                                                     \
+    _INSTRUCTION_(0xE5, 8, "set 4,l", NONE, SET, 4, L)                                                                                     \
+    _INSTRUCTION_(0xE6, 16, "set 4,(hl)", NONE, SET, 4, HLI)                                                                               \
+    _INSTRUCTION_(0xE7, 8, "set 4,a", NONE, SET, 4, A)                                                                                     \
+    _INSTRUCTION_(0xE8, 8, "set 5,b", NONE, SET, 5, B)                                                                                     \
+    _INSTRUCTION_(0xE9, 8, "set 5,c", NONE, SET, 5, C)                                                                                     \
+    _INSTRUCTION_(0xEA, 8, "set 5,d", NONE, SET, 5, D)                                                                                     \
+    _INSTRUCTION_(0xEB, 8, "set 5,e", NONE, SET, 5, E)                                                                                     \
+    _INSTRUCTION_(0xEC, 8, "set 5,h", NONE, SET, 5, H)                                                                                     \
+    _INSTRUCTION_(0xED, 8, "set 5,l", NONE, SET, 5, L)                                                                                     \
+    _INSTRUCTION_(0xEE, 16, "set 5,(hl)", NONE, SET, 5, HLI)                                                                               \
+    _INSTRUCTION_(0xEF, 8, "set 5,a", NONE, SET, 5, A)                                                                                     \
+    _INSTRUCTION_(0xF0, 8, "set 6,b", NONE, SET, 6, B)                                                                                     \
+    _INSTRUCTION_(0xF1, 8, "set 6,c", NONE, SET, 6, C)                                                                                     \
+    _INSTRUCTION_(0xF2, 8, "set 6,d", NONE, SET, 6, D)                                                                                     \
+    _INSTRUCTION_(0xF3, 8, "set 6,e", NONE, SET, 6, E)                                                                                     \
+    _INSTRUCTION_(0xF4, 8, "set 6,h", NONE, SET, 6, H)                                                                                     \
+    _INSTRUCTION_(0xF5, 8, "set 6,l", NONE, SET, 6, L)                                                                                     \
+    _INSTRUCTION_(0xF6, 16, "set 6,(hl)", NONE, SET, 6, HLI)                                                                               \
+    _INSTRUCTION_(0xF7, 8, "set 6,a", NONE, SET, 6, A)                                                                                     \
+    _INSTRUCTION_(0xF8, 8, "set 7,b", NONE, SET, 7, B)                                                                                     \
+    _INSTRUCTION_(0xF9, 8, "set 7,c", NONE, SET, 7, C)                                                                                     \
+    _INSTRUCTION_(0xFA, 8, "set 7,d", NONE, SET, 7, D)                                                                                     \
+    _INSTRUCTION_(0xFB, 8, "set 7,e", NONE, SET, 7, E)                                                                                     \
+    _INSTRUCTION_(0xFC, 8, "set 7,h", NONE, SET, 7, H)                                                                                     \
+    _INSTRUCTION_(0xFD, 8, "set 7,l", NONE, SET, 7, L)                                                                                     \
+    _INSTRUCTION_(0xFE, 16, "set 7,(hl)", NONE, SET, 7, HLI)                                                                               \
+    _INSTRUCTION_(0xFF, 8, "set 7,a", NONE, SET, 7, A)
 
 typedef enum {
-    CGBL_INSTRUCTION_ADC_A = 0x8F,
-    CGBL_INSTRUCTION_ADC_B = 0x88,
-    CGBL_INSTRUCTION_ADC_C = 0x89,
-    CGBL_INSTRUCTION_ADC_D = 0x8A,
-    CGBL_INSTRUCTION_ADC_E = 0x8B,
-    CGBL_INSTRUCTION_ADC_H = 0x8C,
-    CGBL_INSTRUCTION_ADC_HLI = 0x8E,
-    CGBL_INSTRUCTION_ADC_L = 0x8D,
-    CGBL_INSTRUCTION_ADC_N = 0xCE,
-    CGBL_INSTRUCTION_ADD_A = 0x87,
-    CGBL_INSTRUCTION_ADD_B = 0x80,
-    CGBL_INSTRUCTION_ADD_C = 0x81,
-    CGBL_INSTRUCTION_ADD_D = 0x82,
-    CGBL_INSTRUCTION_ADD_E = 0x83,
-    CGBL_INSTRUCTION_ADD_H = 0x84,
-    CGBL_INSTRUCTION_ADD_HL_BC = 0x09,
-    CGBL_INSTRUCTION_ADD_HL_DE = 0x19,
-    CGBL_INSTRUCTION_ADD_HL_HL = 0x29,
-    CGBL_INSTRUCTION_ADD_HL_SP = 0x39,
-    CGBL_INSTRUCTION_ADD_HLI = 0x86,
-    CGBL_INSTRUCTION_ADD_L = 0x85,
-    CGBL_INSTRUCTION_ADD_N = 0xC6,
-    CGBL_INSTRUCTION_AND_A = 0xA7,
-    CGBL_INSTRUCTION_AND_B = 0xA0,
-    CGBL_INSTRUCTION_AND_C = 0xA1,
-    CGBL_INSTRUCTION_AND_D = 0xA2,
-    CGBL_INSTRUCTION_AND_E = 0xA3,
-    CGBL_INSTRUCTION_AND_H = 0xA4,
-    CGBL_INSTRUCTION_AND_HLI = 0xA6,
-    CGBL_INSTRUCTION_AND_L = 0xA5,
-    CGBL_INSTRUCTION_AND_N = 0xE6,
-    CGBL_INSTRUCTION_BIT_0_A = 0x47,
-    CGBL_INSTRUCTION_BIT_0_B = 0x40,
-    CGBL_INSTRUCTION_BIT_0_C = 0x41,
-    CGBL_INSTRUCTION_BIT_0_D = 0x42,
-    CGBL_INSTRUCTION_BIT_0_E = 0x43,
-    CGBL_INSTRUCTION_BIT_0_H = 0x44,
-    CGBL_INSTRUCTION_BIT_0_HLI = 0x46,
-    CGBL_INSTRUCTION_BIT_0_L = 0x45,
-    CGBL_INSTRUCTION_BIT_1_A = 0x4F,
-    CGBL_INSTRUCTION_BIT_1_B = 0x48,
-    CGBL_INSTRUCTION_BIT_1_C = 0x49,
-    CGBL_INSTRUCTION_BIT_1_D = 0x4A,
-    CGBL_INSTRUCTION_BIT_1_E = 0x4B,
-    CGBL_INSTRUCTION_BIT_1_H = 0x4C,
-    CGBL_INSTRUCTION_BIT_1_HLI = 0x4E,
-    CGBL_INSTRUCTION_BIT_1_L = 0x4D,
-    CGBL_INSTRUCTION_BIT_2_A = 0x57,
-    CGBL_INSTRUCTION_BIT_2_B = 0x50,
-    CGBL_INSTRUCTION_BIT_2_C = 0x51,
-    CGBL_INSTRUCTION_BIT_2_D = 0x52,
-    CGBL_INSTRUCTION_BIT_2_E = 0x53,
-    CGBL_INSTRUCTION_BIT_2_H = 0x54,
-    CGBL_INSTRUCTION_BIT_2_HLI = 0x56,
-    CGBL_INSTRUCTION_BIT_2_L = 0x55,
-    CGBL_INSTRUCTION_BIT_3_A = 0x5F,
-    CGBL_INSTRUCTION_BIT_3_B = 0x58,
-    CGBL_INSTRUCTION_BIT_3_C = 0x59,
-    CGBL_INSTRUCTION_BIT_3_D = 0x5A,
-    CGBL_INSTRUCTION_BIT_3_E = 0x5B,
-    CGBL_INSTRUCTION_BIT_3_H = 0x5C,
-    CGBL_INSTRUCTION_BIT_3_HLI = 0x5E,
-    CGBL_INSTRUCTION_BIT_3_L = 0x5D,
-    CGBL_INSTRUCTION_BIT_4_A = 0x67,
-    CGBL_INSTRUCTION_BIT_4_B = 0x60,
-    CGBL_INSTRUCTION_BIT_4_C = 0x61,
-    CGBL_INSTRUCTION_BIT_4_D = 0x62,
-    CGBL_INSTRUCTION_BIT_4_E = 0x63,
-    CGBL_INSTRUCTION_BIT_4_H = 0x64,
-    CGBL_INSTRUCTION_BIT_4_HLI = 0x66,
-    CGBL_INSTRUCTION_BIT_4_L = 0x65,
-    CGBL_INSTRUCTION_BIT_5_A = 0x6F,
-    CGBL_INSTRUCTION_BIT_5_B = 0x68,
-    CGBL_INSTRUCTION_BIT_5_C = 0x69,
-    CGBL_INSTRUCTION_BIT_5_D = 0x6A,
-    CGBL_INSTRUCTION_BIT_5_E = 0x6B,
-    CGBL_INSTRUCTION_BIT_5_H = 0x6C,
-    CGBL_INSTRUCTION_BIT_5_HLI = 0x6E,
-    CGBL_INSTRUCTION_BIT_5_L = 0x6D,
-    CGBL_INSTRUCTION_BIT_6_A = 0x77,
-    CGBL_INSTRUCTION_BIT_6_B = 0x70,
-    CGBL_INSTRUCTION_BIT_6_C = 0x71,
-    CGBL_INSTRUCTION_BIT_6_D = 0x72,
-    CGBL_INSTRUCTION_BIT_6_E = 0x73,
-    CGBL_INSTRUCTION_BIT_6_H = 0x74,
-    CGBL_INSTRUCTION_BIT_6_HLI = 0x76,
-    CGBL_INSTRUCTION_BIT_6_L = 0x75,
-    CGBL_INSTRUCTION_BIT_7_A = 0x7F,
-    CGBL_INSTRUCTION_BIT_7_B = 0x78,
-    CGBL_INSTRUCTION_BIT_7_C = 0x79,
-    CGBL_INSTRUCTION_BIT_7_D = 0x7A,
-    CGBL_INSTRUCTION_BIT_7_E = 0x7B,
-    CGBL_INSTRUCTION_BIT_7_H = 0x7C,
-    CGBL_INSTRUCTION_BIT_7_HLI = 0x7E,
-    CGBL_INSTRUCTION_BIT_7_L = 0x7D,
-    CGBL_INSTRUCTION_CALL = 0xCD,
-    CGBL_INSTRUCTION_CALL_C = 0xDC,
-    CGBL_INSTRUCTION_CALL_NC = 0xD4,
-    CGBL_INSTRUCTION_CALL_NZ = 0xC4,
-    CGBL_INSTRUCTION_CALL_Z = 0xCC,
-    CGBL_INSTRUCTION_CP_A = 0xBF,
-    CGBL_INSTRUCTION_CP_B = 0xB8,
-    CGBL_INSTRUCTION_CP_C = 0xB9,
-    CGBL_INSTRUCTION_CP_D = 0xBA,
-    CGBL_INSTRUCTION_CP_E = 0xBB,
-    CGBL_INSTRUCTION_CP_H = 0xBC,
-    CGBL_INSTRUCTION_CP_HLI = 0xBE,
-    CGBL_INSTRUCTION_CP_L = 0xBD,
-    CGBL_INSTRUCTION_CP_N = 0xFE,
-    CGBL_INSTRUCTION_DEC_A = 0x3D,
-    CGBL_INSTRUCTION_DEC_B = 0x05,
-    CGBL_INSTRUCTION_DEC_BC = 0x0B,
-    CGBL_INSTRUCTION_DEC_C = 0x0D,
-    CGBL_INSTRUCTION_DEC_D = 0x15,
-    CGBL_INSTRUCTION_DEC_DE = 0x1B,
-    CGBL_INSTRUCTION_DEC_E = 0x1D,
-    CGBL_INSTRUCTION_DEC_H = 0x25,
-    CGBL_INSTRUCTION_DEC_HL = 0x2B,
-    CGBL_INSTRUCTION_DEC_HLI = 0x35,
-    CGBL_INSTRUCTION_DEC_L = 0x2D,
-    CGBL_INSTRUCTION_DEC_SP = 0x3B,
-    CGBL_INSTRUCTION_INC_A = 0x3C,
-    CGBL_INSTRUCTION_INC_B = 0x04,
-    CGBL_INSTRUCTION_INC_BC = 0x03,
-    CGBL_INSTRUCTION_INC_C = 0x0C,
-    CGBL_INSTRUCTION_INC_D = 0x14,
-    CGBL_INSTRUCTION_INC_DE = 0x13,
-    CGBL_INSTRUCTION_INC_E = 0x1C,
-    CGBL_INSTRUCTION_INC_H = 0x24,
-    CGBL_INSTRUCTION_INC_HL = 0x23,
-    CGBL_INSTRUCTION_INC_HLI = 0x34,
-    CGBL_INSTRUCTION_INC_L = 0x2C,
-    CGBL_INSTRUCTION_INC_SP = 0x33,
-    CGBL_INSTRUCTION_JP = 0xC3,
-    CGBL_INSTRUCTION_JP_C = 0xDA,
-    CGBL_INSTRUCTION_JP_NC = 0xD2,
-    CGBL_INSTRUCTION_JP_NZ = 0xC2,
-    CGBL_INSTRUCTION_JP_Z = 0xCA,
-    CGBL_INSTRUCTION_JR = 0x18,
-    CGBL_INSTRUCTION_JR_C = 0x38,
-    CGBL_INSTRUCTION_JR_NC = 0x30,
-    CGBL_INSTRUCTION_JR_NZ = 0x20,
-    CGBL_INSTRUCTION_JR_Z = 0x28,
-    CGBL_INSTRUCTION_LD_A_A = 0x7F,
-    CGBL_INSTRUCTION_LD_A_B = 0x78,
-    CGBL_INSTRUCTION_LD_A_BCI = 0x0A,
-    CGBL_INSTRUCTION_LD_A_C = 0x79,
-    CGBL_INSTRUCTION_LD_A_D = 0x7A,
-    CGBL_INSTRUCTION_LD_A_DEI = 0x1A,
-    CGBL_INSTRUCTION_LD_A_E = 0x7B,
-    CGBL_INSTRUCTION_LD_A_H = 0x7C,
-    CGBL_INSTRUCTION_LD_A_HLI = 0x7E,
-    CGBL_INSTRUCTION_LD_A_HLID = 0x3A,
-    CGBL_INSTRUCTION_LD_A_HLII = 0x2A,
-    CGBL_INSTRUCTION_LD_A_L = 0x7D,
-    CGBL_INSTRUCTION_LD_A_N = 0x3E,
-    CGBL_INSTRUCTION_LD_A_NNI = 0xFA,
-    CGBL_INSTRUCTION_LD_A_FF00_CI = 0xF2,
-    CGBL_INSTRUCTION_LD_A_FF00_NI = 0xF0,
-    CGBL_INSTRUCTION_LD_B_A = 0x47,
-    CGBL_INSTRUCTION_LD_B_B = 0x40,
-    CGBL_INSTRUCTION_LD_B_C = 0x41,
-    CGBL_INSTRUCTION_LD_B_D = 0x42,
-    CGBL_INSTRUCTION_LD_B_E = 0x43,
-    CGBL_INSTRUCTION_LD_B_H = 0x44,
-    CGBL_INSTRUCTION_LD_B_HLI = 0x46,
-    CGBL_INSTRUCTION_LD_B_L = 0x45,
-    CGBL_INSTRUCTION_LD_B_N = 0x06,
-    CGBL_INSTRUCTION_LD_BC_NN = 0x01,
-    CGBL_INSTRUCTION_LD_BCI_A = 0x02,
-    CGBL_INSTRUCTION_LD_C_A = 0x4F,
-    CGBL_INSTRUCTION_LD_C_B = 0x48,
-    CGBL_INSTRUCTION_LD_C_C = 0x49,
-    CGBL_INSTRUCTION_LD_C_D = 0x4A,
-    CGBL_INSTRUCTION_LD_C_E = 0x4B,
-    CGBL_INSTRUCTION_LD_C_H = 0x4C,
-    CGBL_INSTRUCTION_LD_C_HLI = 0x4E,
-    CGBL_INSTRUCTION_LD_C_L = 0x4D,
-    CGBL_INSTRUCTION_LD_C_N = 0x0E,
-    CGBL_INSTRUCTION_LD_D_A = 0x57,
-    CGBL_INSTRUCTION_LD_D_B = 0x50,
-    CGBL_INSTRUCTION_LD_D_C = 0x51,
-    CGBL_INSTRUCTION_LD_D_D = 0x52,
-    CGBL_INSTRUCTION_LD_D_E = 0x53,
-    CGBL_INSTRUCTION_LD_D_H = 0x54,
-    CGBL_INSTRUCTION_LD_D_HLI = 0x56,
-    CGBL_INSTRUCTION_LD_D_L = 0x55,
-    CGBL_INSTRUCTION_LD_D_N = 0x16,
-    CGBL_INSTRUCTION_LD_DE_NN = 0x11,
-    CGBL_INSTRUCTION_LD_DEI_A = 0x12,
-    CGBL_INSTRUCTION_LD_E_A = 0x5F,
-    CGBL_INSTRUCTION_LD_E_B = 0x58,
-    CGBL_INSTRUCTION_LD_E_C = 0x59,
-    CGBL_INSTRUCTION_LD_E_D = 0x5A,
-    CGBL_INSTRUCTION_LD_E_E = 0x5B,
-    CGBL_INSTRUCTION_LD_E_H = 0x5C,
-    CGBL_INSTRUCTION_LD_E_HLI = 0x5E,
-    CGBL_INSTRUCTION_LD_E_L = 0x5D,
-    CGBL_INSTRUCTION_LD_E_N = 0x1E,
-    CGBL_INSTRUCTION_LD_FF00_CI_A = 0xE2,
-    CGBL_INSTRUCTION_LD_FF00_NI_A = 0xE0,
-    CGBL_INSTRUCTION_LD_H_A = 0x67,
-    CGBL_INSTRUCTION_LD_H_B = 0x60,
-    CGBL_INSTRUCTION_LD_H_C = 0x61,
-    CGBL_INSTRUCTION_LD_H_D = 0x62,
-    CGBL_INSTRUCTION_LD_H_E = 0x63,
-    CGBL_INSTRUCTION_LD_H_H = 0x64,
-    CGBL_INSTRUCTION_LD_H_HLI = 0x66,
-    CGBL_INSTRUCTION_LD_H_L = 0x65,
-    CGBL_INSTRUCTION_LD_H_N = 0x26,
-    CGBL_INSTRUCTION_LD_HL_NN = 0x21,
-    CGBL_INSTRUCTION_LD_HLI_A = 0x77,
-    CGBL_INSTRUCTION_LD_HLI_B = 0x70,
-    CGBL_INSTRUCTION_LD_HLI_C = 0x71,
-    CGBL_INSTRUCTION_LD_HLI_D = 0x72,
-    CGBL_INSTRUCTION_LD_HLI_E = 0x73,
-    CGBL_INSTRUCTION_LD_HLI_H = 0x74,
-    CGBL_INSTRUCTION_LD_HLI_L = 0x75,
-    CGBL_INSTRUCTION_LD_HLI_N = 0x36,
-    CGBL_INSTRUCTION_LD_HLID_A = 0x32,
-    CGBL_INSTRUCTION_LD_HLII_A = 0x22,
-    CGBL_INSTRUCTION_LD_L_A = 0x6F,
-    CGBL_INSTRUCTION_LD_L_B = 0x68,
-    CGBL_INSTRUCTION_LD_L_C = 0x69,
-    CGBL_INSTRUCTION_LD_L_D = 0x6A,
-    CGBL_INSTRUCTION_LD_L_E = 0x6B,
-    CGBL_INSTRUCTION_LD_L_H = 0x6C,
-    CGBL_INSTRUCTION_LD_L_HLI = 0x6E,
-    CGBL_INSTRUCTION_LD_L_L = 0x6D,
-    CGBL_INSTRUCTION_LD_L_N = 0x2E,
-    CGBL_INSTRUCTION_LD_NNI_A = 0xEA,
-    CGBL_INSTRUCTION_LD_NNI_SP = 0x08,
-    CGBL_INSTRUCTION_LD_SP_HL = 0xF9,
-    CGBL_INSTRUCTION_LD_SP_NN = 0x31,
-    CGBL_INSTRUCTION_OR_A = 0xB7,
-    CGBL_INSTRUCTION_OR_B = 0xB0,
-    CGBL_INSTRUCTION_OR_C = 0xB1,
-    CGBL_INSTRUCTION_OR_D = 0xB2,
-    CGBL_INSTRUCTION_OR_E = 0xB3,
-    CGBL_INSTRUCTION_OR_H = 0xB4,
-    CGBL_INSTRUCTION_OR_HLI = 0xB6,
-    CGBL_INSTRUCTION_OR_L = 0xB5,
-    CGBL_INSTRUCTION_OR_N = 0xF6,
-    CGBL_INSTRUCTION_POP_AF = 0xF1,
-    CGBL_INSTRUCTION_POP_BC = 0xC1,
-    CGBL_INSTRUCTION_POP_DE = 0xD1,
-    CGBL_INSTRUCTION_POP_HL = 0xE1,
-    CGBL_INSTRUCTION_PUSH_AF = 0xF5,
-    CGBL_INSTRUCTION_PUSH_BC = 0xC5,
-    CGBL_INSTRUCTION_PUSH_DE = 0xD5,
-    CGBL_INSTRUCTION_PUSH_HL = 0xE5,
-    CGBL_INSTRUCTION_RES_0_A = 0x87,
-    CGBL_INSTRUCTION_RES_0_B = 0x80,
-    CGBL_INSTRUCTION_RES_0_C = 0x81,
-    CGBL_INSTRUCTION_RES_0_D = 0x82,
-    CGBL_INSTRUCTION_RES_0_E = 0x83,
-    CGBL_INSTRUCTION_RES_0_H = 0x84,
-    CGBL_INSTRUCTION_RES_0_HLI = 0x86,
-    CGBL_INSTRUCTION_RES_0_L = 0x85,
-    CGBL_INSTRUCTION_RES_1_A = 0x8F,
-    CGBL_INSTRUCTION_RES_1_B = 0x88,
-    CGBL_INSTRUCTION_RES_1_C = 0x89,
-    CGBL_INSTRUCTION_RES_1_D = 0x8A,
-    CGBL_INSTRUCTION_RES_1_E = 0x8B,
-    CGBL_INSTRUCTION_RES_1_H = 0x8C,
-    CGBL_INSTRUCTION_RES_1_HLI = 0x8E,
-    CGBL_INSTRUCTION_RES_1_L = 0x8D,
-    CGBL_INSTRUCTION_RES_2_A = 0x97,
-    CGBL_INSTRUCTION_RES_2_B = 0x90,
-    CGBL_INSTRUCTION_RES_2_C = 0x91,
-    CGBL_INSTRUCTION_RES_2_D = 0x92,
-    CGBL_INSTRUCTION_RES_2_E = 0x93,
-    CGBL_INSTRUCTION_RES_2_H = 0x94,
-    CGBL_INSTRUCTION_RES_2_HLI = 0x96,
-    CGBL_INSTRUCTION_RES_2_L = 0x95,
-    CGBL_INSTRUCTION_RES_3_A = 0x9F,
-    CGBL_INSTRUCTION_RES_3_B = 0x98,
-    CGBL_INSTRUCTION_RES_3_C = 0x99,
-    CGBL_INSTRUCTION_RES_3_D = 0x9A,
-    CGBL_INSTRUCTION_RES_3_E = 0x9B,
-    CGBL_INSTRUCTION_RES_3_H = 0x9C,
-    CGBL_INSTRUCTION_RES_3_HLI = 0x9E,
-    CGBL_INSTRUCTION_RES_3_L = 0x9D,
-    CGBL_INSTRUCTION_RES_4_A = 0xA7,
-    CGBL_INSTRUCTION_RES_4_B = 0xA0,
-    CGBL_INSTRUCTION_RES_4_C = 0xA1,
-    CGBL_INSTRUCTION_RES_4_D = 0xA2,
-    CGBL_INSTRUCTION_RES_4_E = 0xA3,
-    CGBL_INSTRUCTION_RES_4_H = 0xA4,
-    CGBL_INSTRUCTION_RES_4_HLI = 0xA6,
-    CGBL_INSTRUCTION_RES_4_L = 0xA5,
-    CGBL_INSTRUCTION_RES_5_A = 0xAF,
-    CGBL_INSTRUCTION_RES_5_B = 0xA8,
-    CGBL_INSTRUCTION_RES_5_C = 0xA9,
-    CGBL_INSTRUCTION_RES_5_D = 0xAA,
-    CGBL_INSTRUCTION_RES_5_E = 0xAB,
-    CGBL_INSTRUCTION_RES_5_H = 0xAC,
-    CGBL_INSTRUCTION_RES_5_HLI = 0xAE,
-    CGBL_INSTRUCTION_RES_5_L = 0xAD,
-    CGBL_INSTRUCTION_RES_6_A = 0xB7,
-    CGBL_INSTRUCTION_RES_6_B = 0xB0,
-    CGBL_INSTRUCTION_RES_6_C = 0xB1,
-    CGBL_INSTRUCTION_RES_6_D = 0xB2,
-    CGBL_INSTRUCTION_RES_6_E = 0xB3,
-    CGBL_INSTRUCTION_RES_6_H = 0xB4,
-    CGBL_INSTRUCTION_RES_6_HLI = 0xB6,
-    CGBL_INSTRUCTION_RES_6_L = 0xB5,
-    CGBL_INSTRUCTION_RES_7_A = 0xBF,
-    CGBL_INSTRUCTION_RES_7_B = 0xB8,
-    CGBL_INSTRUCTION_RES_7_C = 0xB9,
-    CGBL_INSTRUCTION_RES_7_D = 0xBA,
-    CGBL_INSTRUCTION_RES_7_E = 0xBB,
-    CGBL_INSTRUCTION_RES_7_H = 0xBC,
-    CGBL_INSTRUCTION_RES_7_HLI = 0xBE,
-    CGBL_INSTRUCTION_RES_7_L = 0xBD,
-    CGBL_INSTRUCTION_RL_A = 0x17,
-    CGBL_INSTRUCTION_RL_B = 0x10,
-    CGBL_INSTRUCTION_RL_C = 0x11,
-    CGBL_INSTRUCTION_RL_D = 0x12,
-    CGBL_INSTRUCTION_RL_E = 0x13,
-    CGBL_INSTRUCTION_RL_H = 0x14,
-    CGBL_INSTRUCTION_RL_HLI = 0x16,
-    CGBL_INSTRUCTION_RL_L = 0x15,
-    CGBL_INSTRUCTION_RLC_A = 0x07,
-    CGBL_INSTRUCTION_RLC_B = 0x00,
-    CGBL_INSTRUCTION_RLC_C = 0x01,
-    CGBL_INSTRUCTION_RLC_D = 0x02,
-    CGBL_INSTRUCTION_RLC_E = 0x03,
-    CGBL_INSTRUCTION_RLC_H = 0x04,
-    CGBL_INSTRUCTION_RLC_HLI = 0x06,
-    CGBL_INSTRUCTION_RLC_L = 0x05,
-    CGBL_INSTRUCTION_RR_A = 0x1F,
-    CGBL_INSTRUCTION_RR_B = 0x18,
-    CGBL_INSTRUCTION_RR_C = 0x19,
-    CGBL_INSTRUCTION_RR_D = 0x1A,
-    CGBL_INSTRUCTION_RR_E = 0x1B,
-    CGBL_INSTRUCTION_RR_H = 0x1C,
-    CGBL_INSTRUCTION_RR_HLI = 0x1E,
-    CGBL_INSTRUCTION_RR_L = 0x1D,
-    CGBL_INSTRUCTION_RRC_A = 0x0F,
-    CGBL_INSTRUCTION_RRC_B = 0x08,
-    CGBL_INSTRUCTION_RRC_C = 0x09,
-    CGBL_INSTRUCTION_RRC_D = 0x0A,
-    CGBL_INSTRUCTION_RRC_E = 0x0B,
-    CGBL_INSTRUCTION_RRC_H = 0x0C,
-    CGBL_INSTRUCTION_RRC_HLI = 0x0E,
-    CGBL_INSTRUCTION_RRC_L = 0x0D,
-    CGBL_INSTRUCTION_RET = 0xC9,
-    CGBL_INSTRUCTION_RET_C = 0xD8,
-    CGBL_INSTRUCTION_RET_NC = 0xD0,
-    CGBL_INSTRUCTION_RET_NZ = 0xC0,
-    CGBL_INSTRUCTION_RET_Z = 0xC8,
-    CGBL_INSTRUCTION_RST_00 = 0xC7,
-    CGBL_INSTRUCTION_SBC_A = 0x9F,
-    CGBL_INSTRUCTION_SBC_B = 0x98,
-    CGBL_INSTRUCTION_SBC_C = 0x99,
-    CGBL_INSTRUCTION_SBC_D = 0x9A,
-    CGBL_INSTRUCTION_SBC_E = 0x9B,
-    CGBL_INSTRUCTION_SBC_H = 0x9C,
-    CGBL_INSTRUCTION_SBC_HLI = 0x9E,
-    CGBL_INSTRUCTION_SBC_L = 0x9D,
-    CGBL_INSTRUCTION_SBC_N = 0xDE,
-    CGBL_INSTRUCTION_SET_0_A = 0xC7,
-    CGBL_INSTRUCTION_SET_0_B = 0xC0,
-    CGBL_INSTRUCTION_SET_0_C = 0xC1,
-    CGBL_INSTRUCTION_SET_0_D = 0xC2,
-    CGBL_INSTRUCTION_SET_0_E = 0xC3,
-    CGBL_INSTRUCTION_SET_0_H = 0xC4,
-    CGBL_INSTRUCTION_SET_0_HLI = 0xC6,
-    CGBL_INSTRUCTION_SET_0_L = 0xC5,
-    CGBL_INSTRUCTION_SET_1_A = 0xCF,
-    CGBL_INSTRUCTION_SET_1_B = 0xC8,
-    CGBL_INSTRUCTION_SET_1_C = 0xC9,
-    CGBL_INSTRUCTION_SET_1_D = 0xCA,
-    CGBL_INSTRUCTION_SET_1_E = 0xCB,
-    CGBL_INSTRUCTION_SET_1_H = 0xCC,
-    CGBL_INSTRUCTION_SET_1_HLI = 0xCE,
-    CGBL_INSTRUCTION_SET_1_L = 0xCD,
-    CGBL_INSTRUCTION_SET_2_A = 0xD7,
-    CGBL_INSTRUCTION_SET_2_B = 0xD0,
-    CGBL_INSTRUCTION_SET_2_C = 0xD1,
-    CGBL_INSTRUCTION_SET_2_D = 0xD2,
-    CGBL_INSTRUCTION_SET_2_E = 0xD3,
-    CGBL_INSTRUCTION_SET_2_H = 0xD4,
-    CGBL_INSTRUCTION_SET_2_HLI = 0xD6,
-    CGBL_INSTRUCTION_SET_2_L = 0xD5,
-    CGBL_INSTRUCTION_SET_3_A = 0xDF,
-    CGBL_INSTRUCTION_SET_3_B = 0xD8,
-    CGBL_INSTRUCTION_SET_3_C = 0xD9,
-    CGBL_INSTRUCTION_SET_3_D = 0xDA,
-    CGBL_INSTRUCTION_SET_3_E = 0xDB,
-    CGBL_INSTRUCTION_SET_3_H = 0xDC,
-    CGBL_INSTRUCTION_SET_3_HLI = 0xDE,
-    CGBL_INSTRUCTION_SET_3_L = 0xDD,
-    CGBL_INSTRUCTION_SET_4_A = 0xE7,
-    CGBL_INSTRUCTION_SET_4_B = 0xE0,
-    CGBL_INSTRUCTION_SET_4_C = 0xE1,
-    CGBL_INSTRUCTION_SET_4_D = 0xE2,
-    CGBL_INSTRUCTION_SET_4_E = 0xE3,
-    CGBL_INSTRUCTION_SET_4_H = 0xE4,
-    CGBL_INSTRUCTION_SET_4_HLI = 0xE6,
-    CGBL_INSTRUCTION_SET_4_L = 0xE5,
-    CGBL_INSTRUCTION_SET_5_A = 0xEF,
-    CGBL_INSTRUCTION_SET_5_B = 0xE8,
-    CGBL_INSTRUCTION_SET_5_C = 0xE9,
-    CGBL_INSTRUCTION_SET_5_D = 0xEA,
-    CGBL_INSTRUCTION_SET_5_E = 0xEB,
-    CGBL_INSTRUCTION_SET_5_H = 0xEC,
-    CGBL_INSTRUCTION_SET_5_HLI = 0xEE,
-    CGBL_INSTRUCTION_SET_5_L = 0xED,
-    CGBL_INSTRUCTION_SET_6_A = 0xF7,
-    CGBL_INSTRUCTION_SET_6_B = 0xF0,
-    CGBL_INSTRUCTION_SET_6_C = 0xF1,
-    CGBL_INSTRUCTION_SET_6_D = 0xF2,
-    CGBL_INSTRUCTION_SET_6_E = 0xF3,
-    CGBL_INSTRUCTION_SET_6_H = 0xF4,
-    CGBL_INSTRUCTION_SET_6_HLI = 0xF6,
-    CGBL_INSTRUCTION_SET_6_L = 0xF5,
-    CGBL_INSTRUCTION_SET_7_A = 0xFF,
-    CGBL_INSTRUCTION_SET_7_B = 0xF8,
-    CGBL_INSTRUCTION_SET_7_C = 0xF9,
-    CGBL_INSTRUCTION_SET_7_D = 0xFA,
-    CGBL_INSTRUCTION_SET_7_E = 0xFB,
-    CGBL_INSTRUCTION_SET_7_H = 0xFC,
-    CGBL_INSTRUCTION_SET_7_HLI = 0xFE,
-    CGBL_INSTRUCTION_SET_7_L = 0xFD,
-    CGBL_INSTRUCTION_SLA_A = 0x27,
-    CGBL_INSTRUCTION_SLA_B = 0x20,
-    CGBL_INSTRUCTION_SLA_C = 0x21,
-    CGBL_INSTRUCTION_SLA_D = 0x22,
-    CGBL_INSTRUCTION_SLA_E = 0x23,
-    CGBL_INSTRUCTION_SLA_H = 0x24,
-    CGBL_INSTRUCTION_SLA_HLI = 0x26,
-    CGBL_INSTRUCTION_SLA_L = 0x25,
-    CGBL_INSTRUCTION_SRA_A = 0x2F,
-    CGBL_INSTRUCTION_SRA_B = 0x28,
-    CGBL_INSTRUCTION_SRA_C = 0x29,
-    CGBL_INSTRUCTION_SRA_D = 0x2A,
-    CGBL_INSTRUCTION_SRA_E = 0x2B,
-    CGBL_INSTRUCTION_SRA_H = 0x2C,
-    CGBL_INSTRUCTION_SRA_HLI = 0x2E,
-    CGBL_INSTRUCTION_SRA_L = 0x2D,
-    CGBL_INSTRUCTION_SRL_A = 0x3F,
-    CGBL_INSTRUCTION_SRL_B = 0x38,
-    CGBL_INSTRUCTION_SRL_C = 0x39,
-    CGBL_INSTRUCTION_SRL_D = 0x3A,
-    CGBL_INSTRUCTION_SRL_E = 0x3B,
-    CGBL_INSTRUCTION_SRL_H = 0x3C,
-    CGBL_INSTRUCTION_SRL_HLI = 0x3E,
-    CGBL_INSTRUCTION_SRL_L = 0x3D,
-    CGBL_INSTRUCTION_SUB_A = 0x97,
-    CGBL_INSTRUCTION_SUB_B = 0x90,
-    CGBL_INSTRUCTION_SUB_C = 0x91,
-    CGBL_INSTRUCTION_SUB_D = 0x92,
-    CGBL_INSTRUCTION_SUB_E = 0x93,
-    CGBL_INSTRUCTION_SUB_H = 0x94,
-    CGBL_INSTRUCTION_SUB_HLI = 0x96,
-    CGBL_INSTRUCTION_SUB_L = 0x95,
-    CGBL_INSTRUCTION_SUB_N = 0xD6,
-    CGBL_INSTRUCTION_SWAP_A = 0x37,
-    CGBL_INSTRUCTION_SWAP_B = 0x30,
-    CGBL_INSTRUCTION_SWAP_C = 0x31,
-    CGBL_INSTRUCTION_SWAP_D = 0x32,
-    CGBL_INSTRUCTION_SWAP_E = 0x33,
-    CGBL_INSTRUCTION_SWAP_H = 0x34,
-    CGBL_INSTRUCTION_SWAP_HLI = 0x36,
-    CGBL_INSTRUCTION_SWAP_L = 0x35,
-    CGBL_INSTRUCTION_XOR_A = 0xAF,
-    CGBL_INSTRUCTION_XOR_B = 0xA8,
-    CGBL_INSTRUCTION_XOR_C = 0xA9,
-    CGBL_INSTRUCTION_XOR_D = 0xAA,
-    CGBL_INSTRUCTION_XOR_E = 0xAB,
-    CGBL_INSTRUCTION_XOR_H = 0xAC,
-    CGBL_INSTRUCTION_XOR_HLI = 0xAE,
-    CGBL_INSTRUCTION_XOR_L = 0xAD,
-    CGBL_INSTRUCTION_XOR_N = 0xEE,
     CGBL_INSTRUCTION_PREFIX = 0xCB,
     CGBL_INSTRUCTION_MAX = 256
 } cgbl_instruction_e;
@@ -501,6 +562,13 @@ typedef enum {
     CGBL_INTERRUPT_MAX
 } cgbl_interrupt_e;
 
+typedef enum {
+    CGBL_OPERAND_NONE = 0,
+    CGBL_OPERAND_BYTE,
+    CGBL_OPERAND_WORD,
+    CGBL_OPERAND_MAX
+} cgbl_operand_e;
+
 typedef enum {
     CGBL_REGISTER_A = 0,
     CGBL_REGISTER_AF,
@@ -536,15 +604,96 @@ typedef union {
     };
 } cgbl_register_t;
 
-bool cgbl_processor_halted(void);
-void cgbl_processor_interrupt(cgbl_interrupt_e interrupt);
-cgbl_error_e cgbl_processor_register_read(cgbl_register_e reg, cgbl_register_t *const data);
-cgbl_error_e cgbl_processor_register_write(cgbl_register_e reg, const cgbl_register_t *const data);
-uint8_t cgbl_processor_read(uint16_t address);
-void cgbl_processor_reset(void);
-cgbl_error_e cgbl_processor_step(void);
-cgbl_error_e cgbl_processor_step_breakpoint(uint16_t breakpoint);
-bool cgbl_processor_stopped(void);
-void cgbl_processor_write(uint16_t address, uint8_t data);
+typedef union {
+    uint8_t raw;
+    struct {
+        uint8_t : 4;
+        uint8_t input : 1;
+    };
+} cgbl_interrupt_t;
+
+typedef struct {
+    cgbl_error_e (*handler)(cgbl_context_t *const context);
+    uint8_t opcode;
+    uint8_t offset;
+    uint8_t length;
+    uint8_t data[3];
+} cgbl_decode_t;
+
+typedef struct {
+    cgbl_error_e (*handler)(cgbl_context_t *const context);
+    uint8_t length;
+    uint8_t opcode[CGBL_PROCESSOR_FUSION_LENGTH];
+} cgbl_fusion_t;
+
+typedef struct {
+    uint16_t address;
+    uint16_t bank;
+    uint32_t generation;
+    uint8_t count;
+    cgbl_decode_t decode[CGBL_PROCESSOR_BLOCK_LENGTH];
+} cgbl_block_t;
+
+typedef struct {
+    bool fuse;
+    bool halt_bug;
+    bool halted;
+    bool stopped;
+    uint32_t delay;
+    cgbl_register_t af;
+    cgbl_register_t bc;
+    cgbl_register_t de;
+    cgbl_register_t hl;
+    cgbl_register_t pc;
+    cgbl_register_t sp;
+    struct {
+        bool negative;
+        uint8_t result;
+        uint16_t carry;
+    } flag;
+    struct {
+        uint16_t address;
+        cgbl_instruction_e opcode;
+        uint8_t index;
+        uint8_t data[2];
+    } instruction;
+    struct {
+        uint8_t index;
+        cgbl_block_t *current;
+        cgbl_block_t *entry;
+    } block;
+    struct {
+        bool enabled;
+        uint8_t delay;
+        cgbl_interrupt_t enable;
+        cgbl_interrupt_t flag;
+    } interrupt;
+    struct {
+        bool valid;
+        uint16_t address;
+        uint64_t cycle;
+        bool enabled;
+        bool halt_bug;
+        uint8_t delay;
+        cgbl_register_t af;
+        cgbl_register_t bc;
+        cgbl_register_t de;
+        cgbl_register_t hl;
+        cgbl_register_t sp;
+    } loop;
+} cgbl_processor_t;
+
+bool cgbl_processor_breakpoint(cgbl_context_t *const context, uint16_t breakpoint);
+void cgbl_processor_destroy(cgbl_context_t *const context);
+bool cgbl_processor_halted(cgbl_context_t *const context);
+void cgbl_processor_interrupt(cgbl_context_t *const context, cgbl_interrupt_e interrupt);
+cgbl_error_e cgbl_processor_register_read(cgbl_context_t *const context, cgbl_register_e reg, cgbl_register_t *const data);
+cgbl_error_e cgbl_processor_register_write(cgbl_context_t *const context, cgbl_register_e reg, const cgbl_register_t *const data);
+uint8_t cgbl_processor_read(cgbl_context_t *const context, uint16_t address);
+void cgbl_processor_reset(cgbl_context_t *const context);
+cgbl_error_e cgbl_processor_step(cgbl_context_t *const context, uint32_t cycles);
+cgbl_error_e cgbl_processor_step_breakpoint(cgbl_context_t *const context, uint16_t breakpoint);
+bool cgbl_processor_stopped(cgbl_context_t *const context);
+void cgbl_processor_write(cgbl_context_t *const context, uint16_t address, uint8_t data);
 
 #endif /* CGBL_PROCESSOR_H_ */
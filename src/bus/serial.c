@@ -4,32 +4,23 @@
  */
 
 #include "serial.h"
+#include "context.h"
 #include "processor.h"
 #include <string.h>
 
-static struct {
-    bool overflow;
-    uint8_t data;
-    uint16_t divider;
-    union {
-        uint8_t raw;
-        struct {
-            uint8_t select : 1;
-            uint8_t speed : 1;
-            uint8_t : 5;
-            uint8_t enabled : 1;
-        };
-    } control;
-} serial = {};
+const uint8_t *cgbl_serial_output(cgbl_context_t *const context, uint32_t *const length) {
+    *length = context->serial.output.length;
+    return context->serial.output.data;
+}
 
-uint8_t cgbl_serial_read(uint16_t address) {
+uint8_t cgbl_serial_read(cgbl_context_t *const context, uint16_t address) {
     uint8_t result = 0xFF;
     switch (address) {
     case CGBL_SERIAL_CONTROL:
-        result = serial.control.raw;
+        result = context->serial.control.raw;
         break;
     case CGBL_SERIAL_DATA:
-        result = serial.data;
+        result = context->serial.data;
         break;
     default:
         break;
@@ -37,37 +28,40 @@ uint8_t cgbl_serial_read(uint16_t address) {
     return result;
 }
 
-void cgbl_serial_reset(void) {
-    memset(&serial, 0, sizeof(serial));
-    serial.control.raw = 0x7C;
+void cgbl_serial_reset(cgbl_context_t *const context) {
+    memset(&context->serial, 0, sizeof(context->serial));
+    context->serial.control.raw = 0x7C;
 }
 
-void cgbl_serial_step(void) {
-    for (uint8_t cycle = 0; cycle < ((cgbl_bus_speed() == CGBL_SPEED_DOUBLE) ? 2 : 1); ++cycle) {
-        if (serial.control.enabled && serial.control.select) {
-            bool overflow = ++serial.divider & (serial.control.speed ? 64 : 2048);
-            if (overflow && !serial.overflow) {
-                cgbl_processor_interrupt(CGBL_INTERRUPT_SERIAL);
-                serial.control.enabled = false;
-                serial.data = 0xFF;
-                serial.divider = 0;
-                serial.overflow = false;
-            } else {
-                serial.overflow = overflow;
+void cgbl_serial_step(cgbl_context_t *const context, uint32_t cycles) {
+    uint8_t speed = (cgbl_bus_speed(context) == CGBL_SPEED_DOUBLE) ? 2 : 1;
+    uint32_t event = UINT32_MAX;
+    if (context->serial.control.enabled && context->serial.control.select) {
+        uint32_t edge = cgbl_bus_edge(context->serial.divider, context->serial.control.speed ? 64 : 2048);
+        if ((cycles * speed) >= edge) {
+            cgbl_processor_interrupt(context, CGBL_INTERRUPT_SERIAL);
+            if (context->serial.output.length < CGBL_SERIAL_OUTPUT_LENGTH) {
+                context->serial.output.data[context->serial.output.length++] = context->serial.data;
             }
+            context->serial.control.enabled = false;
+            context->serial.data = 0xFF;
+            context->serial.divider = 0;
+        } else {
+            context->serial.divider += cycles * speed;
+            event = (edge - (cycles * speed) - 1) / speed;
         }
     }
+    cgbl_bus_schedule(context, CGBL_EVENT_SERIAL, event);
 }
 
-void cgbl_serial_write(uint16_t address, uint8_t data) {
+void cgbl_serial_write(cgbl_context_t *const context, uint16_t address, uint8_t data) {
     switch (address) {
     case CGBL_SERIAL_CONTROL:
-        serial.control.raw = data | 0x7C;
-        serial.divider = 0;
-        serial.overflow = false;
+        context->serial.control.raw = data | 0x7C;
+        context->serial.divider = 0;
         break;
     case CGBL_SERIAL_DATA:
-        serial.data = data;
+        context->serial.data = data;
         break;
     default:
         break;
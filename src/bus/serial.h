@@ -10,10 +10,30 @@
 
 #define CGBL_SERIAL_CONTROL 0xFF02
 #define CGBL_SERIAL_DATA 0xFF01
+#define CGBL_SERIAL_OUTPUT_LENGTH 4096
 
-uint8_t cgbl_serial_read(uint16_t address);
-void cgbl_serial_reset(void);
-void cgbl_serial_step(void);
-void cgbl_serial_write(uint16_t address, uint8_t data);
+typedef struct {
+    uint8_t data;
+    uint16_t divider;
+    struct {
+        uint32_t length;
+        uint8_t data[CGBL_SERIAL_OUTPUT_LENGTH];
+    } output;
+    union {
+        uint8_t raw;
+        struct {
+            uint8_t select : 1;
+            uint8_t speed : 1;
+            uint8_t : 5;
+            uint8_t enabled : 1;
+        };
+    } control;
+} cgbl_serial_t;
+
+const uint8_t *cgbl_serial_output(cgbl_context_t *const context, uint32_t *const length);
+uint8_t cgbl_serial_read(cgbl_context_t *const context, uint16_t address);
+void cgbl_serial_reset(cgbl_context_t *const context);
+void cgbl_serial_step(cgbl_context_t *const context, uint32_t cycles);
+void cgbl_serial_write(cgbl_context_t *const context, uint16_t address, uint8_t data);
 
 #endif /* CGBL_SERIAL_H_ */
@@ -5,42 +5,53 @@
 
 #include "timer.h"
 #include "audio.h"
+#include "context.h"
 #include "processor.h"
 #include <string.h>
 
 static const uint16_t OVERFLOW[] = { 512, 8, 32, 128 };
 
-static struct {
-    uint8_t counter;
-    uint16_t divider;
-    uint8_t modulo;
-    union {
-        uint8_t raw;
-        struct {
-            uint8_t mode : 2;
-            uint8_t enabled : 1;
-        };
-    } control;
-    struct {
-        bool audio;
-        bool timer;
-    } overflow;
-} timer = {};
+static uint32_t cgbl_timer_event(cgbl_context_t *const context, uint16_t audio, bool overflow) {
+    uint32_t result = 0;
+    if ((context->timer.overflow.audio == (bool)(context->timer.divider & audio)) &&
+        (!context->timer.control.enabled ||
+         (context->timer.overflow.timer == (bool)(context->timer.divider & OVERFLOW[context->timer.control.mode])))) {
+        result = cgbl_bus_edge(context->timer.divider, audio);
+        if (context->timer.control.enabled) {
+            uint32_t edge = cgbl_bus_edge(context->timer.divider, OVERFLOW[context->timer.control.mode]);
+            if (overflow) {
+                edge += (255 - context->timer.counter) * (OVERFLOW[context->timer.control.mode] << 1);
+            }
+            if (edge < result) {
+                result = edge;
+            }
+        }
+        --result;
+    }
+    return result;
+}
 
-uint8_t cgbl_timer_read(uint16_t address) {
+uint32_t cgbl_timer_divider_edge(cgbl_context_t *const context) {
+    if (cgbl_processor_stopped(context)) {
+        return UINT32_MAX;
+    }
+    return (255 - (context->timer.divider & 0xFF)) / ((cgbl_bus_speed(context) == CGBL_SPEED_DOUBLE) ? 2 : 1);
+}
+
+uint8_t cgbl_timer_read(cgbl_context_t *const context, uint16_t address) {
     uint8_t result = 0xFF;
     switch (address) {
     case CGBL_TIMER_CONTROL:
-        result = timer.control.raw;
+        result = context->timer.control.raw;
         break;
     case CGBL_TIMER_COUNTER:
-        result = timer.counter;
+        result = context->timer.counter;
         break;
     case CGBL_TIMER_DIVIDER:
-        result = timer.divider >> 8;
+        result = context->timer.divider >> 8;
         break;
     case CGBL_TIMER_MODULO:
-        result = timer.modulo;
+        result = context->timer.modulo;
         break;
     default:
         break;
@@ -48,46 +59,65 @@ uint8_t cgbl_timer_read(uint16_t address) {
     return result;
 }
 
-void cgbl_timer_reset(void) {
-    memset(&timer, 0, sizeof(timer));
-    timer.control.raw = 0xF8;
+void cgbl_timer_reset(cgbl_context_t *const context) {
+    memset(&context->timer, 0, sizeof(context->timer));
+    context->timer.control.raw = 0xF8;
 }
 
-void cgbl_timer_step(void) {
-    for (uint8_t cycle = 0; cycle < ((cgbl_bus_speed() == CGBL_SPEED_DOUBLE) ? 2 : 1); ++cycle) {
-        if (!cgbl_processor_stopped()) {
+void cgbl_timer_step(cgbl_context_t *const context, uint32_t cycles) {
+    uint16_t audio = (cgbl_bus_speed(context) == CGBL_SPEED_DOUBLE) ? 16384 : 8192;
+    uint8_t speed = (cgbl_bus_speed(context) == CGBL_SPEED_DOUBLE) ? 2 : 1;
+    uint32_t event = UINT32_MAX;
+    if (!cgbl_processor_stopped(context)) {
+        for (uint32_t cycle = cycles * speed; cycle; --cycle) {
             bool overflow = false;
-            ++timer.divider;
-            if (timer.control.enabled) {
-                overflow = timer.divider & OVERFLOW[timer.control.mode];
-                if (overflow && !timer.overflow.timer && !++timer.counter) {
-                    cgbl_processor_interrupt(CGBL_INTERRUPT_TIMER);
-                    timer.counter = timer.modulo;
+            uint32_t skip = cgbl_timer_event(context, audio, false);
+            if (skip) {
+                if (skip > cycle) {
+                    skip = cycle;
+                }
+                context->timer.divider += skip;
+                if (context->timer.control.enabled) {
+                    context->timer.overflow.timer = context->timer.divider & OVERFLOW[context->timer.control.mode];
+                }
+                context->timer.overflow.audio = context->timer.divider & audio;
+                if (!(cycle -= skip)) {
+                    break;
+                }
+            }
+            ++context->timer.divider;
+            if (context->timer.control.enabled) {
+                overflow = context->timer.divider & OVERFLOW[context->timer.control.mode];
+                if (overflow && !context->timer.overflow.timer && !++context->timer.counter) {
+                    cgbl_processor_interrupt(context, CGBL_INTERRUPT_TIMER);
+                    context->timer.counter = context->timer.modulo;
                 }
-                timer.overflow.timer = overflow;
+                context->timer.overflow.timer = overflow;
             }
-            overflow = timer.divider & ((cgbl_bus_speed() == CGBL_SPEED_DOUBLE) ? 16384 : 8192);
-            if (overflow && !timer.overflow.audio) {
-                cgbl_audio_interrupt();
+            overflow = context->timer.divider & audio;
+            if (overflow && !context->timer.overflow.audio) {
+                cgbl_audio_interrupt(context);
             }
-            timer.overflow.audio = overflow;
+            context->timer.overflow.audio = overflow;
         }
+        event = cgbl_timer_event(context, audio, true) / speed;
     }
+    cgbl_bus_schedule(context, CGBL_EVENT_TIMER, event);
 }
 
-void cgbl_timer_write(uint16_t address, uint8_t data) {
+void cgbl_timer_write(cgbl_context_t *const context, uint16_t address, uint8_t data) {
     switch (address) {
     case CGBL_TIMER_CONTROL:
-        timer.control.raw = data | 0xF8;
+        context->timer.control.raw = data | 0xF8;
         break;
     case CGBL_TIMER_COUNTER:
-        timer.counter = data;
+        context->timer.counter = data;
         break;
     case CGBL_TIMER_DIVIDER:
-        timer.divider = 0;
+        context->timer.divider = 0;
         break;
     case CGBL_TIMER_MODULO:
-        timer.modulo = data;
+        context->timer.modulo = data;
         break;
     default:
         break;
@@ -13,9 +13,27 @@
 #define CGBL_TIMER_DIVIDER 0xFF04
 #define CGBL_TIMER_MODULO 0xFF06
 
-uint8_t cgbl_timer_read(uint16_t address);
-void cgbl_timer_reset(void);
-void cgbl_timer_step(void);
-void cgbl_timer_write(uint16_t address, uint8_t data);
+typedef struct {
+    uint8_t counter;
+    uint16_t divider;
+    uint8_t modulo;
+    union {
+        uint8_t raw;
+        struct {
+            uint8_t mode : 2;
+            uint8_t enabled : 1;
+        };
+    } control;
+    struct {
+        bool audio;
+        bool timer;
+    } overflow;
+} cgbl_timer_t;
+
+uint32_t cgbl_timer_divider_edge(cgbl_context_t *const context);
+uint8_t cgbl_timer_read(cgbl_context_t *const context, uint16_t address);
+void cgbl_timer_reset(cgbl_context_t *const context);
+void cgbl_timer_step(cgbl_context_t *const context, uint32_t cycles);
+void cgbl_timer_write(cgbl_context_t *const context, uint16_t address, uint8_t data);
 
 #endif /* CGBL_TIMER_H_ */
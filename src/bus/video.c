@@ -5,17 +5,28 @@
 
 #include "video.h"
 #include "cartridge.h"
+#include "context.h"
 #include "processor.h"
-#include <stdlib.h>
+#include <stdatomic.h>
 #include <string.h>
+#include <threads.h>
+#if defined(__SSE4_1__)
+#include <immintrin.h>
+#endif
+
+#define CGBL_VIDEO_LINE_OFFSET 8
+#define CGBL_VIDEO_THREAD_BATCH 1024
+#define CGBL_VIDEO_THREAD_WIDTH 4096
 
 typedef enum {
-    CGBL_COLOR_WHITE = 0,
-    CGBL_COLOR_GREY_LIGHT,
-    CGBL_COLOR_GREY_DARK,
-    CGBL_COLOR_BLACK,
-    CGBL_COLOR_MAX
-} cgbl_color_e;
+    CGBL_COMMAND_CLEAR = 0,
+    CGBL_COMMAND_FRAME,
+    CGBL_COMMAND_LINE,
+    CGBL_COMMAND_OBJECT,
+    CGBL_COMMAND_PALETTE,
+    CGBL_COMMAND_RAM,
+    CGBL_COMMAND_MAX
+} cgbl_command_e;
 
 typedef enum {
     CGBL_STATE_HBLANK = 0,
@@ -127,6 +138,23 @@ static const struct {
     { 0x00, '\0', { 0x7FFF, 0x1BEF, 0x6180, 0x0000 }, { { 0x7FFF, 0x421F, 0x1CF2, 0x0000 }, { 0x7FFF, 0x421F, 0x1CF2, 0x0000 } } }
 };
 
+static const uint8_t REVERSE[] = { 0x00, 0x40, 0x80, 0xC0, 0x10, 0x50, 0x90, 0xD0, 0x20, 0x60, 0xA0, 0xE0, 0x30, 0x70, 0xB0, 0xF0, 0x04,
+                                   0x44, 0x84, 0xC4, 0x14, 0x54, 0x94, 0xD4, 0x24, 0x64, 0xA4, 0xE4, 0x34, 0x74, 0xB4, 0xF4, 0x08, 0x48,
+                                   0x88, 0xC8, 0x18, 0x58, 0x98, 0xD8, 0x28, 0x68, 0xA8, 0xE8, 0x38, 0x78, 0xB8, 0xF8, 0x0C, 0x4C, 0x8C,
+                                   0xCC, 0x1C, 0x5C, 0x9C, 0xDC, 0x2C, 0x6C, 0xAC, 0xEC, 0x3C, 0x7C, 0xBC, 0xFC, 0x01, 0x41, 0x81, 0xC1,
+                                   0x11, 0x51, 0x91, 0xD1, 0x21, 0x61, 0xA1, 0xE1, 0x31, 0x71, 0xB1, 0xF1, 0x05, 0x45, 0x85, 0xC5, 0x15,
+                                   0x55, 0x95, 0xD5, 0x25, 0x65, 0xA5, 0xE5, 0x35, 0x75, 0xB5, 0xF5, 0x09, 0x49, 0x89, 0xC9, 0x19, 0x59,
+                                   0x99, 0xD9, 0x29, 0x69, 0xA9, 0xE9, 0x39, 0x79, 0xB9, 0xF9, 0x0D, 0x4D, 0x8D, 0xCD, 0x1D, 0x5D, 0x9D,
+                                   0xDD, 0x2D, 0x6D, 0xAD, 0xED, 0x3D, 0x7D, 0xBD, 0xFD, 0x02, 0x42, 0x82, 0xC2, 0x12, 0x52, 0x92, 0xD2,
+                                   0x22, 0x62, 0xA2, 0xE2, 0x32, 0x72, 0xB2, 0xF2, 0x06, 0x46, 0x86, 0xC6, 0x16, 0x56, 0x96, 0xD6, 0x26,
+                                   0x66, 0xA6, 0xE6, 0x36, 0x76, 0xB6, 0xF6, 0x0A, 0x4A, 0x8A, 0xCA, 0x1A, 0x5A, 0x9A, 0xDA, 0x2A, 0x6A,
+                                   0xAA, 0xEA, 0x3A, 0x7A, 0xBA, 0xFA, 0x0E, 0x4E, 0x8E, 0xCE, 0x1E, 0x5E, 0x9E, 0xDE, 0x2E, 0x6E, 0xAE,
+                                   0xEE, 0x3E, 0x7E, 0xBE, 0xFE, 0x03, 0x43, 0x83, 0xC3, 0x13, 0x53, 0x93, 0xD3, 0x23, 0x63, 0xA3, 0xE3,
+                                   0x33, 0x73, 0xB3, 0xF3, 0x07, 0x47, 0x87, 0xC7, 0x17, 0x57, 0x97, 0xD7, 0x27, 0x67, 0xA7, 0xE7, 0x37,
+                                   0x77, 0xB7, 0xF7, 0x0B, 0x4B, 0x8B, 0xCB, 0x1B, 0x5B, 0x9B, 0xDB, 0x2B, 0x6B, 0xAB, 0xEB, 0x3B, 0x7B,
+                                   0xBB, 0xFB, 0x0F, 0x4F, 0x8F, 0xCF, 0x1F, 0x5F, 0x9F, 0xDF, 0x2F, 0x6F, 0xAF, 0xEF, 0x3F, 0x7F, 0xBF,
+                                   0xFF };
+
 typedef struct {
     uint8_t palette : 3;
     uint8_t bank : 1;
@@ -137,200 +165,264 @@ typedef struct {
 } cgbl_background_t;
 
 typedef struct {
-    uint8_t y;
-    uint8_t x;
-    uint8_t id;
-    struct {
-        uint8_t palette : 3;
-        uint8_t bank : 1;
-        uint8_t palette_dmg : 1;
-        uint8_t flip_x : 1;
-        uint8_t flip_y : 1;
-        uint8_t priority : 1;
-    } attribute;
-} cgbl_object_t;
-
-typedef struct {
-    uint8_t index;
-    const cgbl_object_t *object;
-} cgbl_object_entry_t;
-
-typedef union {
-    uint8_t raw;
-    struct {
-        uint8_t white : 2;
-        uint8_t grey_light : 2;
-        uint8_t grey_dark : 2;
-        uint8_t black : 2;
-    };
-} cgbl_palette_t;
-
-static struct {
-    bool shown;
-    struct {
-        union {
-            uint8_t raw;
-            struct {
-                uint8_t address : 6;
-                uint8_t : 1;
-                uint8_t increment : 1;
-            };
-        } control;
-        struct {
-            uint16_t cgb[8][CGBL_COLOR_MAX];
-            const uint16_t *dmg;
-            cgbl_palette_t palette;
-        } color;
-    } background;
+    cgbl_command_e type;
     union {
-        uint8_t raw;
-        struct {
-            uint8_t background_enabled : 1;
-            uint8_t object_enabled : 1;
-            uint8_t object_size : 1;
-            uint8_t background_map : 1;
-            uint8_t background_data : 1;
-            uint8_t window_enabled : 1;
-            uint8_t window_map : 1;
-            uint8_t enabled : 1;
-        };
-    } control;
-    struct {
-        uint8_t coincidence;
-        uint16_t x;
-        uint8_t y;
-    } line;
-    struct {
-        cgbl_object_t ram[CGBL_VIDEO_RAM_OBJECT_WIDTH];
-        union {
-            uint8_t raw;
-            struct {
-                uint8_t address : 6;
-                uint8_t : 1;
-                uint8_t increment : 1;
-            };
-        } control;
         struct {
-            uint16_t cgb[8][CGBL_COLOR_MAX];
-            const uint16_t *dmg[2];
-            cgbl_palette_t palette[2];
-        } color;
-        struct {
-            uint8_t count;
-            cgbl_object_entry_t entry[10];
-        } shown;
-    } object;
-    struct {
-        bool priority[CGBL_VIDEO_HEIGHT][CGBL_VIDEO_WIDTH];
-        uint16_t data[CGBL_VIDEO_HEIGHT][CGBL_VIDEO_WIDTH];
-        cgbl_color_e color[CGBL_VIDEO_HEIGHT][CGBL_VIDEO_WIDTH];
-    } pixel;
-    struct {
-        uint8_t data[2][CGBL_VIDEO_RAM_WIDTH];
-        union {
-            uint8_t raw;
-            struct {
-                uint8_t select : 1;
-            };
-        } bank;
-    } ram;
-    struct {
-        uint8_t x;
-        uint8_t y;
-    } scroll;
-    union {
-        uint8_t raw;
+            uint8_t begin;
+            uint8_t control;
+            uint8_t end;
+            cgbl_mode_e mode;
+            uint8_t scroll_x;
+            uint8_t scroll_y;
+            cgbl_object_list_t shown;
+            uint8_t window_counter;
+            uint8_t window_x;
+            uint8_t window_y;
+            uint8_t y;
+        } line;
         struct {
-            uint8_t state : 2;
-            uint8_t coincidence : 1;
-            uint8_t interrupt_hblank : 1;
-            uint8_t interrupt_vblank : 1;
-            uint8_t interrupt_search : 1;
-            uint8_t interrupt_coincidence : 1;
-        };
-    } status;
-    struct {
-        bool active;
-        uint16_t offset;
-        union {
-            uint8_t raw;
-            struct {
-                uint8_t length : 7;
-                uint8_t hblank : 1;
-            };
-        } control;
-        union {
-            uint16_t word;
-            struct {
-                uint8_t low;
-                uint8_t high;
-            };
-        } destination;
-        union {
-            uint16_t word;
-            struct {
-                uint8_t low;
-                uint8_t high;
-            };
-        } source;
+            uint16_t address;
+            uint8_t bank;
+            uint8_t length;
+            uint8_t data[16];
+        } copy;
         struct {
-            uint8_t address;
-            uint8_t delay;
-            uint16_t destination;
-            uint16_t source;
-        } object;
-    } transfer;
-    struct {
-        uint8_t counter;
-        uint8_t x;
-        uint8_t y;
-    } window;
-} video = {};
-
-static cgbl_color_e cgbl_video_cgb_background_color(cgbl_background_t **const background, uint8_t map, uint8_t x, uint8_t y) {
-    uint16_t address = (map ? 0x1C00 : 0x1800) + (32 * ((y / 8) & 31)) + ((x / 8) & 31);
-    *background = (cgbl_background_t *)&video.ram.data[1][address];
-    if ((*background)->flip_x) {
-        x = 7 - x;
+            uint16_t address;
+            uint8_t data;
+            uint8_t index;
+        } write;
+    };
+} cgbl_command_t;
+
+typedef struct {
+    uint8_t attribute[CGBL_VIDEO_WIDTH + (2 * CGBL_VIDEO_LINE_OFFSET)];
+    uint8_t color[CGBL_VIDEO_WIDTH + (2 * CGBL_VIDEO_LINE_OFFSET)];
+    uint16_t data[CGBL_VIDEO_WIDTH + (2 * CGBL_VIDEO_LINE_OFFSET)];
+    uint8_t priority[CGBL_VIDEO_WIDTH + (2 * CGBL_VIDEO_LINE_OFFSET)];
+} cgbl_line_t;
+
+struct cgbl_video_thread_s {
+    atomic_bool active;
+    cgbl_command_t command[CGBL_VIDEO_THREAD_WIDTH];
+    uint32_t count;
+    cnd_t done;
+    atomic_uint frame;
+    thrd_t handle;
+    atomic_uint head;
+    atomic_bool idle;
+    mtx_t lock;
+    uint16_t output[2][CGBL_VIDEO_HEIGHT][CGBL_VIDEO_WIDTH];
+    cgbl_video_t shadow;
+    atomic_uint tail;
+    atomic_bool waiting;
+    cnd_t work;
+};
+
+static uint16_t cgbl_video_background_tile(cgbl_video_t *const video, uint16_t address) {
+    uint8_t id = video->ram.data[0][address];
+    return video->control.background_data ? id : (256 + (int8_t)id);
+}
+
+static uint8_t cgbl_video_background_span(cgbl_video_t *const video, int16_t window, uint8_t index, uint8_t *const map,
+                                          uint8_t *const x, uint8_t *const y) {
+    uint8_t result = 0;
+    if (index >= window) {
+        *map = video->control.window_map;
+        *x = index - (video->window.x - 7);
+        *y = video->window.counter - video->window.y;
+        result = 8 - (*x & 7);
+    } else {
+        *map = video->control.background_map;
+        *x = index + video->scroll.x;
+        *y = video->line.y + video->scroll.y;
+        result = 8 - (*x & 7);
+        if ((index + result) > window) {
+            result = window - index;
+        }
     }
-    if ((*background)->flip_y) {
-        y = 7 - y;
+    if ((index + result) > CGBL_VIDEO_WIDTH) {
+        result = CGBL_VIDEO_WIDTH - index;
     }
-    if (video.control.background_data) {
-        address = (16 * video.ram.data[0][address]) + (2 * (y & 7));
-    } else {
-        address = (16 * (int8_t)video.ram.data[0][address]) + (2 * (y & 7)) + 0x1000;
+    return result;
+}
+
+static int16_t cgbl_video_background_window(cgbl_video_t *const video) {
+    int16_t result = CGBL_VIDEO_WIDTH;
+    if (video->control.window_enabled && (video->window.x <= 166) && (video->window.y <= 143) && (video->window.y <= video->line.y)) {
+        result = (video->window.x > 7) ? (video->window.x - 7) : 0;
+    }
+    return result;
+}
+
+static void cgbl_video_host_color(cgbl_lookup_t *const lookup, uint8_t palette, uint8_t index, uint16_t color) {
+    lookup->data[palette][index] = color;
+    lookup->high[palette][index] = color >> 8;
+    lookup->low[palette][index] = color;
+}
+
+static void cgbl_video_host_cgb(cgbl_lookup_t *const lookup, const uint16_t (*const color)[CGBL_COLOR_MAX], uint8_t address) {
+    uint8_t index = (address / 2) % CGBL_COLOR_MAX, palette = address / (2 * CGBL_COLOR_MAX);
+    cgbl_video_host_color(lookup, palette, index, color[palette][index]);
+}
+
+static void cgbl_video_host_dmg(cgbl_video_t *const video) {
+    for (uint8_t index = 0; index < CGBL_COLOR_MAX; ++index) {
+        video->background.color.host.map[index] = (video->background.color.palette.raw >> (2 * index)) & 3;
+        cgbl_video_host_color(&video->background.color.host.dmg, 0, index, video->background.color.dmg[index]);
+        for (uint8_t palette = 0; palette < 2; ++palette) {
+            uint8_t color = (video->object.color.palette[palette].raw >> (2 * index)) & 3;
+            cgbl_video_host_color(&video->object.color.host.dmg, palette, index, video->object.color.dmg[palette][color]);
+        }
     }
-    x = 1 << (7 - (x & 7));
-    return ((video.ram.data[(*background)->bank][address + 1] & x) ? 2 : 0) + ((video.ram.data[(*background)->bank][address] & x) ? 1 : 0);
 }
 
-static void cgbl_video_cgb_background_render(void) {
+static void cgbl_video_clear(cgbl_video_t *const video) {
+    for (uint8_t y = 0; y < CGBL_VIDEO_HEIGHT; ++y) {
+        for (uint8_t x = 0; x < CGBL_VIDEO_WIDTH; ++x) {
+            if (video->pixel.data[y][x] != 0xFFFF) {
+                memset(video->pixel.data[y], 0xFF, sizeof(*video->pixel.data));
+                video->frame.dirty[y] = true;
+                break;
+            }
+        }
+    }
+}
+
+static void cgbl_video_line_load(cgbl_video_t *const video, cgbl_line_t *const line) {
+    memcpy(&line->data[CGBL_VIDEO_LINE_OFFSET], video->pixel.data[video->line.y], sizeof(*video->pixel.data));
+}
+
+static void cgbl_video_line_map(cgbl_line_t *const line, const uint8_t *const map) {
+    uint8_t *color = &line->color[CGBL_VIDEO_LINE_OFFSET];
+#if defined(__AVX2__)
+    __m256i table = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)map));
+    for (uint8_t index = 0; index < CGBL_VIDEO_WIDTH; index += 32) {
+        _mm256_storeu_si256((__m256i *)&color[index], _mm256_shuffle_epi8(table, _mm256_loadu_si256((const __m256i *)&color[index])));
+    }
+#elif defined(__SSE4_1__)
+    __m128i table = _mm_loadu_si128((const __m128i *)map);
+    for (uint8_t index = 0; index < CGBL_VIDEO_WIDTH; index += 16) {
+        _mm_storeu_si128((__m128i *)&color[index], _mm_shuffle_epi8(table, _mm_loadu_si128((const __m128i *)&color[index])));
+    }
+#else
     for (uint8_t index = 0; index < CGBL_VIDEO_WIDTH; ++index) {
-        cgbl_background_t *background = NULL;
-        cgbl_color_e color = CGBL_COLOR_WHITE;
-        uint8_t map = 0, x = index, y = video.line.y;
-        if (video.control.window_enabled && (video.window.x <= 166) && (video.window.y <= 143) && ((video.window.x - 7) <= x) &&
-            (video.window.y <= y)) {
-            map = video.control.window_map;
-            x -= (video.window.x - 7);
-            y = video.window.counter - video.window.y;
-        } else {
-            map = video.control.background_map;
-            x += video.scroll.x;
-            y += video.scroll.y;
+        color[index] = map[color[index]];
+    }
+#endif
+}
+
+static void cgbl_video_line_object(cgbl_line_t *const line, const cgbl_object_t *const object, const uint8_t *const row,
+                                   const cgbl_lookup_t *const lookup, uint8_t palette, bool force, bool under) {
+    if (object->x && (object->x < (CGBL_VIDEO_WIDTH + 8))) {
+        uint8_t x = object->x - 8 + CGBL_VIDEO_LINE_OFFSET;
+#if defined(__SSE4_1__)
+        __m128i color = _mm_loadl_epi64((const __m128i *)row), mask = _mm_set1_epi8(force ? -1 : 0), zero = _mm_setzero_si128();
+        mask = _mm_or_si128(mask, _mm_cmpeq_epi8(_mm_loadl_epi64((const __m128i *)&line->color[x]), zero));
+        if (under) {
+            mask = _mm_or_si128(mask, _mm_cmpeq_epi8(_mm_loadl_epi64((const __m128i *)&line->priority[x]), zero));
+        }
+        mask = _mm_andnot_si128(_mm_cmpeq_epi8(color, zero), mask);
+        color = _mm_unpacklo_epi8(_mm_shuffle_epi8(_mm_loadu_si32(lookup->low[palette]), color),
+                                  _mm_shuffle_epi8(_mm_loadu_si32(lookup->high[palette]), color));
+        _mm_storeu_si128((__m128i *)&line->data[x],
+                         _mm_blendv_epi8(_mm_loadu_si128((const __m128i *)&line->data[x]), color, _mm_unpacklo_epi8(mask, mask)));
+#else
+        for (uint8_t index = 0; index < 8; ++index, ++x) {
+            if (row[index] && (force || !line->color[x] || (under && !line->priority[x]))) {
+                line->data[x] = lookup->data[palette][row[index]];
+            }
         }
-        color = cgbl_video_cgb_background_color(&background, map, x, y);
-        video.pixel.color[video.line.y][index] = color;
-        video.pixel.data[video.line.y][index] = video.background.color.cgb[background->palette][color];
-        video.pixel.priority[video.line.y][index] = background->priority;
+#endif
+    }
+}
+
+static void cgbl_video_line_palette(cgbl_line_t *const line, const cgbl_lookup_t *const lookup) {
+    const uint8_t *attribute = &line->attribute[CGBL_VIDEO_LINE_OFFSET], *color = &line->color[CGBL_VIDEO_LINE_OFFSET];
+    uint16_t *data = &line->data[CGBL_VIDEO_LINE_OFFSET];
+#if defined(__SSE4_1__)
+    const uint8_t *high = lookup->high[0], *low = lookup->low[0];
+#endif
+#if defined(__AVX2__)
+    __m256i high_0 = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)&high[0])),
+            high_1 = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)&high[16])),
+            low_0 = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)&low[0])),
+            low_1 = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)&low[16]));
+    for (uint8_t index = 0; index < CGBL_VIDEO_WIDTH; index += 32) {
+        __m256i value = _mm256_or_si256(_mm256_slli_epi16(_mm256_loadu_si256((const __m256i *)&attribute[index]), 2),
+                                        _mm256_loadu_si256((const __m256i *)&color[index]));
+        __m256i select = _mm256_slli_epi16(value, 3);
+        __m256i first = _mm256_blendv_epi8(_mm256_shuffle_epi8(low_0, value), _mm256_shuffle_epi8(low_1, value), select),
+                second = _mm256_blendv_epi8(_mm256_shuffle_epi8(high_0, value), _mm256_shuffle_epi8(high_1, value), select);
+        value = _mm256_unpacklo_epi8(first, second);
+        second = _mm256_unpackhi_epi8(first, second);
+        _mm256_storeu_si256((__m256i *)&data[index], _mm256_permute2x128_si256(value, second, 0x20));
+        _mm256_storeu_si256((__m256i *)&data[index + 16], _mm256_permute2x128_si256(value, second, 0x31));
+    }
+#elif defined(__SSE4_1__)
+    __m128i high_0 = _mm_loadu_si128((const __m128i *)&high[0]), high_1 = _mm_loadu_si128((const __m128i *)&high[16]),
+            low_0 = _mm_loadu_si128((const __m128i *)&low[0]), low_1 = _mm_loadu_si128((const __m128i *)&low[16]);
+    for (uint8_t index = 0; index < CGBL_VIDEO_WIDTH; index += 16) {
+        __m128i value = _mm_or_si128(_mm_slli_epi16(_mm_loadu_si128((const __m128i *)&attribute[index]), 2),
+                                     _mm_loadu_si128((const __m128i *)&color[index]));
+        __m128i select = _mm_slli_epi16(value, 3);
+        __m128i first = _mm_blendv_epi8(_mm_shuffle_epi8(low_0, value), _mm_shuffle_epi8(low_1, value), select),
+                second = _mm_blendv_epi8(_mm_shuffle_epi8(high_0, value), _mm_shuffle_epi8(high_1, value), select);
+        _mm_storeu_si128((__m128i *)&data[index], _mm_unpacklo_epi8(first, second));
+        _mm_storeu_si128((__m128i *)&data[index + 8], _mm_unpackhi_epi8(first, second));
+    }
+#else
+    for (uint8_t index = 0; index < CGBL_VIDEO_WIDTH; ++index) {
+        data[index] = lookup->data[attribute[index]][color[index]];
+    }
+#endif
+}
+
+static void cgbl_video_line_store(cgbl_video_t *const video, const cgbl_line_t *const line, uint8_t begin, uint8_t end) {
+    if (memcmp(&video->pixel.data[video->line.y][begin], &line->data[CGBL_VIDEO_LINE_OFFSET + begin],
+               (end - begin) * sizeof(**video->pixel.data))) {
+        memcpy(&video->pixel.data[video->line.y][begin], &line->data[CGBL_VIDEO_LINE_OFFSET + begin],
+               (end - begin) * sizeof(**video->pixel.data));
+        video->frame.dirty[video->line.y] = true;
+    }
+}
+
+static void cgbl_video_tile_unpack(uint16_t row, bool flip, uint8_t *const color) {
+    if (flip) {
+        row = (REVERSE[row & 0xFF] << 8) | REVERSE[row >> 8];
+    }
+    for (uint8_t x = 0; x < 8; ++x, row >>= 2) {
+        color[x] = row & 3;
+    }
+}
+
+static uint16_t cgbl_video_cgb_background_row(cgbl_video_t *const video, const cgbl_background_t **const background, uint8_t map,
+                                                    uint8_t x, uint8_t y) {
+    uint16_t address = (map ? 0x1C00 : 0x1800) + (32 * ((y / 8) & 31)) + ((x / 8) & 31);
+    *background = (const cgbl_background_t *)&video->ram.data[1][address];
+    if ((*background)->flip_y) {
+        y = 7 - y;
     }
+    return video->ram.tile[(*background)->bank][cgbl_video_background_tile(video, address)][y & 7];
 }
 
-static cgbl_color_e cgbl_video_cgb_object_color(const cgbl_object_t *object, uint8_t x, uint8_t y) {
-    uint16_t address = 0;
+static void cgbl_video_cgb_background_render(cgbl_video_t *const video, cgbl_line_t *const line) {
+    int16_t window = cgbl_video_background_window(video);
+    for (uint8_t index = 0; index < CGBL_VIDEO_WIDTH;) {
+        const cgbl_background_t *background = NULL;
+        uint8_t map = 0, row[8] = {}, x = 0, y = 0, count = cgbl_video_background_span(video, window, index, &map, &x, &y);
+        uint16_t data = cgbl_video_cgb_background_row(video, &background, map, x, y);
+        cgbl_video_tile_unpack(data, background->flip_x, row);
+        memset(&line->attribute[CGBL_VIDEO_LINE_OFFSET + index], background->palette, count);
+        memcpy(&line->color[CGBL_VIDEO_LINE_OFFSET + index], &row[x & 7], count);
+        memset(&line->priority[CGBL_VIDEO_LINE_OFFSET + index], background->priority, count);
+        index += count;
+    }
+    cgbl_video_line_palette(line, &video->background.color.host.cgb);
+}
+
+static uint16_t cgbl_video_cgb_object_row(cgbl_video_t *const video, const cgbl_object_t *object, uint8_t y) {
     uint8_t id = object->id;
-    if (video.control.object_size) {
+    if (video->control.object_size) {
         if (object->attribute.flip_y) {
             if ((y - (object->y - 16)) < 8) {
                 id |= 1;
@@ -344,81 +436,26 @@ static cgbl_color_e cgbl_video_cgb_object_color(const cgbl_object_t *object, uin
         }
     }
     y = (y - object->y) & 7;
-    if (object->attribute.flip_x) {
-        x = 7 - x;
-    }
     if (object->attribute.flip_y) {
         y = 7 - y;
     }
-    address = (16 * id) + (2 * y);
-    x = 1 << (7 - x);
-    return ((video.ram.data[object->attribute.bank][address + 1] & x) ? 2 : 0) +
-           ((video.ram.data[object->attribute.bank][address] & x) ? 1 : 0);
-}
-
-static void cgbl_video_cgb_object_render(void) {
-    if (video.object.shown.count) {
-        uint8_t y = video.line.y;
-        for (int32_t index = (video.object.shown.count - 1); index >= 0; index--) {
-            const cgbl_object_t *object = video.object.shown.entry[index].object;
-            for (uint8_t x = 0; x < 8; ++x) {
-                cgbl_color_e color = CGBL_COLOR_WHITE;
-                if ((object->x < 8) && (x < (8 - object->x))) {
-                    continue;
-                } else if ((object->x >= 160) && (x >= (8 - (object->x - 160)))) {
-                    break;
-                }
-                color = cgbl_video_cgb_object_color(object, x, y);
-                if (color && (!video.control.background_enabled || !video.pixel.color[y][object->x + x - 8] ||
-                              (!video.pixel.priority[y][object->x + x - 8] && !object->attribute.priority))) {
-                    video.pixel.data[y][object->x + x - 8] = video.object.color.cgb[object->attribute.palette][color];
-                }
-            }
-        }
-    }
+    return video->ram.tile[object->attribute.bank][id][y];
 }
 
-static void cgbl_video_cgb_object_search(void) {
-    uint8_t size = video.control.object_size ? 16 : 8, y = video.line.y;
-    video.object.shown.count = 0;
-    for (uint8_t index = 0; index < CGBL_VIDEO_RAM_OBJECT_WIDTH; ++index) {
-        const cgbl_object_t *object = &video.object.ram[index];
-        if ((y < (object->y - 16 + size)) && (y >= (object->y - 16))) {
-            cgbl_object_entry_t *entry = &video.object.shown.entry[video.object.shown.count++];
-            entry->object = object;
-            entry->index = index;
-        }
-        if (video.object.shown.count >= 10) {
-            break;
-        }
+static void cgbl_video_cgb_object_render(cgbl_video_t *const video, cgbl_line_t *const line) {
+    for (int32_t index = (video->object.shown.count - 1); index >= 0; index--) {
+        const cgbl_object_t *object = &video->object.ram[video->object.shown.index[index]];
+        uint8_t row[8] = {};
+        cgbl_video_tile_unpack(cgbl_video_cgb_object_row(video, object, video->line.y), object->attribute.flip_x, row);
+        cgbl_video_line_object(line, object, row, &video->object.color.host.cgb, object->attribute.palette,
+                               !video->control.background_enabled, !object->attribute.priority);
     }
 }
 
-static cgbl_color_e cgbl_video_dmg_palette_color(const cgbl_palette_t *const palette, cgbl_color_e color) {
-    cgbl_color_e result = CGBL_COLOR_WHITE;
-    switch (color) {
-    case CGBL_COLOR_WHITE:
-        result = palette->white;
-        break;
-    case CGBL_COLOR_GREY_LIGHT:
-        result = palette->grey_light;
-        break;
-    case CGBL_COLOR_GREY_DARK:
-        result = palette->grey_dark;
-        break;
-    case CGBL_COLOR_BLACK:
-        result = palette->black;
-        break;
-    default:
-        break;
-    }
-    return result;
-}
-
-static void cgbl_video_dmg_palette_reset(void) {
+static void cgbl_video_dmg_palette_reset(cgbl_context_t *const context) {
     char disambiguation = '\0';
     uint8_t hash = 0, index = 0;
-    hash = cgbl_cartridge_palette_hash(&disambiguation);
+    hash = cgbl_cartridge_palette_hash(context, &disambiguation);
     for (; index < CGBL_LENGTH(PALETTE) - 1; ++index) {
         if (hash == PALETTE[index].hash) {
             if (PALETTE[index].disambiguation && (disambiguation != PALETTE[index].disambiguation)) {
@@ -427,46 +464,32 @@ static void cgbl_video_dmg_palette_reset(void) {
             break;
         }
     }
-    video.background.color.dmg = PALETTE[index].background;
-    video.object.color.dmg[0] = PALETTE[index].object[0];
-    video.object.color.dmg[1] = PALETTE[index].object[1];
+    context->video.background.color.dmg = PALETTE[index].background;
+    context->video.object.color.dmg[0] = PALETTE[index].object[0];
+    context->video.object.color.dmg[1] = PALETTE[index].object[1];
+    cgbl_video_host_dmg(&context->video);
 }
 
-static cgbl_color_e cgbl_video_dmg_background_color(uint8_t map, uint8_t x, uint8_t y) {
+static uint16_t cgbl_video_dmg_background_row(cgbl_video_t *const video, uint8_t map, uint8_t x, uint8_t y) {
     uint16_t address = (map ? 0x1C00 : 0x1800) + (32 * ((y / 8) & 31)) + ((x / 8) & 31);
-    if (video.control.background_data) {
-        address = (16 * video.ram.data[0][address]) + (2 * (y & 7));
-    } else {
-        address = (16 * (int8_t)video.ram.data[0][address]) + (2 * (y & 7)) + 0x1000;
-    }
-    x = 1 << (7 - (x & 7));
-    return ((video.ram.data[0][address + 1] & x) ? 2 : 0) + ((video.ram.data[0][address] & x) ? 1 : 0);
+    return video->ram.tile[0][cgbl_video_background_tile(video, address)][y & 7];
 }
 
-static void cgbl_video_dmg_background_render(void) {
-    for (uint8_t index = 0; index < CGBL_VIDEO_WIDTH; ++index) {
-        cgbl_color_e color = CGBL_COLOR_WHITE;
-        uint8_t map = 0, x = index, y = video.line.y;
-        if (video.control.window_enabled && (video.window.x <= 166) && (video.window.y <= 143) && ((video.window.x - 7) <= x) &&
-            (video.window.y <= y)) {
-            map = video.control.window_map;
-            x -= (video.window.x - 7);
-            y = video.window.counter - video.window.y;
-        } else {
-            map = video.control.background_map;
-            x += video.scroll.x;
-            y += video.scroll.y;
-        }
-        color = cgbl_video_dmg_palette_color(&video.background.color.palette, cgbl_video_dmg_background_color(map, x, y));
-        video.pixel.color[video.line.y][index] = color;
-        video.pixel.data[video.line.y][index] = video.background.color.dmg[color];
+static void cgbl_video_dmg_background_render(cgbl_video_t *const video, cgbl_line_t *const line) {
+    int16_t window = cgbl_video_background_window(video);
+    for (uint8_t index = 0; index < CGBL_VIDEO_WIDTH;) {
+        uint8_t map = 0, row[8] = {}, x = 0, y = 0, count = cgbl_video_background_span(video, window, index, &map, &x, &y);
+        cgbl_video_tile_unpack(cgbl_video_dmg_background_row(video, map, x, y), false, row);
+        memcpy(&line->color[CGBL_VIDEO_LINE_OFFSET + index], &row[x & 7], count);
+        index += count;
     }
+    cgbl_video_line_map(line, video->background.color.host.map);
+    cgbl_video_line_palette(line, &video->background.color.host.dmg);
 }
 
-static cgbl_color_e cgbl_video_dmg_object_color(const cgbl_object_t *object, uint8_t x, uint8_t y) {
-    uint16_t address = 0;
+static uint16_t cgbl_video_dmg_object_row(cgbl_video_t *const video, const cgbl_object_t *object, uint8_t y) {
     uint8_t id = object->id;
-    if (video.control.object_size) {
+    if (video->control.object_size) {
         if (object->attribute.flip_y) {
             if ((y - (object->y - 16)) < 8) {
                 id |= 1;
@@ -480,258 +503,689 @@ static cgbl_color_e cgbl_video_dmg_object_color(const cgbl_object_t *object, uin
         }
     }
     y = (y - object->y) & 7;
-    if (object->attribute.flip_x) {
-        x = 7 - x;
-    }
     if (object->attribute.flip_y) {
         y = 7 - y;
     }
-    address = (16 * id) + (2 * y);
-    x = 1 << (7 - x);
-    return ((video.ram.data[0][address + 1] & x) ? 2 : 0) + ((video.ram.data[0][address] & x) ? 1 : 0);
+    return video->ram.tile[0][id][y];
 }
 
-static int cgbl_video_dmg_object_comparator(const void *first, const void *second) {
-    int result = 0;
-    const cgbl_object_entry_t *entry[] = { first, second };
-    if (entry[0]->object->x == entry[1]->object->x) {
-        result = entry[1]->index - entry[0]->index;
-    } else {
-        result = entry[1]->object->x - entry[0]->object->x;
+static void cgbl_video_dmg_object_render(cgbl_video_t *const video, cgbl_line_t *const line) {
+    for (uint32_t index = 0; index < video->object.shown.count; ++index) {
+        const cgbl_object_t *object = &video->object.ram[video->object.shown.index[index]];
+        uint8_t row[8] = {};
+        cgbl_video_tile_unpack(cgbl_video_dmg_object_row(video, object, video->line.y), object->attribute.flip_x, row);
+        cgbl_video_line_object(line, object, row, &video->object.color.host.dmg, object->attribute.palette_dmg, !object->attribute.priority,
+                               false);
+    }
+}
+
+static bool cgbl_video_object_before(const cgbl_video_t *const video, uint8_t index, uint8_t other) {
+    const cgbl_object_t *object = &video->object.ram[index], *next = &video->object.ram[other];
+    return video->object.bucket.sorted ? ((object->x > next->x) || ((object->x == next->x) && (index > other))) : (index < other);
+}
+
+static uint8_t cgbl_video_object_find(const cgbl_object_list_t *const line, uint8_t index) {
+    uint8_t result = 0;
+    while ((result < line->count) && (line->index[result] != index)) {
+        ++result;
     }
     return result;
 }
 
-static void cgbl_video_dmg_object_render(void) {
-    uint8_t y = video.line.y;
-    for (uint32_t index = 0; index < video.object.shown.count; ++index) {
-        const cgbl_object_t *object = video.object.shown.entry[index].object;
-        for (uint8_t x = 0; x < 8; ++x) {
-            cgbl_color_e color = CGBL_COLOR_WHITE;
-            if ((object->x < 8) && (x < (8 - object->x))) {
-                continue;
-            } else if ((object->x >= 160) && (x >= (8 - (object->x - 160)))) {
-                break;
+static void cgbl_video_object_range(const cgbl_video_t *const video, uint8_t index, int16_t *const begin, int16_t *const end) {
+    *begin = video->object.ram[index].y - 16;
+    *end = *begin + video->object.bucket.size;
+    if (*begin < 0) {
+        *begin = 0;
+    }
+    if (*end > CGBL_VIDEO_HEIGHT) {
+        *end = CGBL_VIDEO_HEIGHT;
+    }
+}
+
+static void cgbl_video_object_line(cgbl_video_t *const video, cgbl_object_list_t *const line, uint8_t index) {
+    uint8_t position = 0;
+    if (line->count == CGBL_LENGTH(line->index)) {
+        uint8_t last = 0;
+        for (uint8_t entry = 1; entry < line->count; ++entry) {
+            if (line->index[entry] > line->index[last]) {
+                last = entry;
             }
-            if ((color = cgbl_video_dmg_object_color(object, x, y)) &&
-                (!object->attribute.priority || !video.pixel.color[y][object->x + x - 8])) {
-                color = cgbl_video_dmg_palette_color(&video.object.color.palette[object->attribute.palette_dmg], color);
-                video.pixel.data[y][object->x + x - 8] = video.object.color.dmg[object->attribute.palette_dmg][color];
+        }
+        if (line->index[last] < index) {
+            return;
+        }
+        memmove(&line->index[last], &line->index[last + 1], --line->count - last);
+    }
+    for (position = line->count++; position && cgbl_video_object_before(video, index, line->index[position - 1]); --position) {
+        line->index[position] = line->index[position - 1];
+    }
+    line->index[position] = index;
+}
+
+static void cgbl_video_object_insert(cgbl_video_t *const video, uint8_t index) {
+    int16_t begin = 0, end = 0;
+    cgbl_video_object_range(video, index, &begin, &end);
+    for (int16_t y = begin; y < end; ++y) {
+        cgbl_video_object_line(video, &video->object.bucket.line[y], index);
+    }
+}
+
+static void cgbl_video_object_remove(cgbl_video_t *const video, uint8_t index) {
+    int16_t begin = 0, end = 0;
+    cgbl_video_object_range(video, index, &begin, &end);
+    for (int16_t y = begin; y < end; ++y) {
+        cgbl_object_list_t *line = &video->object.bucket.line[y];
+        uint8_t position = cgbl_video_object_find(line, index);
+        if (position < line->count) {
+            bool full = (line->count == CGBL_LENGTH(line->index));
+            memmove(&line->index[position], &line->index[position + 1], --line->count - position);
+            for (uint8_t other = 0; full && (other < CGBL_VIDEO_RAM_OBJECT_WIDTH); ++other) {
+                int16_t first = 0, last = 0;
+                cgbl_video_object_range(video, other, &first, &last);
+                if ((other != index) && (y >= first) && (y < last) && (cgbl_video_object_find(line, other) == line->count)) {
+                    cgbl_video_object_line(video, line, other);
+                    full = false;
+                }
             }
         }
     }
 }
 
-static void cgbl_video_dmg_object_search(void) {
-    video.object.shown.count = 0;
-    uint8_t size = video.control.object_size ? 16 : 8, y = video.line.y;
+static void cgbl_video_object_bucket(cgbl_context_t *const context, uint8_t size, bool sorted) {
+    for (uint8_t y = 0; y < CGBL_VIDEO_HEIGHT; ++y) {
+        context->video.object.bucket.line[y].count = 0;
+    }
+    context->video.object.bucket.dirty = false;
+    context->video.object.bucket.size = size;
+    context->video.object.bucket.sorted = sorted;
     for (uint8_t index = 0; index < CGBL_VIDEO_RAM_OBJECT_WIDTH; ++index) {
-        const cgbl_object_t *object = &video.object.ram[index];
-        if ((y >= (object->y - 16)) && (y < (object->y - 16 + size))) {
-            cgbl_object_entry_t *entry = &video.object.shown.entry[video.object.shown.count++];
-            entry->object = object;
-            entry->index = index;
+        cgbl_video_object_insert(&context->video, index);
+    }
+}
+
+static void cgbl_video_object_search(cgbl_context_t *const context, bool sorted) {
+    uint8_t size = context->video.control.object_size ? 16 : 8;
+    if (context->video.object.bucket.dirty || (context->video.object.bucket.size != size) ||
+        (context->video.object.bucket.sorted != sorted)) {
+        cgbl_video_object_bucket(context, size, sorted);
+    }
+    context->video.object.shown = context->video.object.bucket.line[context->video.line.y];
+}
+
+static bool cgbl_video_coincidence_check(cgbl_context_t *const context) {
+    return (!context->video.line.coincidence && (context->video.line.y == 153)) ||
+           (context->video.line.coincidence == context->video.line.y);
+}
+
+static void cgbl_video_coincidence(cgbl_context_t *const context) {
+    if (context->video.control.enabled) {
+        bool coincidence = cgbl_video_coincidence_check(context);
+        if (coincidence && !context->video.status.coincidence && context->video.status.interrupt_coincidence) {
+            cgbl_processor_interrupt(context, CGBL_INTERRUPT_SCREEN);
         }
-        if (video.object.shown.count >= 10) {
-            break;
+        context->video.status.coincidence = coincidence;
+    }
+}
+
+static void cgbl_video_object_store(cgbl_video_t *const video, uint8_t address, const uint8_t *const data, uint8_t length) {
+    for (uint8_t offset = 0; offset < length;) {
+        uint8_t index = (address + offset) / sizeof(cgbl_object_t), position = (address + offset) % sizeof(cgbl_object_t),
+                count = sizeof(cgbl_object_t) - position;
+        cgbl_object_t object = video->object.ram[index];
+        if (count > (length - offset)) {
+            count = length - offset;
+        }
+        memcpy((uint8_t *)&object + position, &data[offset], count);
+        if (!video->object.bucket.dirty &&
+            ((object.y != video->object.ram[index].y) || (video->object.bucket.sorted && (object.x != video->object.ram[index].x)))) {
+            cgbl_video_object_remove(video, index);
+            video->object.ram[index] = object;
+            cgbl_video_object_insert(video, index);
+        } else {
+            video->object.ram[index] = object;
+        }
+        offset += count;
+    }
+}
+
+static void cgbl_video_palette_store(cgbl_video_t *const video, uint16_t address, uint8_t index, uint8_t data) {
+    switch (address) {
+    case CGBL_VIDEO_PALETTE_BACKGROUND:
+        video->background.color.palette.raw = data;
+        cgbl_video_host_dmg(video);
+        break;
+    case CGBL_VIDEO_PALETTE_BACKGROUND_DATA:
+        ((uint8_t *)video->background.color.cgb)[index] = data;
+        cgbl_video_host_cgb(&video->background.color.host.cgb, video->background.color.cgb, index);
+        break;
+    case CGBL_VIDEO_PALETTE_OBJECT_0:
+    case CGBL_VIDEO_PALETTE_OBJECT_1:
+        video->object.color.palette[address - CGBL_VIDEO_PALETTE_OBJECT_0].raw = data;
+        cgbl_video_host_dmg(video);
+        break;
+    case CGBL_VIDEO_PALETTE_OBJECT_DATA:
+        ((uint8_t *)video->object.color.cgb)[index] = data;
+        cgbl_video_host_cgb(&video->object.color.host.cgb, video->object.color.cgb, index);
+        break;
+    default:
+        break;
+    }
+}
+
+static void cgbl_video_ram_store(cgbl_video_t *const video, uint8_t bank, uint16_t address, const uint8_t *const data, uint16_t length) {
+    uint16_t end = address + length;
+    memcpy(&video->ram.data[bank][address], data, length);
+    if (end > CGBL_WIDTH(CGBL_VIDEO_RAM_BEGIN, CGBL_VIDEO_RAM_TILE_END)) {
+        end = CGBL_WIDTH(CGBL_VIDEO_RAM_BEGIN, CGBL_VIDEO_RAM_TILE_END);
+    }
+    for (uint16_t offset = address & ~1; offset < end; offset += 2) {
+        const uint8_t *plane = &video->ram.data[bank][offset];
+        uint16_t row = 0;
+        for (uint8_t x = 0; x < 8; ++x) {
+            row |= ((((plane[1] >> (7 - x)) & 1) << 1) | ((plane[0] >> (7 - x)) & 1)) << (2 * x);
         }
+        video->ram.tile[bank][offset / 16][(offset / 2) & 7] = row;
     }
-    if (video.object.shown.count > 1) {
-        qsort(video.object.shown.entry, video.object.shown.count, sizeof(*video.object.shown.entry), cgbl_video_dmg_object_comparator);
+}
+
+static void cgbl_video_compose(cgbl_video_t *const video, cgbl_mode_e mode, uint8_t begin, uint8_t end) {
+    cgbl_line_t line = {};
+    cgbl_video_line_load(video, &line);
+    if (mode == CGBL_MODE_CGB) {
+        cgbl_video_cgb_background_render(video, &line);
+    } else if (video->control.background_enabled) {
+        cgbl_video_dmg_background_render(video, &line);
     }
+    if (video->control.object_enabled) {
+        if (mode == CGBL_MODE_CGB) {
+            cgbl_video_cgb_object_render(video, &line);
+        } else {
+            cgbl_video_dmg_object_render(video, &line);
+        }
+    }
+    cgbl_video_line_store(video, &line, begin, end);
 }
 
-static void cgbl_video_coincidence(void) {
-    if (video.control.enabled) {
-        bool coincidence = (!video.line.coincidence && (video.line.y == 153)) || (video.line.coincidence == video.line.y);
-        if (coincidence && !video.status.coincidence && video.status.interrupt_coincidence) {
-            cgbl_processor_interrupt(CGBL_INTERRUPT_SCREEN);
+static void cgbl_video_thread_command(cgbl_video_thread_t *const thread, const cgbl_command_t *const command) {
+    cgbl_video_t *video = &thread->shadow;
+    switch (command->type) {
+    case CGBL_COMMAND_CLEAR:
+        cgbl_video_clear(video);
+        break;
+    case CGBL_COMMAND_FRAME:
+        memcpy(thread->output[atomic_load_explicit(&thread->frame, memory_order_relaxed) & 1], video->pixel.data,
+               sizeof(video->pixel.data));
+        atomic_fetch_add(&thread->frame, 1);
+        break;
+    case CGBL_COMMAND_LINE:
+        video->control.raw = command->line.control;
+        video->line.y = command->line.y;
+        video->object.shown = command->line.shown;
+        video->scroll.x = command->line.scroll_x;
+        video->scroll.y = command->line.scroll_y;
+        video->window.counter = command->line.window_counter;
+        video->window.x = command->line.window_x;
+        video->window.y = command->line.window_y;
+        cgbl_video_compose(video, command->line.mode, command->line.begin, command->line.end);
+        break;
+    case CGBL_COMMAND_OBJECT:
+        cgbl_video_object_store(video, command->copy.address, command->copy.data, command->copy.length);
+        break;
+    case CGBL_COMMAND_PALETTE:
+        cgbl_video_palette_store(video, command->write.address, command->write.index, command->write.data);
+        break;
+    case CGBL_COMMAND_RAM:
+        cgbl_video_ram_store(video, command->copy.bank, command->copy.address, command->copy.data, command->copy.length);
+        break;
+    default:
+        break;
+    }
+}
+
+static void cgbl_video_thread_signal(cgbl_video_thread_t *const thread, cnd_t *const condition) {
+    mtx_lock(&thread->lock);
+    cnd_signal(condition);
+    mtx_unlock(&thread->lock);
+}
+
+static void cgbl_video_thread_wait(cgbl_video_thread_t *const thread, atomic_uint *const counter, uint32_t target) {
+    if ((int32_t)(atomic_load(counter) - target) < 0) {
+        mtx_lock(&thread->lock);
+        atomic_store(&thread->waiting, true);
+        while ((int32_t)(atomic_load(counter) - target) < 0) {
+            cnd_wait(&thread->done, &thread->lock);
         }
-        video.status.coincidence = coincidence;
+        atomic_store(&thread->waiting, false);
+        mtx_unlock(&thread->lock);
     }
 }
 
-static void cgbl_video_transfer_hblank(void) {
-    if (!cgbl_processor_halted()) {
-        uint16_t destination = video.transfer.destination.word + video.transfer.offset,
-                 source = video.transfer.source.word + video.transfer.offset;
-        for (uint16_t length = 0; length < 16; ++length) {
-            video.ram.data[(cgbl_bus_mode() == CGBL_MODE_CGB) ? video.ram.bank.select : 0][destination++] = cgbl_bus_read(source++);
+static int cgbl_video_thread_worker(void *argument) {
+    cgbl_video_thread_t *thread = argument;
+    while (atomic_load(&thread->active)) {
+        uint32_t head = atomic_load_explicit(&thread->head, memory_order_relaxed);
+        if (head == atomic_load(&thread->tail)) {
+            mtx_lock(&thread->lock);
+            atomic_store(&thread->idle, true);
+            while (atomic_load(&thread->active) && (head == atomic_load(&thread->tail))) {
+                cnd_wait(&thread->work, &thread->lock);
+            }
+            atomic_store(&thread->idle, false);
+            mtx_unlock(&thread->lock);
+            continue;
         }
-        video.transfer.offset += 16;
-        if (!--video.transfer.control.length) {
-            video.transfer.active = false;
-            video.transfer.offset = 0;
-            video.transfer.control.raw = 0xFF;
+        cgbl_video_thread_command(thread, &thread->command[head % CGBL_VIDEO_THREAD_WIDTH]);
+        atomic_store(&thread->head, head + 1);
+        if (atomic_load(&thread->waiting)) {
+            cgbl_video_thread_signal(thread, &thread->done);
         }
     }
+    return 0;
 }
 
-static void cgbl_video_transfer_immediate(void) {
-    uint16_t destination = video.transfer.destination.word, source = video.transfer.source.word;
-    for (uint16_t length = 0; length < (video.transfer.control.length * 16); ++length) {
-        video.ram.data[(cgbl_bus_mode() == CGBL_MODE_CGB) ? video.ram.bank.select : 0][destination++] = cgbl_bus_read(source++);
+static void cgbl_video_thread_push(cgbl_video_thread_t *const thread, const cgbl_command_t *const command) {
+    uint32_t tail = atomic_load_explicit(&thread->tail, memory_order_relaxed);
+    cgbl_video_thread_wait(thread, &thread->head, tail - CGBL_VIDEO_THREAD_WIDTH + 1);
+    thread->command[tail % CGBL_VIDEO_THREAD_WIDTH] = *command;
+    atomic_store(&thread->tail, ++tail);
+    if (atomic_load(&thread->idle) && ((command->type == CGBL_COMMAND_FRAME) ||
+                                       ((tail - atomic_load_explicit(&thread->head, memory_order_relaxed)) >= CGBL_VIDEO_THREAD_BATCH))) {
+        cgbl_video_thread_signal(thread, &thread->work);
     }
-    video.transfer.control.raw = 0xFF;
 }
 
-static void cgbl_video_transfer_objects(void) {
-    if (video.transfer.object.destination) {
-        if (!video.transfer.object.delay) {
-            video.transfer.object.delay = 4;
-            ((uint8_t *)video.object.ram)[video.transfer.object.destination++ - CGBL_VIDEO_RAM_OBJECT_BEGIN] =
-                cgbl_bus_read(video.transfer.object.source++);
-            if (video.transfer.object.destination > CGBL_VIDEO_RAM_OBJECT_END) {
-                video.transfer.object.delay = 0;
-                video.transfer.object.destination = 0;
-                video.transfer.object.source = 0;
-                return;
+static void cgbl_video_thread_copy(cgbl_video_thread_t *const thread, cgbl_command_e type, uint8_t bank, uint16_t address,
+                                   const uint8_t *const data, uint16_t length) {
+    for (uint16_t offset = 0; offset < length; offset += sizeof(((cgbl_command_t *)NULL)->copy.data)) {
+        cgbl_command_t command = { .type = type, .copy = { .address = address + offset, .bank = bank, .length = length - offset } };
+        if (command.copy.length > sizeof(command.copy.data)) {
+            command.copy.length = sizeof(command.copy.data);
+        }
+        memcpy(command.copy.data, &data[offset], command.copy.length);
+        cgbl_video_thread_push(thread, &command);
+    }
+}
+
+static void cgbl_video_object_copy(cgbl_context_t *const context, uint8_t address, const uint8_t *const data, uint8_t length) {
+    cgbl_video_object_store(&context->video, address, data, length);
+    if (context->video.thread) {
+        cgbl_video_thread_copy(context->video.thread, CGBL_COMMAND_OBJECT, 0, address, data, length);
+    }
+}
+
+static void cgbl_video_object_write(cgbl_context_t *const context, uint8_t address, uint8_t data) {
+    cgbl_video_object_copy(context, address, &data, 1);
+}
+
+static void cgbl_video_palette_write(cgbl_context_t *const context, uint16_t address, uint8_t index, uint8_t data) {
+    cgbl_video_palette_store(&context->video, address, index, data);
+    if (context->video.thread) {
+        cgbl_video_thread_push(context->video.thread, &(cgbl_command_t){ .type = CGBL_COMMAND_PALETTE,
+                                                                          .write = { .address = address, .data = data, .index = index } });
+    }
+}
+
+static void cgbl_video_ram_copy(cgbl_context_t *const context, uint8_t bank, uint16_t address, const uint8_t *const data, uint16_t length) {
+    if (context->video.thread) {
+        memcpy(&context->video.ram.data[bank][address], data, length);
+        cgbl_video_thread_copy(context->video.thread, CGBL_COMMAND_RAM, bank, address, data, length);
+    } else {
+        cgbl_video_ram_store(&context->video, bank, address, data, length);
+    }
+}
+
+static void cgbl_video_ram_write(cgbl_context_t *const context, uint8_t bank, uint16_t address, uint8_t data) {
+    cgbl_video_ram_copy(context, bank, address, &data, 1);
+}
+
+static void cgbl_video_thread_frame(cgbl_context_t *const context) {
+    cgbl_video_thread_t *thread = context->video.thread;
+    cgbl_video_thread_push(thread, &(cgbl_command_t){ .type = CGBL_COMMAND_FRAME });
+    if (thread->count++) {
+        cgbl_video_thread_wait(thread, &thread->frame, thread->count - 1);
+        for (uint8_t y = 0; y < CGBL_VIDEO_HEIGHT; ++y) {
+            if (memcmp(context->video.pixel.data[y], thread->output[(thread->count - 2) & 1][y], sizeof(*context->video.pixel.data))) {
+                memcpy(context->video.pixel.data[y], thread->output[(thread->count - 2) & 1][y], sizeof(*context->video.pixel.data));
+                context->video.frame.dirty[y] = true;
             }
         }
-        --video.transfer.object.delay;
     }
 }
 
-static void cgbl_video_hblank(void) {
-    video.status.state = CGBL_STATE_HBLANK;
-    if (video.control.enabled) {
-        if ((cgbl_bus_mode() == CGBL_MODE_CGB) && video.transfer.active) {
-            cgbl_video_transfer_hblank();
+static void cgbl_video_thread_reset(cgbl_context_t *const context) {
+    cgbl_video_thread_t *thread = context->video.thread;
+    if (thread && !context->option.thread) {
+        cgbl_video_destroy(context);
+        thread = NULL;
+    } else if (!thread && context->option.thread && (cgbl_buffer_allocate((uint8_t **)&thread, sizeof(*thread)) == CGBL_SUCCESS)) {
+        atomic_store(&thread->active, true);
+        if ((mtx_init(&thread->lock, mtx_plain) != thrd_success) || (cnd_init(&thread->done) != thrd_success) ||
+            (cnd_init(&thread->work) != thrd_success) || (thrd_create(&thread->handle, cgbl_video_thread_worker, thread) != thrd_success)) {
+            cgbl_buffer_free((uint8_t *)thread);
+            thread = NULL;
         }
-        if (video.status.interrupt_hblank) {
-            cgbl_processor_interrupt(CGBL_INTERRUPT_SCREEN);
+    }
+    if ((context->video.thread = thread)) {
+        cgbl_video_thread_signal(thread, &thread->work);
+        cgbl_video_thread_wait(thread, &thread->head, atomic_load_explicit(&thread->tail, memory_order_relaxed));
+        thread->count = 0;
+        atomic_store(&thread->frame, 0);
+        thread->shadow = context->video;
+        thread->shadow.thread = NULL;
+    }
+}
+
+static void cgbl_video_render(cgbl_context_t *const context, uint8_t x) {
+    if (context->video.render.pending && (x > context->video.render.x)) {
+        if (context->video.thread) {
+            cgbl_video_thread_push(context->video.thread, &(cgbl_command_t){ .type = CGBL_COMMAND_LINE,
+                                                                              .line = { .begin = context->video.render.x,
+                                                                                        .control = context->video.control.raw,
+                                                                                        .end = x,
+                                                                                        .mode = cgbl_bus_mode(context),
+                                                                                        .scroll_x = context->video.scroll.x,
+                                                                                        .scroll_y = context->video.scroll.y,
+                                                                                        .shown = context->video.object.shown,
+                                                                                        .window_counter = context->video.window.counter,
+                                                                                        .window_x = context->video.window.x,
+                                                                                        .window_y = context->video.window.y,
+                                                                                        .y = context->video.line.y } });
+        } else {
+            cgbl_video_compose(&context->video, cgbl_bus_mode(context), context->video.render.x, x);
         }
+        context->video.render.pending = (x < CGBL_VIDEO_WIDTH);
+        context->video.render.x = x;
     }
 }
 
-static void cgbl_video_search(void) {
-    video.status.state = CGBL_STATE_SEARCH;
-    if (video.control.enabled) {
-        if (video.control.object_enabled) {
-            if ((cgbl_bus_mode() == CGBL_MODE_CGB) && (cgbl_bus_priority() == CGBL_PRIORITY_CGB)) {
-                cgbl_video_cgb_object_search();
-            } else {
-                cgbl_video_dmg_object_search();
-            }
+static void cgbl_video_render_sync(cgbl_context_t *const context) {
+    if (context->video.status.state == CGBL_STATE_TRANSFER) {
+        cgbl_video_render(context, (context->video.line.x < (80 + CGBL_VIDEO_WIDTH)) ? (context->video.line.x - 80) : CGBL_VIDEO_WIDTH);
+    }
+}
+
+static void cgbl_video_transfer_block(cgbl_context_t *const context, uint8_t bank, uint16_t destination, uint16_t source) {
+    uint8_t data[16];
+    const uint8_t *page = cgbl_bus_page(context, source);
+    if (page) {
+        memcpy(data, page, sizeof(data));
+    } else {
+        for (uint8_t index = 0; index < sizeof(data); ++index) {
+            data[index] = cgbl_bus_read(context, source + index);
         }
-        if (video.status.interrupt_search) {
-            cgbl_processor_interrupt(CGBL_INTERRUPT_SCREEN);
+    }
+    cgbl_video_ram_copy(context, bank, destination & 0x1FF0, data, sizeof(data));
+    cgbl_bus_invalidate(context, CGBL_VIDEO_RAM_BEGIN + (destination & 0x1FF0));
+}
+
+static void cgbl_video_transfer_hblank(cgbl_context_t *const context) {
+    if (!cgbl_processor_halted(context)) {
+        cgbl_video_transfer_block(context, (cgbl_bus_mode(context) == CGBL_MODE_CGB) ? context->video.ram.bank.select : 0,
+                                  context->video.transfer.destination.word + context->video.transfer.offset,
+                                  context->video.transfer.source.word + context->video.transfer.offset);
+        context->video.transfer.offset += 16;
+        if (!--context->video.transfer.control.length) {
+            context->video.transfer.active = false;
+            context->video.transfer.offset = 0;
+            context->video.transfer.control.raw = 0xFF;
         }
     }
 }
 
-static void cgbl_video_transfer(void) {
-    video.status.state = CGBL_STATE_TRANSFER;
-    if (video.control.enabled && video.shown) {
-        cgbl_mode_e mode = cgbl_bus_mode();
-        if (mode == CGBL_MODE_CGB) {
-            cgbl_video_cgb_background_render();
-        } else if (video.control.background_enabled) {
-            cgbl_video_dmg_background_render();
+static void cgbl_video_transfer_immediate(cgbl_context_t *const context) {
+    uint8_t bank = (cgbl_bus_mode(context) == CGBL_MODE_CGB) ? context->video.ram.bank.select : 0;
+    for (uint16_t offset = 0; offset < (context->video.transfer.control.length * 16); offset += 16) {
+        cgbl_video_transfer_block(context, bank, context->video.transfer.destination.word + offset,
+                                  context->video.transfer.source.word + offset);
+    }
+    context->video.transfer.control.raw = 0xFF;
+}
+
+static void cgbl_video_transfer_objects(cgbl_context_t *const context) {
+    if (context->video.transfer.object.destination) {
+        if (!context->video.transfer.object.delay) {
+            context->video.transfer.object.delay = 4;
+            cgbl_video_render_sync(context);
+            cgbl_video_object_write(context, context->video.transfer.object.destination++ - CGBL_VIDEO_RAM_OBJECT_BEGIN,
+                                    cgbl_bus_read(context, context->video.transfer.object.source++));
+            if (context->video.transfer.object.destination > CGBL_VIDEO_RAM_OBJECT_END) {
+                context->video.transfer.object.delay = 0;
+                context->video.transfer.object.destination = 0;
+                context->video.transfer.object.source = 0;
+                return;
+            }
         }
-        if (video.control.object_enabled) {
-            if (mode == CGBL_MODE_CGB) {
-                cgbl_video_cgb_object_render();
-            } else {
-                cgbl_video_dmg_object_render();
+        --context->video.transfer.object.delay;
+    }
+}
+
+static void cgbl_video_transfer_objects_skip(cgbl_context_t *const context, uint32_t cycles) {
+    if (cycles > context->video.transfer.object.delay) {
+        uint32_t count = ((cycles - context->video.transfer.object.delay - 1) / 4) + 1,
+                 remaining = CGBL_VIDEO_RAM_OBJECT_END + 1 - context->video.transfer.object.destination;
+        uint8_t data[CGBL_WIDTH(CGBL_VIDEO_RAM_OBJECT_BEGIN, CGBL_VIDEO_RAM_OBJECT_END)];
+        const uint8_t *page = cgbl_bus_page(context, context->video.transfer.object.source);
+        if (count > remaining) {
+            count = remaining;
+        }
+        if (page && (((context->video.transfer.object.source & 0xFF) + count) <= 0x100)) {
+            memcpy(data, page, count);
+        } else {
+            for (uint32_t index = 0; index < count; ++index) {
+                data[index] = cgbl_bus_read(context, context->video.transfer.object.source + index);
             }
         }
+        cgbl_video_object_copy(context, context->video.transfer.object.destination - CGBL_VIDEO_RAM_OBJECT_BEGIN, data, count);
+        if (count == remaining) {
+            context->video.transfer.object.delay = 0;
+            context->video.transfer.object.destination = 0;
+            context->video.transfer.object.source = 0;
+        } else {
+            context->video.transfer.object.delay = 4 - (cycles - context->video.transfer.object.delay - (4 * (count - 1)));
+            context->video.transfer.object.destination += count;
+            context->video.transfer.object.source += count;
+        }
+    } else {
+        context->video.transfer.object.delay -= cycles;
     }
 }
 
-static void cgbl_video_vblank(void) {
-    video.status.state = CGBL_STATE_VBLANK;
-    if (video.control.enabled) {
-        if (video.status.interrupt_vblank) {
-            cgbl_processor_interrupt(CGBL_INTERRUPT_SCREEN);
+static uint32_t cgbl_video_event(cgbl_context_t *const context, uint8_t speed) {
+    uint32_t result = 0;
+    if (context->video.line.x &&
+        (!context->video.control.enabled || (context->video.status.coincidence == cgbl_video_coincidence_check(context)))) {
+        if (context->video.line.x <= 80) {
+            result = 80 - context->video.line.x;
+        } else if (context->video.line.x <= 240) {
+            result = 240 - context->video.line.x;
+        } else {
+            result = 455 - context->video.line.x;
         }
-        cgbl_processor_interrupt(CGBL_INTERRUPT_VBLANK);
     }
+    if (context->video.transfer.object.destination && context->video.render.pending &&
+        ((context->video.transfer.object.delay / speed) < result)) {
+        result = context->video.transfer.object.delay / speed;
+    }
+    return result;
 }
 
-const uint16_t (*cgbl_video_color(void)) [CGBL_VIDEO_HEIGHT][CGBL_VIDEO_WIDTH] { return &video.pixel.data; }
+static void cgbl_video_frame(cgbl_context_t *const context) {
+    uint32_t skip = context->option.skip;
+    context->video.frame.skipped = (skip == CGBL_VIDEO_SKIP_ALL) || (context->video.frame.counter++ % (skip + 1));
+}
+
+static void cgbl_video_hblank(cgbl_context_t *const context) {
+    cgbl_video_render(context, CGBL_VIDEO_WIDTH);
+    context->video.status.state = CGBL_STATE_HBLANK;
+    cgbl_video_map(context);
+    if (context->video.control.enabled) {
+        if ((cgbl_bus_mode(context) == CGBL_MODE_CGB) && context->video.transfer.active) {
+            cgbl_video_transfer_hblank(context);
+        }
+        if (context->video.status.interrupt_hblank) {
+            cgbl_processor_interrupt(context, CGBL_INTERRUPT_SCREEN);
+        }
+    }
+}
+
+static void cgbl_video_search(cgbl_context_t *const context) {
+    context->video.status.state = CGBL_STATE_SEARCH;
+    if (context->video.control.enabled) {
+        if (context->video.control.object_enabled) {
+            cgbl_video_object_search(context,
+                                     (cgbl_bus_mode(context) != CGBL_MODE_CGB) || (cgbl_bus_priority(context) != CGBL_PRIORITY_CGB));
+        }
+        if (context->video.status.interrupt_search) {
+            cgbl_processor_interrupt(context, CGBL_INTERRUPT_SCREEN);
+        }
+    }
+}
+
+static void cgbl_video_transfer(cgbl_context_t *const context) {
+    context->video.status.state = CGBL_STATE_TRANSFER;
+    cgbl_video_map(context);
+    context->video.render.pending = context->video.control.enabled && context->video.shown && !context->video.frame.skipped;
+    context->video.render.x = 0;
+}
 
-uint8_t cgbl_video_read(uint16_t address) {
+static void cgbl_video_vblank(cgbl_context_t *const context) {
+    context->video.status.state = CGBL_STATE_VBLANK;
+    if (context->video.control.enabled) {
+        if (context->video.status.interrupt_vblank) {
+            cgbl_processor_interrupt(context, CGBL_INTERRUPT_SCREEN);
+        }
+        cgbl_processor_interrupt(context, CGBL_INTERRUPT_VBLANK);
+    }
+}
+
+const uint16_t (*cgbl_video_color(cgbl_context_t *const context))[CGBL_VIDEO_HEIGHT][CGBL_VIDEO_WIDTH] {
+    return &context->video.pixel.data;
+}
+
+void cgbl_video_destroy(cgbl_context_t *const context) {
+    if (context->video.thread) {
+        atomic_store(&context->video.thread->active, false);
+        cgbl_video_thread_signal(context->video.thread, &context->video.thread->work);
+        thrd_join(context->video.thread->handle, NULL);
+        cnd_destroy(&context->video.thread->done);
+        cnd_destroy(&context->video.thread->work);
+        mtx_destroy(&context->video.thread->lock);
+        cgbl_buffer_free((uint8_t *)context->video.thread);
+        context->video.thread = NULL;
+    }
+}
+
+bool cgbl_video_dirty(cgbl_context_t *const context, uint8_t *const begin, uint8_t *const end) {
+    *begin = CGBL_VIDEO_HEIGHT;
+    *end = 0;
+    for (uint8_t y = 0; y < CGBL_VIDEO_HEIGHT; ++y) {
+        if (context->video.frame.dirty[y]) {
+            if (*begin == CGBL_VIDEO_HEIGHT) {
+                *begin = y;
+            }
+            *end = y + 1;
+        }
+    }
+    memset(&context->video.frame.dirty, false, sizeof(context->video.frame.dirty));
+    return *end > *begin;
+}
+
+void cgbl_video_map(cgbl_context_t *const context) {
+    uint8_t *map = NULL, *ram = NULL;
+    if (!context->video.control.enabled || (context->video.status.state < CGBL_STATE_TRANSFER)) {
+        ram = context->video.ram.data[(cgbl_bus_mode(context) == CGBL_MODE_CGB) ? context->video.ram.bank.select : 0];
+        map = ram + (CGBL_VIDEO_RAM_MAP_BEGIN - CGBL_VIDEO_RAM_BEGIN);
+    }
+    cgbl_bus_map(context, CGBL_VIDEO_RAM_BEGIN, CGBL_VIDEO_RAM_TILE_END, ram, NULL);
+    cgbl_bus_map(context, CGBL_VIDEO_RAM_MAP_BEGIN, CGBL_VIDEO_RAM_END, map, context->video.thread ? NULL : map);
+}
+
+uint8_t cgbl_video_read(cgbl_context_t *const context, uint16_t address) {
     uint8_t result = 0xFF;
     switch (address) {
     case CGBL_VIDEO_CONTROL:
-        result = video.control.raw;
-        if (!video.control.enabled) {
-            video.shown = false;
+        result = context->video.control.raw;
+        if (!context->video.control.enabled) {
+            context->video.shown = false;
         }
+        cgbl_video_map(context);
         break;
     case CGBL_VIDEO_LINE_Y:
-        result = video.line.y;
+        result = context->video.line.y;
         break;
     case CGBL_VIDEO_LINE_Y_COINCIDENCE:
-        result = video.line.coincidence;
+        result = context->video.line.coincidence;
         break;
     case CGBL_VIDEO_PALETTE_BACKGROUND:
-        result = video.background.color.palette.raw;
+        result = context->video.background.color.palette.raw;
         break;
     case CGBL_VIDEO_PALETTE_BACKGROUND_CONTROL:
-        if (cgbl_bus_mode() == CGBL_MODE_CGB) {
-            result = video.background.control.raw;
+        if (cgbl_bus_mode(context) == CGBL_MODE_CGB) {
+            result = context->video.background.control.raw;
         }
         break;
     case CGBL_VIDEO_PALETTE_BACKGROUND_DATA:
-        if ((cgbl_bus_mode() == CGBL_MODE_CGB) && (!video.control.enabled || (video.status.state < CGBL_STATE_TRANSFER))) {
-            result = ((uint8_t *)video.background.color.cgb)[video.background.control.address];
+        if ((cgbl_bus_mode(context) == CGBL_MODE_CGB) &&
+            (!context->video.control.enabled || (context->video.status.state < CGBL_STATE_TRANSFER))) {
+            result = ((uint8_t *)context->video.background.color.cgb)[context->video.background.control.address];
         }
         break;
     case CGBL_VIDEO_PALETTE_OBJECT_0:
-        result = video.object.color.palette[0].raw;
+        result = context->video.object.color.palette[0].raw;
         break;
     case CGBL_VIDEO_PALETTE_OBJECT_1:
-        result = video.object.color.palette[1].raw;
+        result = context->video.object.color.palette[1].raw;
         break;
     case CGBL_VIDEO_PALETTE_OBJECT_CONTROL:
-        if (cgbl_bus_mode() == CGBL_MODE_CGB) {
-            result = video.object.control.raw;
+        if (cgbl_bus_mode(context) == CGBL_MODE_CGB) {
+            result = context->video.object.control.raw;
         }
         break;
     case CGBL_VIDEO_PALETTE_OBJECT_DATA:
-        if ((cgbl_bus_mode() == CGBL_MODE_CGB) && (!video.control.enabled || (video.status.state < CGBL_STATE_TRANSFER))) {
-            result = ((uint8_t *)video.object.color.cgb)[video.object.control.address];
+        if ((cgbl_bus_mode(context) == CGBL_MODE_CGB) &&
+            (!context->video.control.enabled || (context->video.status.state < CGBL_STATE_TRANSFER))) {
+            result = ((uint8_t *)context->video.object.color.cgb)[context->video.object.control.address];
         }
         break;
     case CGBL_VIDEO_RAM_BEGIN ... CGBL_VIDEO_RAM_END:
-        if (!video.control.enabled || (video.status.state < CGBL_STATE_TRANSFER)) {
-            result = video.ram.data[(cgbl_bus_mode() == CGBL_MODE_CGB) ? video.ram.bank.select : 0][address - CGBL_VIDEO_RAM_BEGIN];
+        if (!context->video.control.enabled || (context->video.status.state < CGBL_STATE_TRANSFER)) {
+            result = context->video.ram.data[(cgbl_bus_mode(context) == CGBL_MODE_CGB) ? context->video.ram.bank.select : 0]
+                                            [address - CGBL_VIDEO_RAM_BEGIN];
         }
         break;
     case CGBL_VIDEO_RAM_OBJECT_BEGIN ... CGBL_VIDEO_RAM_OBJECT_END:
-        if (!video.control.enabled || (video.status.state < CGBL_STATE_SEARCH)) {
-            result = ((uint8_t *)video.object.ram)[address - CGBL_VIDEO_RAM_OBJECT_BEGIN];
+        if (!context->video.control.enabled || (context->video.status.state < CGBL_STATE_SEARCH)) {
+            result = ((uint8_t *)context->video.object.ram)[address - CGBL_VIDEO_RAM_OBJECT_BEGIN];
         }
         break;
     case CGBL_VIDEO_RAM_SELECT:
-        if (cgbl_bus_mode() == CGBL_MODE_CGB) {
-            result = video.ram.bank.raw;
+        if (cgbl_bus_mode(context) == CGBL_MODE_CGB) {
+            result = context->video.ram.bank.raw;
         }
         break;
     case CGBL_VIDEO_SCROLL_X:
-        result = video.scroll.x;
+        result = context->video.scroll.x;
         break;
     case CGBL_VIDEO_SCROLL_Y:
-        result = video.scroll.y;
+        result = context->video.scroll.y;
         break;
     case CGBL_VIDEO_STATUS:
-        result = video.status.raw;
+        result = context->video.status.raw;
         break;
     case CGBL_VIDEO_TRANSFER_CONTROL:
-        if (cgbl_bus_mode() == CGBL_MODE_CGB) {
-            result = video.transfer.active ? 0x80 : 0;
+        if (cgbl_bus_mode(context) == CGBL_MODE_CGB) {
+            result = context->video.transfer.active ? 0x80 : 0;
         }
         break;
     case CGBL_VIDEO_TRANSFER_OBJECTS:
-        result = video.transfer.object.address;
+        result = context->video.transfer.object.address;
         break;
     case CGBL_VIDEO_WINDOW_X:
-        result = video.window.x;
+        result = context->video.window.x;
         break;
     case CGBL_VIDEO_WINDOW_Y:
-        result = video.window.y;
+        result = context->video.window.y;
         break;
     default:
         break;
@@ -739,166 +1193,198 @@ uint8_t cgbl_video_read(uint16_t address) {
     return result;
 }
 
-void cgbl_video_reset(void) {
-    memset(&video, 0, sizeof(video));
-    memset(&video.pixel.data, 0xFF, sizeof(video.pixel.data));
-    cgbl_video_dmg_palette_reset();
-    video.ram.bank.raw = 0xFE;
-    video.status.raw = 0x80 | CGBL_STATE_SEARCH;
+void cgbl_video_reset(cgbl_context_t *const context) {
+    cgbl_video_thread_t *thread = context->video.thread;
+    memset(&context->video, 0, sizeof(context->video));
+    context->video.thread = thread;
+    memset(&context->video.frame.dirty, true, sizeof(context->video.frame.dirty));
+    memset(&context->video.pixel.data, 0xFF, sizeof(context->video.pixel.data));
+    cgbl_video_dmg_palette_reset(context);
+    context->video.object.bucket.dirty = true;
+    context->video.ram.bank.raw = 0xFE;
+    context->video.status.raw = 0x80 | CGBL_STATE_SEARCH;
+    cgbl_video_frame(context);
+    cgbl_video_thread_reset(context);
+    cgbl_video_map(context);
 }
 
-cgbl_error_e cgbl_video_step(void) {
+cgbl_error_e cgbl_video_step(cgbl_context_t *const context, uint32_t cycles) {
     cgbl_error_e result = CGBL_SUCCESS;
-    cgbl_video_coincidence();
-    for (uint8_t cycle = 0; cycle < ((cgbl_bus_speed() == CGBL_SPEED_DOUBLE) ? 2 : 1); ++cycle) {
-        cgbl_video_transfer_objects();
-    }
-    if (video.line.y < 144) {
-        if (!video.line.x) {
-            cgbl_video_search();
-        } else if (video.line.x == 80) {
-            cgbl_video_transfer();
-        } else if (video.line.x == 240) {
-            cgbl_video_hblank();
+    uint8_t speed = (cgbl_bus_speed(context) == CGBL_SPEED_DOUBLE) ? 2 : 1;
+    while (cycles) {
+        uint32_t skip = cgbl_video_event(context, speed);
+        if (skip >= cycles) {
+            skip = cycles;
         }
-    } else if ((video.line.y == 144) && !video.line.x) {
-        cgbl_video_vblank();
-    }
-    if (++video.line.x == 456) {
-        video.line.x = 0;
-        if ((video.window.x <= 166) && (video.window.y <= 143)) {
-            ++video.window.counter;
+        context->video.line.x += skip;
+        if (context->video.transfer.object.destination) {
+            cgbl_video_transfer_objects_skip(context, skip * speed);
         }
-        if (++video.line.y == 154) {
-            video.line.y = 0;
-            video.shown = true;
-            video.window.counter = 0;
-            result = CGBL_COMPLETE;
+        if (!(cycles -= skip)) {
+            break;
         }
+        cgbl_video_coincidence(context);
+        for (uint8_t cycle = 0; cycle < speed; ++cycle) {
+            cgbl_video_transfer_objects(context);
+        }
+        if (context->video.line.y < 144) {
+            if (!context->video.line.x) {
+                cgbl_video_search(context);
+            } else if (context->video.line.x == 80) {
+                cgbl_video_transfer(context);
+            } else if (context->video.line.x == 240) {
+                cgbl_video_hblank(context);
+            }
+        } else if ((context->video.line.y == 144) && !context->video.line.x) {
+            cgbl_video_vblank(context);
+        }
+        if (++context->video.line.x == 456) {
+            context->video.line.x = 0;
+            if ((context->video.window.x <= 166) && (context->video.window.y <= 143)) {
+                ++context->video.window.counter;
+            }
+            if (++context->video.line.y == 154) {
+                context->video.line.y = 0;
+                context->video.shown = true;
+                context->video.window.counter = 0;
+                if (context->video.thread) {
+                    cgbl_video_thread_frame(context);
+                }
+                cgbl_video_frame(context);
+                result = CGBL_COMPLETE;
+            }
+        }
+        --cycles;
     }
+    cgbl_bus_schedule(context, CGBL_EVENT_VIDEO, cgbl_video_event(context, speed));
     return result;
 }
 
-void cgbl_video_write(uint16_t address, uint8_t data) {
+void cgbl_video_write(cgbl_context_t *const context, uint16_t address, uint8_t data) {
+    cgbl_video_render_sync(context);
     switch (address) {
     case CGBL_VIDEO_CONTROL:
-        video.control.raw = data;
-        if (!video.control.enabled) {
-            memset(&video.pixel, 0, sizeof(video.pixel));
-            memset(&video.pixel.data, 0xFF, sizeof(video.pixel.data));
-            video.shown = false;
+        context->video.control.raw = data;
+        if (!context->video.control.enabled) {
+            if (context->video.thread) {
+                cgbl_video_thread_push(context->video.thread, &(cgbl_command_t){ .type = CGBL_COMMAND_CLEAR });
+            }
+            context->video.render.pending = false;
+            cgbl_video_clear(&context->video);
+            context->video.shown = false;
         }
         break;
     case CGBL_VIDEO_LINE_Y_COINCIDENCE:
-        video.line.coincidence = data;
+        context->video.line.coincidence = data;
         break;
     case CGBL_VIDEO_PALETTE_BACKGROUND:
-        video.background.color.palette.raw = data;
+    case CGBL_VIDEO_PALETTE_OBJECT_0:
+    case CGBL_VIDEO_PALETTE_OBJECT_1:
+        cgbl_video_palette_write(context, address, 0, data);
         break;
     case CGBL_VIDEO_PALETTE_BACKGROUND_CONTROL:
-        if (cgbl_bus_mode() == CGBL_MODE_CGB) {
-            video.background.control.raw = (data & 0xBF) | 0x40;
+        if (cgbl_bus_mode(context) == CGBL_MODE_CGB) {
+            context->video.background.control.raw = (data & 0xBF) | 0x40;
         }
         break;
     case CGBL_VIDEO_PALETTE_BACKGROUND_DATA:
-        if ((cgbl_bus_mode() == CGBL_MODE_CGB) && (!video.control.enabled || (video.status.state < CGBL_STATE_TRANSFER))) {
-            ((uint8_t *)video.background.color.cgb)[video.background.control.address] = data;
-            if (video.background.control.increment) {
-                ++video.background.control.address;
+        if ((cgbl_bus_mode(context) == CGBL_MODE_CGB) &&
+            (!context->video.control.enabled || (context->video.status.state < CGBL_STATE_TRANSFER))) {
+            cgbl_video_palette_write(context, address, context->video.background.control.address, data);
+            if (context->video.background.control.increment) {
+                ++context->video.background.control.address;
             }
         }
         break;
-    case CGBL_VIDEO_PALETTE_OBJECT_0:
-        video.object.color.palette[0].raw = data;
-        break;
-    case CGBL_VIDEO_PALETTE_OBJECT_1:
-        video.object.color.palette[1].raw = data;
-        break;
     case CGBL_VIDEO_PALETTE_OBJECT_CONTROL:
-        if (cgbl_bus_mode() == CGBL_MODE_CGB) {
-            video.object.control.raw = (data & 0xBF) | 0x40;
+        if (cgbl_bus_mode(context) == CGBL_MODE_CGB) {
+            context->video.object.control.raw = (data & 0xBF) | 0x40;
         }
         break;
     case CGBL_VIDEO_PALETTE_OBJECT_DATA:
-        if ((cgbl_bus_mode() == CGBL_MODE_CGB) && (!video.control.enabled || (video.status.state < CGBL_STATE_TRANSFER))) {
-            ((uint8_t *)video.object.color.cgb)[video.object.control.address] = data;
-            if (video.object.control.increment) {
-                ++video.object.control.address;
+        if ((cgbl_bus_mode(context) == CGBL_MODE_CGB) &&
+            (!context->video.control.enabled || (context->video.status.state < CGBL_STATE_TRANSFER))) {
+            cgbl_video_palette_write(context, address, context->video.object.control.address, data);
+            if (context->video.object.control.increment) {
+                ++context->video.object.control.address;
             }
         }
         break;
     case CGBL_VIDEO_RAM_BEGIN ... CGBL_VIDEO_RAM_END:
-        if (!video.control.enabled || (video.status.state < CGBL_STATE_TRANSFER)) {
-            video.ram.data[(cgbl_bus_mode() == CGBL_MODE_CGB) ? video.ram.bank.select : 0][address - CGBL_VIDEO_RAM_BEGIN] = data;
+        if (!context->video.control.enabled || (context->video.status.state < CGBL_STATE_TRANSFER)) {
+            cgbl_video_ram_write(context, (cgbl_bus_mode(context) == CGBL_MODE_CGB) ? context->video.ram.bank.select : 0,
+                                 address - CGBL_VIDEO_RAM_BEGIN, data);
         }
         break;
     case CGBL_VIDEO_RAM_OBJECT_BEGIN ... CGBL_VIDEO_RAM_OBJECT_END:
-        if (!video.control.enabled || (video.status.state < CGBL_STATE_SEARCH)) {
-            ((uint8_t *)video.object.ram)[address - CGBL_VIDEO_RAM_OBJECT_BEGIN] = data;
+        if (!context->video.control.enabled || (context->video.status.state < CGBL_STATE_SEARCH)) {
+            cgbl_video_object_write(context, address - CGBL_VIDEO_RAM_OBJECT_BEGIN, data);
         }
         break;
     case CGBL_VIDEO_RAM_SELECT:
-        if (cgbl_bus_mode() == CGBL_MODE_CGB) {
-            video.ram.bank.raw = (data & 1) | 0xFE;
+        if (cgbl_bus_mode(context) == CGBL_MODE_CGB) {
+            context->video.ram.bank.raw = (data & 1) | 0xFE;
+            cgbl_video_map(context);
         }
         break;
     case CGBL_VIDEO_SCROLL_X:
-        video.scroll.x = data;
+        context->video.scroll.x = data;
         break;
     case CGBL_VIDEO_SCROLL_Y:
-        video.scroll.y = data;
+        context->video.scroll.y = data;
         break;
     case CGBL_VIDEO_STATUS:
-        video.status.raw = (data & 0x78) | 0x80;
+        context->video.status.raw = (data & 0x78) | 0x80;
+        cgbl_video_map(context);
         break;
     case CGBL_VIDEO_TRANSFER_CONTROL:
-        if (cgbl_bus_mode() == CGBL_MODE_CGB) {
-            bool hblank = video.transfer.control.hblank;
-            video.transfer.control.raw = data;
-            if (video.transfer.control.hblank && !video.transfer.active) {
-                video.transfer.active = true;
+        if (cgbl_bus_mode(context) == CGBL_MODE_CGB) {
+            bool hblank = context->video.transfer.control.hblank;
+            context->video.transfer.control.raw = data;
+            if (context->video.transfer.control.hblank && !context->video.transfer.active) {
+                context->video.transfer.active = true;
             } else {
-                if (hblank && video.transfer.active) {
-                    video.transfer.active = false;
-                    video.transfer.offset = 0;
-                    video.transfer.control.raw = 0xFF;
+                if (hblank && context->video.transfer.active) {
+                    context->video.transfer.active = false;
+                    context->video.transfer.offset = 0;
+                    context->video.transfer.control.raw = 0xFF;
                 } else {
-                    cgbl_video_transfer_immediate();
+                    cgbl_video_transfer_immediate(context);
                 }
             }
         }
         break;
     case CGBL_VIDEO_TRANSFER_DESTINATION_HIGH:
-        if (cgbl_bus_mode() == CGBL_MODE_CGB) {
-            video.transfer.destination.high = data & 0x1F;
+        if (cgbl_bus_mode(context) == CGBL_MODE_CGB) {
+            context->video.transfer.destination.high = data & 0x1F;
         }
         break;
     case CGBL_VIDEO_TRANSFER_DESTINATION_LOW:
-        if (cgbl_bus_mode() == CGBL_MODE_CGB) {
-            video.transfer.destination.low = data & 0xF0;
+        if (cgbl_bus_mode(context) == CGBL_MODE_CGB) {
+            context->video.transfer.destination.low = data & 0xF0;
         }
         break;
     case CGBL_VIDEO_TRANSFER_OBJECTS:
-        video.transfer.object.address = data;
-        video.transfer.object.delay = 4;
-        video.transfer.object.destination = CGBL_VIDEO_RAM_OBJECT_BEGIN;
-        video.transfer.object.source = video.transfer.object.address << 8;
+        context->video.transfer.object.address = data;
+        context->video.transfer.object.delay = 4;
+        context->video.transfer.object.destination = CGBL_VIDEO_RAM_OBJECT_BEGIN;
+        context->video.transfer.object.source = context->video.transfer.object.address << 8;
         break;
     case CGBL_VIDEO_TRANSFER_SOURCE_HIGH:
-        if (cgbl_bus_mode() == CGBL_MODE_CGB) {
-            video.transfer.source.high = data;
+        if (cgbl_bus_mode(context) == CGBL_MODE_CGB) {
+            context->video.transfer.source.high = data;
         }
         break;
     case CGBL_VIDEO_TRANSFER_SOURCE_LOW:
-        if (cgbl_bus_mode() == CGBL_MODE_CGB) {
-            video.transfer.source.low = data & 0xF0;
+        if (cgbl_bus_mode(context) == CGBL_MODE_CGB) {
+            context->video.transfer.source.low = data & 0xF0;
         }
         break;
     case CGBL_VIDEO_WINDOW_X:
-        video.window.x = data;
+        context->video.window.x = data;
         break;
     case CGBL_VIDEO_WINDOW_Y:
-        video.window.y = data;
+        context->video.window.y = data;
         break;
     default:
         break;
@@ -9,7 +9,6 @@
 #include "bus.h"
 
 #define CGBL_VIDEO_CONTROL 0xFF40
-#define CGBL_VIDEO_HEIGHT 144
 #define CGBL_VIDEO_LINE_Y 0xFF44
 #define CGBL_VIDEO_LINE_Y_COINCIDENCE 0xFF45
 #define CGBL_VIDEO_PALETTE_BACKGROUND 0xFF47
@@ -21,9 +20,11 @@
 #define CGBL_VIDEO_PALETTE_OBJECT_DATA 0xFF6B
 #define CGBL_VIDEO_RAM_BEGIN 0x8000
 #define CGBL_VIDEO_RAM_END 0x9FFF
+#define CGBL_VIDEO_RAM_MAP_BEGIN 0x9800
 #define CGBL_VIDEO_RAM_OBJECT_BEGIN 0xFE00
 #define CGBL_VIDEO_RAM_OBJECT_END 0xFE9F
 #define CGBL_VIDEO_RAM_SELECT 0xFF4F
+#define CGBL_VIDEO_RAM_TILE_END 0x97FF
 #define CGBL_VIDEO_SCROLL_X 0xFF43
 #define CGBL_VIDEO_SCROLL_Y 0xFF42
 #define CGBL_VIDEO_STATUS 0xFF41
@@ -33,17 +34,208 @@
 #define CGBL_VIDEO_TRANSFER_OBJECTS 0xFF46
 #define CGBL_VIDEO_TRANSFER_SOURCE_HIGH 0xFF51
 #define CGBL_VIDEO_TRANSFER_SOURCE_LOW 0xFF52
-#define CGBL_VIDEO_WIDTH 160
 #define CGBL_VIDEO_WINDOW_X 0xFF4B
 #define CGBL_VIDEO_WINDOW_Y 0xFF4A
 
 #define CGBL_VIDEO_RAM_WIDTH CGBL_WIDTH(CGBL_VIDEO_RAM_BEGIN, CGBL_VIDEO_RAM_END)
 #define CGBL_VIDEO_RAM_OBJECT_WIDTH (CGBL_WIDTH(CGBL_VIDEO_RAM_OBJECT_BEGIN, CGBL_VIDEO_RAM_OBJECT_END) / sizeof(cgbl_object_t))
+#define CGBL_VIDEO_RAM_TILE_WIDTH (CGBL_WIDTH(CGBL_VIDEO_RAM_BEGIN, CGBL_VIDEO_RAM_TILE_END) / 16)
 
-const uint16_t (*cgbl_video_color(void))[CGBL_VIDEO_HEIGHT][CGBL_VIDEO_WIDTH];
-uint8_t cgbl_video_read(uint16_t address);
-void cgbl_video_reset(void);
-cgbl_error_e cgbl_video_step(void);
-void cgbl_video_write(uint16_t address, uint8_t data);
+typedef struct cgbl_video_thread_s cgbl_video_thread_t;
+
+typedef enum {
+    CGBL_COLOR_WHITE = 0,
+    CGBL_COLOR_GREY_LIGHT,
+    CGBL_COLOR_GREY_DARK,
+    CGBL_COLOR_BLACK,
+    CGBL_COLOR_MAX
+} cgbl_color_e;
+
+typedef struct {
+    uint16_t data[8][CGBL_COLOR_MAX];
+    uint8_t high[8][CGBL_COLOR_MAX];
+    uint8_t low[8][CGBL_COLOR_MAX];
+} cgbl_lookup_t;
+
+typedef struct {
+    uint8_t y;
+    uint8_t x;
+    uint8_t id;
+    struct {
+        uint8_t palette : 3;
+        uint8_t bank : 1;
+        uint8_t palette_dmg : 1;
+        uint8_t flip_x : 1;
+        uint8_t flip_y : 1;
+        uint8_t priority : 1;
+    } attribute;
+} cgbl_object_t;
+
+typedef struct {
+    uint8_t count;
+    uint8_t index[10];
+} cgbl_object_list_t;
+
+typedef union {
+    uint8_t raw;
+    struct {
+        uint8_t white : 2;
+        uint8_t grey_light : 2;
+        uint8_t grey_dark : 2;
+        uint8_t black : 2;
+    };
+} cgbl_palette_t;
+
+typedef struct {
+    bool shown;
+    struct {
+        union {
+            uint8_t raw;
+            struct {
+                uint8_t address : 6;
+                uint8_t : 1;
+                uint8_t increment : 1;
+            };
+        } control;
+        struct {
+            uint16_t cgb[8][CGBL_COLOR_MAX];
+            const uint16_t *dmg;
+            struct {
+                cgbl_lookup_t cgb;
+                cgbl_lookup_t dmg;
+                uint8_t map[16];
+            } host;
+            cgbl_palette_t palette;
+        } color;
+    } background;
+    union {
+        uint8_t raw;
+        struct {
+            uint8_t background_enabled : 1;
+            uint8_t object_enabled : 1;
+            uint8_t object_size : 1;
+            uint8_t background_map : 1;
+            uint8_t background_data : 1;
+            uint8_t window_enabled : 1;
+            uint8_t window_map : 1;
+            uint8_t enabled : 1;
+        };
+    } control;
+    struct {
+        uint8_t coincidence;
+        uint16_t x;
+        uint8_t y;
+    } line;
+    struct {
+        cgbl_object_t ram[CGBL_VIDEO_RAM_OBJECT_WIDTH];
+        union {
+            uint8_t raw;
+            struct {
+                uint8_t address : 6;
+                uint8_t : 1;
+                uint8_t increment : 1;
+            };
+        } control;
+        struct {
+            uint16_t cgb[8][CGBL_COLOR_MAX];
+            const uint16_t *dmg[2];
+            struct {
+                cgbl_lookup_t cgb;
+                cgbl_lookup_t dmg;
+            } host;
+            cgbl_palette_t palette[2];
+        } color;
+        struct {
+            bool dirty;
+            cgbl_object_list_t line[CGBL_VIDEO_HEIGHT];
+            uint8_t size;
+            bool sorted;
+        } bucket;
+        cgbl_object_list_t shown;
+    } object;
+    struct {
+        uint16_t data[CGBL_VIDEO_HEIGHT][CGBL_VIDEO_WIDTH];
+    } pixel;
+    struct {
+        bool pending;
+        uint8_t x;
+    } render;
+    struct {
+        uint8_t data[2][CGBL_VIDEO_RAM_WIDTH];
+        uint16_t tile[2][CGBL_VIDEO_RAM_TILE_WIDTH][8];
+        union {
+            uint8_t raw;
+            struct {
+                uint8_t select : 1;
+            };
+        } bank;
+    } ram;
+    struct {
+        uint8_t x;
+        uint8_t y;
+    } scroll;
+    union {
+        uint8_t raw;
+        struct {
+            uint8_t state : 2;
+            uint8_t coincidence : 1;
+            uint8_t interrupt_hblank : 1;
+            uint8_t interrupt_vblank : 1;
+            uint8_t interrupt_search : 1;
+            uint8_t interrupt_coincidence : 1;
+        };
+    } status;
+    struct {
+        bool active;
+        uint16_t offset;
+        union {
+            uint8_t raw;
+            struct {
+                uint8_t length : 7;
+                uint8_t hblank : 1;
+            };
+        } control;
+        union {
+            uint16_t word;
+            struct {
+                uint8_t low;
+                uint8_t high;
+            };
+        } destination;
+        union {
+            uint16_t word;
+            struct {
+                uint8_t low;
+                uint8_t high;
+            };
+        } source;
+        struct {
+            uint8_t address;
+            uint8_t delay;
+            uint16_t destination;
+            uint16_t source;
+        } object;
+    } transfer;
+    cgbl_video_thread_t *thread;
+    struct {
+        uint8_t counter;
+        uint8_t x;
+        uint8_t y;
+    } window;
+    struct {
+        uint32_t counter;
+        bool dirty[CGBL_VIDEO_HEIGHT];
+        bool skipped;
+    } frame;
+} cgbl_video_t;
+
+const uint16_t (*cgbl_video_color(cgbl_context_t *const context))[CGBL_VIDEO_HEIGHT][CGBL_VIDEO_WIDTH];
+void cgbl_video_destroy(cgbl_context_t *const context);
+bool cgbl_video_dirty(cgbl_context_t *const context, uint8_t *const begin, uint8_t *const end);
+void cgbl_video_map(cgbl_context_t *const context);
+uint8_t cgbl_video_read(cgbl_context_t *const context, uint16_t address);
+void cgbl_video_reset(cgbl_context_t *const context);
+cgbl_error_e cgbl_video_step(cgbl_context_t *const context, uint32_t cycles);
+void cgbl_video_write(cgbl_context_t *const context, uint16_t address, uint8_t data);
 
 #endif /* CGBL_VIDEO_H_ */
@@ -9,6 +9,24 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#define CGBL_AUDIO_SAMPLES 798
+#define CGBL_EXPORT __attribute__((visibility("default")))
+#define CGBL_VIDEO_HEIGHT 144
+#define CGBL_VIDEO_SKIP_ALL UINT32_MAX
+#define CGBL_VIDEO_WIDTH 160
+
+typedef enum {
+    CGBL_BUTTON_A = 0,
+    CGBL_BUTTON_B,
+    CGBL_BUTTON_SELECT,
+    CGBL_BUTTON_START,
+    CGBL_BUTTON_RIGHT,
+    CGBL_BUTTON_LEFT,
+    CGBL_BUTTON_UP,
+    CGBL_BUTTON_DOWN,
+    CGBL_BUTTON_MAX
+} cgbl_button_e;
+
 typedef enum {
     CGBL_SUCCESS = 0,
     CGBL_FAILURE,
@@ -16,10 +34,21 @@ typedef enum {
     CGBL_COMPLETE
 } cgbl_error_e;
 
+typedef struct cgbl_context_s cgbl_context_t;
+
 typedef struct {
+    bool batch;
     bool debug;
     bool fullscreen;
+    bool thread;
     uint8_t scale;
+    uint32_t frames;
+    uint32_t skip;
+    const char *input;
+    struct {
+        const char *audio;
+        const char *video;
+    } output;
 } cgbl_option_t;
 
 typedef struct {
@@ -28,8 +57,24 @@ typedef struct {
     uint32_t patch;
 } cgbl_version_t;
 
-cgbl_error_e cgbl_entry(const char *const path, const cgbl_option_t *const option);
-const char *cgbl_error(void);
-const cgbl_version_t *cgbl_version(void);
+CGBL_EXPORT cgbl_error_e cgbl_create(cgbl_context_t **const context);
+CGBL_EXPORT void cgbl_destroy(cgbl_context_t *const context);
+CGBL_EXPORT const char *cgbl_error(void);
+CGBL_EXPORT const float (*cgbl_get_audio(cgbl_context_t *const context))[CGBL_AUDIO_SAMPLES];
+CGBL_EXPORT uint64_t cgbl_get_cycles(cgbl_context_t *const context);
+/* With the render thread enabled, this holds the frame completed before the most recent one. */
+CGBL_EXPORT const uint16_t (*cgbl_get_framebuffer(cgbl_context_t *const context))[CGBL_VIDEO_HEIGHT][CGBL_VIDEO_WIDTH];
+CGBL_EXPORT const uint8_t *cgbl_get_serial(cgbl_context_t *const context, uint32_t *const length);
+/* Path is copied; the ROM and its save RAM are loaded, then the context is reset. */
+CGBL_EXPORT cgbl_error_e cgbl_load_rom(cgbl_context_t *const context, const char *const path);
+CGBL_EXPORT cgbl_error_e cgbl_reset(cgbl_context_t *const context);
+CGBL_EXPORT cgbl_error_e cgbl_run_frames(cgbl_context_t *const context, uint32_t frames);
+CGBL_EXPORT void cgbl_set_buttons(cgbl_context_t *const context, const bool (*const buttons)[CGBL_BUTTON_MAX]);
+/*
+ * Option is copied, but the input and output strings it points to are borrowed and must outlive the context.
+ * Skip applies from the next frame; debug and thread apply from the next reset or ROM load.
+ */
+CGBL_EXPORT void cgbl_set_option(cgbl_context_t *const context, const cgbl_option_t *const option);
+CGBL_EXPORT const cgbl_version_t *cgbl_version(void);
 
 #endif /* CGBL_H_ */
@@ -14,7 +14,7 @@
 #define CGBL_CLIENT_SCALE_MIN 1
 #define CGBL_CLIENT_VSYNC false
 
-cgbl_error_e cgbl_client_create(uint8_t scale, bool fullscreen);
+cgbl_error_e cgbl_client_create(cgbl_context_t *const context, const cgbl_option_t *const option);
 void cgbl_client_destroy(void);
 cgbl_error_e cgbl_client_poll(void);
 cgbl_error_e cgbl_client_sync(void);
@@ -0,0 +1,165 @@
+/*
+ * SPDX-FileCopyrightText: 2025 David Jolly <jolly.a.david@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifdef CLIENT_none
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "audio.h"
+#include "client.h"
+#include "input.h"
+#include "video.h"
+#include <signal.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+static volatile sig_atomic_t interrupted = 0;
+
+static struct {
+    cgbl_context_t *context;
+    const cgbl_option_t *option;
+    struct {
+        FILE *file;
+        bool pending;
+        uint32_t frame;
+        uint8_t state;
+    } input;
+    struct {
+        uint32_t count;
+        struct timespec begin;
+    } frame;
+    struct {
+        FILE *audio;
+        FILE *video;
+    } output;
+} client = {};
+
+static void cgbl_client_interrupt(int number) {
+    interrupted = 1;
+}
+
+static cgbl_error_e cgbl_client_file_open(FILE **const file, const char *const path, const char *const mode) {
+    if (!(*file = fopen(path, mode))) {
+        return CGBL_ERROR("Failed to open file: \'%s\'", path);
+    }
+    return CGBL_SUCCESS;
+}
+
+static void cgbl_client_file_close(FILE *const file) {
+    if (file && (file != stdin)) {
+        fclose(file);
+    }
+}
+
+static float cgbl_client_elapsed(void) {
+    struct timespec end = {};
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return (end.tv_sec - client.frame.begin.tv_sec) + ((end.tv_nsec - client.frame.begin.tv_nsec) / 1000000000.f);
+}
+
+static cgbl_error_e cgbl_client_input_create(void) {
+    cgbl_error_e result = CGBL_SUCCESS;
+    if (client.option->input) {
+        if (!strcmp(client.option->input, "-")) {
+            client.input.file = stdin;
+        } else {
+            result = cgbl_client_file_open(&client.input.file, client.option->input, "r");
+        }
+    }
+    return result;
+}
+
+static cgbl_error_e cgbl_client_input_sync(void) {
+    while (client.input.file) {
+        unsigned frame = 0, state = 0;
+        if (!client.input.pending) {
+            int count = fscanf(client.input.file, "%u %x", &frame, &state);
+            if (count == EOF) {
+                cgbl_client_file_close(client.input.file);
+                client.input.file = NULL;
+                break;
+            } else if (count != 2) {
+                return CGBL_ERROR("Malformed input: \'%s\'", client.option->input);
+            }
+            client.input.frame = frame;
+            client.input.state = state;
+            client.input.pending = true;
+        }
+        if (client.input.frame > client.frame.count) {
+            break;
+        }
+        for (cgbl_button_e button = 0; button < CGBL_BUTTON_MAX; ++button) {
+            (*cgbl_input_button(client.context))[button] = client.input.state & (1 << button);
+        }
+        client.input.pending = false;
+    }
+    return CGBL_SUCCESS;
+}
+
+static cgbl_error_e cgbl_client_output_create(void) {
+    cgbl_error_e result = CGBL_SUCCESS;
+    if (client.option->output.audio) {
+        result = cgbl_client_file_open(&client.output.audio, client.option->output.audio, "wb");
+    }
+    if ((result == CGBL_SUCCESS) && client.option->output.video) {
+        result = cgbl_client_file_open(&client.output.video, client.option->output.video, "wb");
+    }
+    return result;
+}
+
+static cgbl_error_e cgbl_client_output_sync(void) {
+    if (client.output.audio && (fwrite(cgbl_audio_sample(client.context), sizeof(float), CGBL_AUDIO_SAMPLES, client.output.audio) !=
+                                CGBL_AUDIO_SAMPLES)) {
+        return CGBL_ERROR("Failed to write file: \'%s\'", client.option->output.audio);
+    }
+    if (client.output.video && (fwrite(cgbl_video_color(client.context), sizeof(uint16_t), CGBL_VIDEO_HEIGHT * CGBL_VIDEO_WIDTH,
+                                       client.output.video) != (CGBL_VIDEO_HEIGHT * CGBL_VIDEO_WIDTH))) {
+        return CGBL_ERROR("Failed to write file: \'%s\'", client.option->output.video);
+    }
+    return CGBL_SUCCESS;
+}
+
+cgbl_error_e cgbl_client_create(cgbl_context_t *const context, const cgbl_option_t *const option) {
+    cgbl_error_e result = CGBL_SUCCESS;
+    client.context = context;
+    client.option = option;
+    interrupted = 0;
+    signal(SIGINT, cgbl_client_interrupt);
+    signal(SIGTERM, cgbl_client_interrupt);
+    if ((result = cgbl_client_input_create()) == CGBL_SUCCESS) {
+        result = cgbl_client_output_create();
+    }
+    clock_gettime(CLOCK_MONOTONIC, &client.frame.begin);
+    return result;
+}
+
+void cgbl_client_destroy(void) {
+    float elapsed = cgbl_client_elapsed();
+    fprintf(stdout, "%u frames in %.3f seconds (%.1f fps)\n", client.frame.count, elapsed, elapsed ? client.frame.count / elapsed : 0.f);
+    cgbl_client_file_close(client.input.file);
+    cgbl_client_file_close(client.output.audio);
+    cgbl_client_file_close(client.output.video);
+    signal(SIGINT, SIG_DFL);
+    signal(SIGTERM, SIG_DFL);
+    memset(&client, 0, sizeof(client));
+}
+
+cgbl_error_e cgbl_client_poll(void) {
+    if (interrupted || (client.option->frames && (client.frame.count >= client.option->frames))) {
+        return CGBL_COMPLETE;
+    }
+    return cgbl_client_input_sync();
+}
+
+cgbl_error_e cgbl_client_sync(void) {
+    cgbl_error_e result = CGBL_SUCCESS;
+    if ((result = cgbl_client_output_sync()) == CGBL_SUCCESS) {
+        ++client.frame.count;
+    }
+    return result;
+}
+
+#endif /* CLIENT_none */
@@ -21,6 +21,7 @@ static const SDL_Scancode KEY[CGBL_BUTTON_MAX] = { SDL_SCANCODE_X,     SDL_SCANC
                                                    SDL_SCANCODE_RIGHT, SDL_SCANCODE_LEFT, SDL_SCANCODE_UP, SDL_SCANCODE_DOWN };
 
 static struct {
+    cgbl_context_t *context;
     SDL_GameController *controller;
     struct {
         SDL_AudioDeviceID device;
@@ -32,6 +33,7 @@ static struct {
     } frame;
     struct {
         SDL_Cursor *cursor;
+        bool redraw;
         SDL_Renderer *renderer;
         SDL_Texture *texture;
         SDL_Window *window;
@@ -55,7 +57,7 @@ static void cgbl_client_audio_destroy(void) {
 }
 
 static cgbl_error_e cgbl_client_audio_sync(void) {
-    if (SDL_QueueAudio(client.audio.device, cgbl_audio_sample(), CGBL_AUDIO_SAMPLES * sizeof(float))) {
+    if (SDL_QueueAudio(client.audio.device, cgbl_audio_sample(client.context), CGBL_AUDIO_SAMPLES * sizeof(float))) {
         return CGBL_ERROR("SDL_QueueAudio failed: %s", SDL_GetError());
     }
     return CGBL_SUCCESS;
@@ -89,7 +91,7 @@ static void cgbl_client_controller_sync(const SDL_ControllerDeviceEvent *const d
     if (client.controller && (device->which == SDL_JoystickInstanceID(SDL_GameControllerGetJoystick(client.controller)))) {
         for (cgbl_button_e index = 0; index < CGBL_BUTTON_MAX; ++index) {
             if (button->button == BUTTON[index]) {
-                (*cgbl_input_button())[index] = (button->state == SDL_PRESSED);
+                (*cgbl_input_button(client.context))[index] = (button->state == SDL_PRESSED);
                 break;
             }
         }
@@ -119,7 +121,7 @@ static void cgbl_client_keyboard_sync(const SDL_KeyboardEvent *const key) {
     if (!key->repeat) {
         for (cgbl_button_e index = 0; index < CGBL_BUTTON_MAX; ++index) {
             if (key->keysym.scancode == KEY[index]) {
-                (*cgbl_input_button())[index] = (key->state == SDL_PRESSED);
+                (*cgbl_input_button(client.context))[index] = (key->state == SDL_PRESSED);
                 break;
             }
         }
@@ -130,7 +132,7 @@ static cgbl_error_e cgbl_client_video_create(uint8_t scale, bool fullscreen) {
     if ((scale < CGBL_CLIENT_SCALE_MIN) || (scale > CGBL_CLIENT_SCALE_MAX)) {
         return CGBL_ERROR("Unsupported scale: %u", scale);
     }
-    if (!(client.video.window = SDL_CreateWindow(cgbl_cartridge_title(), SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED,
+    if (!(client.video.window = SDL_CreateWindow(cgbl_cartridge_title(client.context), SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED,
                                                  CGBL_VIDEO_WIDTH * scale, CGBL_VIDEO_HEIGHT * scale, SDL_WINDOW_RESIZABLE))) {
         return CGBL_ERROR("SDL_CreateWindow failed: %s", SDL_GetError());
     }
@@ -186,9 +188,18 @@ static void cgbl_client_video_destroy(void) {
 }
 
 static cgbl_error_e cgbl_client_video_sync(void) {
-    if (SDL_UpdateTexture(client.video.texture, NULL, cgbl_video_color(), CGBL_VIDEO_WIDTH * sizeof(uint16_t))) {
-        return CGBL_ERROR("SDL_UpdateTexture failed: %s", SDL_GetError());
+    uint8_t begin = 0, end = 0;
+    if (cgbl_video_dirty(client.context, &begin, &end)) {
+        if (SDL_UpdateTexture(client.video.texture, &(SDL_Rect){ .y = begin, .w = CGBL_VIDEO_WIDTH, .h = end - begin },
+                              (*cgbl_video_color(client.context))[begin], CGBL_VIDEO_WIDTH * sizeof(uint16_t))) {
+            return CGBL_ERROR("SDL_UpdateTexture failed: %s", SDL_GetError());
+        }
+        client.video.redraw = true;
+    }
+    if (!client.video.redraw) {
+        return CGBL_SUCCESS;
     }
+    client.video.redraw = false;
     if (SDL_RenderClear(client.video.renderer)) {
         return CGBL_ERROR("SDL_RenderClear failed: %s", SDL_GetError());
     }
@@ -199,13 +210,14 @@ static cgbl_error_e cgbl_client_video_sync(void) {
     return CGBL_SUCCESS;
 }
 
-cgbl_error_e cgbl_client_create(uint8_t scale, bool fullscreen) {
+cgbl_error_e cgbl_client_create(cgbl_context_t *const context, const cgbl_option_t *const option) {
     cgbl_error_e result = CGBL_SUCCESS;
+    client.context = context;
     if (SDL_Init(SDL_INIT_AUDIO | SDL_INIT_GAMECONTROLLER | SDL_INIT_VIDEO)) {
         return CGBL_ERROR("SDL_Init failed: %s", SDL_GetError());
     }
     cgbl_client_frame_begin();
-    if (((result = cgbl_client_video_create(scale, fullscreen)) == CGBL_SUCCESS) &&
+    if (((result = cgbl_client_video_create(option->scale, option->fullscreen)) == CGBL_SUCCESS) &&
         ((result = cgbl_client_audio_create()) == CGBL_SUCCESS)) {
         cgbl_client_controller_detect();
     }
@@ -242,6 +254,9 @@ cgbl_error_e cgbl_client_poll(void) {
             break;
         case SDL_QUIT:
             return CGBL_COMPLETE;
+        case SDL_WINDOWEVENT:
+            client.video.redraw = true;
+            break;
         default:
             break;
         }
@@ -21,6 +21,7 @@ static const SDL_Scancode KEY[CGBL_BUTTON_MAX] = { SDL_SCANCODE_X,     SDL_SCANC
                                                    SDL_SCANCODE_RIGHT, SDL_SCANCODE_LEFT, SDL_SCANCODE_UP, SDL_SCANCODE_DOWN };
 
 static struct {
+    cgbl_context_t *context;
     SDL_Gamepad *gamepad;
     struct {
         SDL_AudioStream *stream;
@@ -31,6 +32,7 @@ static struct {
     } frame;
     struct {
         SDL_Cursor *cursor;
+        bool redraw;
         SDL_Renderer *renderer;
         SDL_Texture *texture;
         SDL_Window *window;
@@ -56,7 +58,7 @@ static void cgbl_client_audio_destroy(void) {
 }
 
 static cgbl_error_e cgbl_client_audio_sync(void) {
-    if (!SDL_PutAudioStreamData(client.audio.stream, cgbl_audio_sample(), CGBL_AUDIO_SAMPLES * sizeof(float))) {
+    if (!SDL_PutAudioStreamData(client.audio.stream, cgbl_audio_sample(client.context), CGBL_AUDIO_SAMPLES * sizeof(float))) {
         return CGBL_ERROR("SDL_PutAudioStreamData failed: %s", SDL_GetError());
     }
     return CGBL_SUCCESS;
@@ -111,7 +113,7 @@ static void cgbl_client_gamepad_sync(const SDL_GamepadDeviceEvent *const device,
     if (client.gamepad && (device->which == SDL_GetJoystickID(SDL_GetGamepadJoystick(client.gamepad)))) {
         for (cgbl_button_e index = 0; index < CGBL_BUTTON_MAX; ++index) {
             if (button->button == BUTTON[index]) {
-                (*cgbl_input_button())[index] = button->down;
+                (*cgbl_input_button(client.context))[index] = button->down;
                 break;
             }
         }
@@ -122,7 +124,7 @@ static void cgbl_client_keyboard_sync(const SDL_KeyboardEvent *const key) {
     if (!key->repeat) {
         for (cgbl_button_e index = 0; index < CGBL_BUTTON_MAX; ++index) {
             if (key->scancode == KEY[index]) {
-                (*cgbl_input_button())[index] = key->down;
+                (*cgbl_input_button(client.context))[index] = key->down;
                 break;
             }
         }
@@ -133,8 +135,8 @@ static cgbl_error_e cgbl_client_video_create(uint8_t scale, bool fullscreen) {
     if ((scale < CGBL_CLIENT_SCALE_MIN) || (scale > CGBL_CLIENT_SCALE_MAX)) {
         return CGBL_ERROR("Unsupported scale: %u", scale);
     }
-    if (!SDL_CreateWindowAndRenderer(cgbl_cartridge_title(), CGBL_VIDEO_WIDTH * scale, CGBL_VIDEO_HEIGHT * scale, SDL_WINDOW_RESIZABLE,
-                                     &client.video.window, &client.video.renderer)) {
+    if (!SDL_CreateWindowAndRenderer(cgbl_cartridge_title(client.context), CGBL_VIDEO_WIDTH * scale, CGBL_VIDEO_HEIGHT * scale,
+                                     SDL_WINDOW_RESIZABLE, &client.video.window, &client.video.renderer)) {
         return CGBL_ERROR("SDL_CreateWindowAndRenderer failed: %s", SDL_GetError());
     }
     if (!SDL_SetRenderLogicalPresentation(client.video.renderer, CGBL_VIDEO_WIDTH, CGBL_VIDEO_HEIGHT,
@@ -188,9 +190,18 @@ static void cgbl_client_video_destroy(void) {
 }
 
 static cgbl_error_e cgbl_client_video_sync(void) {
-    if (!SDL_UpdateTexture(client.video.texture, NULL, cgbl_video_color(), CGBL_VIDEO_WIDTH * sizeof(uint16_t))) {
-        return CGBL_ERROR("SDL_UpdateTexture failed: %s", SDL_GetError());
+    uint8_t begin = 0, end = 0;
+    if (cgbl_video_dirty(client.context, &begin, &end)) {
+        if (!SDL_UpdateTexture(client.video.texture, &(SDL_Rect){ .y = begin, .w = CGBL_VIDEO_WIDTH, .h = end - begin },
+                               (*cgbl_video_color(client.context))[begin], CGBL_VIDEO_WIDTH * sizeof(uint16_t))) {
+            return CGBL_ERROR("SDL_UpdateTexture failed: %s", SDL_GetError());
+        }
+        client.video.redraw = true;
+    }
+    if (!client.video.redraw) {
+        return CGBL_SUCCESS;
     }
+    client.video.redraw = false;
     if (!SDL_RenderClear(client.video.renderer)) {
         return CGBL_ERROR("SDL_RenderClear failed: %s", SDL_GetError());
     }
@@ -203,13 +214,14 @@ static cgbl_error_e cgbl_client_video_sync(void) {
     return CGBL_SUCCESS;
 }
 
-cgbl_error_e cgbl_client_create(uint8_t scale, bool fullscreen) {
+cgbl_error_e cgbl_client_create(cgbl_context_t *const context, const cgbl_option_t *const option) {
     cgbl_error_e result = CGBL_SUCCESS;
+    client.context = context;
     if (!SDL_Init(SDL_INIT_AUDIO | SDL_INIT_GAMEPAD | SDL_INIT_VIDEO)) {
         return CGBL_ERROR("SDL_Init failed: %s", SDL_GetError());
     }
     cgbl_client_frame_begin();
-    if (((result = cgbl_client_video_create(scale, fullscreen)) == CGBL_SUCCESS) &&
+    if (((result = cgbl_client_video_create(option->scale, option->fullscreen)) == CGBL_SUCCESS) &&
         ((result = cgbl_client_audio_create()) == CGBL_SUCCESS)) {
         cgbl_client_gamepad_detect();
     }
@@ -246,6 +258,9 @@ cgbl_error_e cgbl_client_poll(void) {
             break;
         case SDL_EVENT_QUIT:
             return CGBL_COMPLETE;
+        case SDL_EVENT_WINDOW_FIRST ... SDL_EVENT_WINDOW_LAST:
+            client.video.redraw = true;
+            break;
         default:
             break;
         }
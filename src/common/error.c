@@ -8,7 +8,7 @@
 #include <stdio.h>
 #include <string.h>
 
-static char error[256] = {};
+static thread_local char error[256] = {};
 
 const char *cgbl_error(void) {
     return error;
@@ -0,0 +1,105 @@
+/*
+ * SPDX-FileCopyrightText: 2025 David Jolly <jolly.a.david@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "context.h"
+#include <string.h>
+
+static cgbl_error_e cgbl_ram_load(cgbl_context_t *const context) {
+    cgbl_error_e result = CGBL_SUCCESS;
+    if ((result = cgbl_string_allocate(&context->ram.path, "%s.ram", context->path)) == CGBL_SUCCESS) {
+        if (cgbl_file_exists(context->ram.path)) {
+            result = cgbl_file_read(context->ram.path, &context->ram.bank.data, &context->ram.bank.length);
+        } else {
+            context->ram.bank.length = 17 * CGBL_CARTRIDGE_RAM_WIDTH;
+            result = cgbl_buffer_allocate(&context->ram.bank.data, context->ram.bank.length);
+        }
+    }
+    return result;
+}
+
+static void cgbl_ram_unload(cgbl_context_t *const context) {
+    if (context->ram.path) {
+        cgbl_string_free(context->ram.path);
+    }
+    if (context->ram.bank.data) {
+        cgbl_buffer_free(context->ram.bank.data);
+    }
+    memset(&context->ram, 0, sizeof(context->ram));
+}
+
+static void cgbl_rom_unload(cgbl_context_t *const context) {
+    if (context->rom.bank.data) {
+        cgbl_buffer_free(context->rom.bank.data);
+    }
+    if (context->path) {
+        cgbl_string_free(context->path);
+    }
+    memset(&context->rom, 0, sizeof(context->rom));
+    context->path = NULL;
+}
+
+cgbl_error_e cgbl_create(cgbl_context_t **const context) {
+    return cgbl_buffer_allocate((uint8_t **)context, sizeof(**context));
+}
+
+void cgbl_destroy(cgbl_context_t *const context) {
+    if (context) {
+        cgbl_processor_destroy(context);
+        cgbl_video_destroy(context);
+        cgbl_ram_unload(context);
+        cgbl_rom_unload(context);
+        cgbl_buffer_free((uint8_t *)context);
+    }
+}
+
+const float (*cgbl_get_audio(cgbl_context_t *const context))[CGBL_AUDIO_SAMPLES] {
+    return cgbl_audio_sample(context);
+}
+
+uint64_t cgbl_get_cycles(cgbl_context_t *const context) {
+    return cgbl_bus_cycle(context);
+}
+
+const uint16_t (*cgbl_get_framebuffer(cgbl_context_t *const context))[CGBL_VIDEO_HEIGHT][CGBL_VIDEO_WIDTH] {
+    return cgbl_video_color(context);
+}
+
+const uint8_t *cgbl_get_serial(cgbl_context_t *const context, uint32_t *const length) {
+    return cgbl_serial_output(context, length);
+}
+
+cgbl_error_e cgbl_load_rom(cgbl_context_t *const context, const char *const path) {
+    cgbl_error_e result = CGBL_SUCCESS;
+    cgbl_ram_unload(context);
+    cgbl_rom_unload(context);
+    if (((result = cgbl_string_allocate(&context->path, "%s", path)) == CGBL_SUCCESS) &&
+        ((result = cgbl_file_read(context->path, &context->rom.bank.data, &context->rom.bank.length)) == CGBL_SUCCESS) &&
+        ((result = cgbl_ram_load(context)) == CGBL_SUCCESS)) {
+        result = cgbl_reset(context);
+    }
+    return result;
+}
+
+cgbl_error_e cgbl_reset(cgbl_context_t *const context) {
+    return cgbl_bus_reset(context, &context->rom.bank, &context->ram.bank);
+}
+
+cgbl_error_e cgbl_run_frames(cgbl_context_t *const context, uint32_t frames) {
+    cgbl_error_e result = CGBL_SUCCESS;
+    while (frames--) {
+        if ((result = cgbl_bus_run(context)) != CGBL_COMPLETE) {
+            return result;
+        }
+    }
+    return CGBL_SUCCESS;
+}
+
+void cgbl_set_buttons(cgbl_context_t *const context, const bool (*const buttons)[CGBL_BUTTON_MAX]) {
+    memcpy(cgbl_input_button(context), buttons, sizeof(*buttons));
+}
+
+void cgbl_set_option(cgbl_context_t *const context, const cgbl_option_t *const option) {
+    context->option = *option;
+}
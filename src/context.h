@@ -0,0 +1,51 @@
+/*
+ * SPDX-FileCopyrightText: 2025 David Jolly <jolly.a.david@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef CGBL_CONTEXT_H_
+#define CGBL_CONTEXT_H_
+
+#include "audio.h"
+#include "bootloader.h"
+#include "infrared.h"
+#include "input.h"
+#include "mapper_1.h"
+#include "mapper_2.h"
+#include "mapper_3.h"
+#include "mapper_5.h"
+#include "processor.h"
+#include "serial.h"
+#include "timer.h"
+#include "video.h"
+
+struct cgbl_context_s {
+    char *path;
+    cgbl_option_t option;
+    struct {
+        char *path;
+        cgbl_bank_t bank;
+    } ram;
+    struct {
+        cgbl_bank_t bank;
+    } rom;
+    cgbl_audio_t audio;
+    cgbl_bootloader_t bootloader;
+    cgbl_bus_t bus;
+    cgbl_cartridge_t cartridge;
+    cgbl_infrared_t infrared;
+    cgbl_input_t input;
+    union {
+        cgbl_mapper_1_t mapper_1;
+        cgbl_mapper_2_t mapper_2;
+        cgbl_mapper_3_t mapper_3;
+        cgbl_mapper_5_t mapper_5;
+    };
+    cgbl_memory_t memory;
+    cgbl_processor_t processor;
+    cgbl_serial_t serial;
+    cgbl_timer_t timer;
+    cgbl_video_t video;
+};
+
+#endif /* CGBL_CONTEXT_H_ */
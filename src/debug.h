@@ -8,6 +8,6 @@
 
 #include "bus.h"
 
-cgbl_error_e cgbl_debug_entry(const char *const path, const cgbl_bank_t *const rom, cgbl_bank_t *const ram);
+cgbl_error_e cgbl_debug_entry(cgbl_context_t *const context);
 
 #endif /* CGBL_DEBUG_H_ */
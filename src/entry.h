@@ -0,0 +1,13 @@
+/*
+ * SPDX-FileCopyrightText: 2025 David Jolly <jolly.a.david@gmail.com>
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef CGBL_ENTRY_H_
+#define CGBL_ENTRY_H_
+
+#include "cgbl.h"
+
+cgbl_error_e cgbl_entry(const char *const path, const cgbl_option_t *const option);
+
+#endif /* CGBL_ENTRY_H_ */
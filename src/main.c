@@ -3,18 +3,23 @@
  * SPDX-License-Identifier: MIT
  */
 
-#include "cgbl.h"
+#include "entry.h"
 #include <getopt.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
-static const char *DESCRIPTION[] = { "Enable debug mode", "Set window fullscreen", "Show help information", "Set window scale",
-                                     "Show version information" };
+static const char *DESCRIPTION[] = { "Set audio output file", "Enable batch mode", "Enable debug mode", "Set frame count",
+                                     "Set window fullscreen", "Show help information", "Set input file", "Set window scale",
+                                     "Set frame skip count", "Enable render thread", "Show version information", "Set video output file" };
 
-static const struct option OPTION[] = { { "debug", no_argument, NULL, 'd' },   { "fullscreen", no_argument, NULL, 'f' },
-                                        { "help", no_argument, NULL, 'h' },    { "scale", required_argument, NULL, 's' },
-                                        { "version", no_argument, NULL, 'v' }, { NULL, 0, NULL, 0 } };
+static const struct option OPTION[] = { { "audio", required_argument, NULL, 'a' }, { "batch", no_argument, NULL, 'b' },
+                                        { "debug", no_argument, NULL, 'd' },       { "frames", required_argument, NULL, 'n' },
+                                        { "fullscreen", no_argument, NULL, 'f' },  { "help", no_argument, NULL, 'h' },
+                                        { "input", required_argument, NULL, 'i' }, { "scale", required_argument, NULL, 's' },
+                                        { "skip", required_argument, NULL, 'k' },  { "thread", no_argument, NULL, 't' },
+                                        { "version", no_argument, NULL, 'v' },     { "video", required_argument, NULL, 'V' },
+                                        { NULL, 0, NULL, 0 } };
 
 static void usage(void) {
     uint32_t index = 0;
@@ -40,9 +45,15 @@ int main(int argc, char *argv[]) {
     int index = 0;
     const char *path = NULL;
     cgbl_error_e result = CGBL_SUCCESS;
-    cgbl_option_t option = { .debug = false, .fullscreen = false, .scale = 2 };
-    while ((index = getopt_long(argc, argv, "dfhs:v", OPTION, NULL)) != -1) {
+    cgbl_option_t option = { .batch = false, .debug = false, .fullscreen = false, .scale = 2, .skip = 0, .thread = false };
+    while ((index = getopt_long(argc, argv, "a:bdfhi:k:n:s:tvV:", OPTION, NULL)) != -1) {
         switch (index) {
+        case 'a':
+            option.output.audio = optarg;
+            break;
+        case 'b':
+            option.batch = true;
+            break;
         case 'd':
             option.debug = true;
             break;
@@ -52,12 +63,27 @@ int main(int argc, char *argv[]) {
         case 'h':
             usage();
             return CGBL_SUCCESS;
+        case 'i':
+            option.input = optarg;
+            break;
+        case 'k':
+            option.skip = strcmp(optarg, "all") ? strtoul(optarg, NULL, 10) : CGBL_VIDEO_SKIP_ALL;
+            break;
+        case 'n':
+            option.frames = strtoul(optarg, NULL, 10);
+            break;
         case 's':
             option.scale = strtol(optarg, NULL, 10);
             break;
+        case 't':
+            option.thread = true;
+            break;
         case 'v':
             version();
             return CGBL_SUCCESS;
+        case 'V':
+            option.output.video = optarg;
+            break;
         case '?':
         default:
             usage();